@@ -19,6 +19,7 @@
 
 #include "dump1090.h"
 #include "adaptive.h"
+#include "dsp/helpers/log_histogram.h"
 
 //
 // gain limits
@@ -104,8 +105,11 @@ static void adaptive_burst_end_of_block();
 // noise floor measurement (adaptive dynamic range)
 //
 
-static unsigned *adaptive_range_radix;                 // radix-sort buckets for current block
-static unsigned adaptive_range_radix_counter;          // sum of all radix-sort buckets (= number of samples sorted)
+// Only every Nth sample is counted towards the noise floor; adjacent samples
+// are strongly correlated anyway, and this is plenty to find a percentile
+static const unsigned adaptive_range_stride = 4;
+static unsigned *adaptive_range_histogram;             // log-scale histogram of sample magnitudes for current block
+static unsigned adaptive_range_histogram_counter;      // sum of all histogram buckets (= number of samples counted)
 static double adaptive_range_smoothed;                 // smoothed noise floor estimate, dBFS
 static enum { RANGE_SCAN_IDLE, RANGE_SCAN_UP, RANGE_SCAN_DOWN, RANGE_RESCAN_UP, RANGE_RESCAN_DOWN } adaptive_range_state = RANGE_SCAN_UP;
 static unsigned adaptive_range_change_timer;           // countdown inhibiting control after changing gain
@@ -195,7 +199,7 @@ void adaptive_init()
     adaptive_burst_window_remaining = adaptive_samples_per_window;
     adaptive_burst_window_counter = 0;
 
-    adaptive_range_radix = calloc(65536, sizeof(unsigned));
+    adaptive_range_histogram = calloc(LOG_HISTOGRAM_BUCKETS, sizeof(unsigned));
     adaptive_range_state = RANGE_RESCAN_UP;
 
     // select and enforce gain limits
@@ -385,13 +389,10 @@ static void adaptive_range_update(uint16_t *buf, unsigned length)
     if (!Modes.adaptive_range_control)
         return;
 
-    adaptive_range_radix_counter += length;
-    while (length--) {
-        // do a very simple radix sort of sample magnitudes
-        // so we can later find the Nth percentile value
-        ++adaptive_range_radix[buf[0]];
-        ++buf;
-    }
+    // build a histogram of (a sample of) the sample magnitudes
+    // so we can later find the Nth percentile value
+    adaptive_range_histogram_counter += (length + adaptive_range_stride - 1) / adaptive_range_stride;
+    starch_histogram_log_u16(buf, length, adaptive_range_stride, adaptive_range_histogram);
 }
 
 // Noise measurement: we reached the end of a block, update
@@ -403,11 +404,19 @@ static void adaptive_range_end_of_block()
 
     unsigned n = 0, i = 0;
 
-    // measure Nth percentile magnitude
-    unsigned count_n = adaptive_range_radix_counter * Modes.adaptive_range_percentile / 100;
-    while (i < 65536 && n <= count_n)
-        n += adaptive_range_radix[i++];
-    uint16_t percentile_n = i - 1;
+    // measure Nth percentile magnitude: find the histogram bucket it falls
+    // in, then interpolate within the bucket
+    unsigned count_n = adaptive_range_histogram_counter * Modes.adaptive_range_percentile / 100;
+    while (i < LOG_HISTOGRAM_BUCKETS && n + adaptive_range_histogram[i] <= count_n)
+        n += adaptive_range_histogram[i++];
+
+    double percentile_n;
+    if (i < LOG_HISTOGRAM_BUCKETS) {
+        unsigned width = log_histogram_bucket_width(i);
+        percentile_n = log_histogram_bucket_low(i) + (count_n - n) * width / adaptive_range_histogram[i];
+    } else {
+        percentile_n = 65535;
+    }
 
     // maintain an EMA of the Nth percentile
     adaptive_range_smoothed = adaptive_range_smoothed * (1 - Modes.adaptive_range_alpha) + percentile_n * Modes.adaptive_range_alpha;
@@ -418,9 +427,9 @@ static void adaptive_range_end_of_block()
         Modes.stats_current.adaptive_noise_dbfs = 0;
     }
 
-    // reset radix sort for the next block
-    memset(adaptive_range_radix, 0, 65536 * sizeof(unsigned));
-    adaptive_range_radix_counter = 0;
+    // reset histogram for the next block
+    memset(adaptive_range_histogram, 0, LOG_HISTOGRAM_BUCKETS * sizeof(unsigned));
+    adaptive_range_histogram_counter = 0;
 }
 
 // Burst measurement: we reached the end of a block, update our burst rate estimate
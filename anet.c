@@ -314,6 +314,33 @@ static int anetGenericAccept(char *err, int s, struct sockaddr *sa, socklen_t *l
     return fd;
 }
 
+/* Format the remote address of a connected socket as numeric host:port
+ * ([host]:port for IPv6) */
+int anetPeerToString(char *err, int fd, char *buf, int buflen)
+{
+    struct sockaddr_storage ss;
+    socklen_t sslen = sizeof(ss);
+    char host[NI_MAXHOST], port[NI_MAXSERV];
+    int gai_error;
+
+    if (getpeername(fd, (struct sockaddr*)&ss, &sslen) == -1) {
+        anetSetError(err, "getpeername: %s", strerror(errno));
+        return ANET_ERR;
+    }
+
+    gai_error = getnameinfo((struct sockaddr*)&ss, sslen, host, sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV);
+    if (gai_error != 0) {
+        anetSetError(err, "getnameinfo: %s", gai_strerror(gai_error));
+        return ANET_ERR;
+    }
+
+    if (ss.ss_family == AF_INET6)
+        snprintf(buf, buflen, "[%s]:%s", host, port);
+    else
+        snprintf(buf, buflen, "%s:%s", host, port);
+    return ANET_OK;
+}
+
 int anetTcpAccept(char *err, int s) {
     int fd;
     struct sockaddr_storage ss;
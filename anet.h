@@ -72,5 +72,6 @@ int anetNonBlock(char *err, int fd);
 int anetTcpNoDelay(char *err, int fd);
 int anetTcpKeepAlive(char *err, int fd);
 int anetSetSendBuffer(char *err, int fd, int buffsize);
+int anetPeerToString(char *err, int fd, char *buf, int buflen);
 
 #endif
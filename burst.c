@@ -0,0 +1,613 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// burst.c: sparse burst capture files
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+_Static_assert(sizeof(struct burst_file_header) == 56, "burst_file_header layout changed");
+_Static_assert(sizeof(struct burst_record_header) == 24, "burst_record_header layout changed");
+_Static_assert(sizeof(struct burst_index_entry) == 24, "burst_index_entry layout changed");
+_Static_assert(sizeof(struct burst_file_trailer) == 16, "burst_file_trailer layout changed");
+
+static unsigned bytesPerSample(input_format_t format)
+{
+    switch (format) {
+    case INPUT_UC8:
+        return 2;
+    case INPUT_SC16:
+    case INPUT_SC16Q11:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+//
+// ============================= Recording ================================
+//
+
+static struct {
+    FILE *out;
+    uint64_t offset;                // current file offset
+    unsigned bytes_per_sample;
+    double sample_rate;
+    unsigned margin;                // samples kept either side of a burst
+    double squelch;                 // threshold as a multiple of the noise floor
+
+    uint16_t *peaks;                // block_max_u16 output, one per block
+    unsigned peaks_size;
+
+    // the record being collected
+    char *chunk;                    // BURST_MAX_SAMPLES samples
+    uint64_t chunk_start;           // input sample number of chunk[0]
+    unsigned chunk_count;
+    uint64_t next;                  // input sample number after the last collected sample
+
+    bool open;                      // inside a burst
+    unsigned quiet;                 // samples since the last active block
+
+    // the last `margin` samples of the previous block, for the margin
+    // before a burst that starts near the beginning of a block
+    char *history;
+    unsigned history_count;
+    uint64_t history_end;           // input sample number after the last history sample
+
+    struct burst_index_entry *index;
+    unsigned index_count;
+    unsigned index_size;
+
+    uint64_t samples_seen;
+    uint64_t samples_kept;
+} record;
+
+static void recordFailed(const char *what)
+{
+    fprintf(stderr, "burst recorder: %s %s: %s; recording stopped\n",
+            what, Modes.burst_record_file, strerror(errno));
+    fclose(record.out);
+    record.out = NULL;
+}
+
+static bool recordWrite(const void *data, size_t len)
+{
+    if (fwrite(data, 1, len, record.out) != len) {
+        recordFailed("error writing");
+        return false;
+    }
+    record.offset += len;
+    return true;
+}
+
+bool burstRecordStart(input_format_t format, double sample_rate)
+{
+    if (!Modes.burst_record_file)
+        return true;
+
+    if (record.out) {
+        // only one input is recorded
+        return true;
+    }
+
+    if (!(record.bytes_per_sample = bytesPerSample(format))) {
+        fprintf(stderr, "burst recorder: unhandled input format\n");
+        return false;
+    }
+
+    record.sample_rate = sample_rate;
+    record.margin = (unsigned) (Modes.burst_record_margin * 1e-6 * sample_rate + 0.5);
+    record.squelch = pow(10, Modes.burst_record_squelch / 20.0);
+
+    if (!(record.chunk = malloc((size_t) BURST_MAX_SAMPLES * record.bytes_per_sample)) ||
+        !(record.history = malloc((size_t) (record.margin + 1) * record.bytes_per_sample))) {
+        fprintf(stderr, "burst recorder: out of memory\n");
+        return false;
+    }
+
+    if (!(record.out = fopen(Modes.burst_record_file, "wb"))) {
+        fprintf(stderr, "burst recorder: can't create %s: %s\n", Modes.burst_record_file, strerror(errno));
+        return false;
+    }
+    setvbuf(record.out, NULL, _IOFBF, 1024 * 1024);
+
+    struct burst_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BURST_FILE_MAGIC, sizeof(BURST_FILE_MAGIC));
+    header.version = BURST_FILE_VERSION;
+    header.byte_order = BURST_BYTE_ORDER;
+    header.input_format = format;
+    header.bytes_per_sample = record.bytes_per_sample;
+    header.sample_rate = sample_rate;
+    header.start_time = mstime();
+    header.margin = record.margin;
+
+    record.offset = 0;
+    return recordWrite(&header, sizeof(header));
+}
+
+// Write out the collected record, if any
+static void flushChunk(void)
+{
+    if (!record.chunk_count || !record.out)
+        return;
+
+    if (record.index_count == record.index_size) {
+        unsigned newsize = (record.index_size ? record.index_size * 2 : 1024);
+        struct burst_index_entry *newindex = realloc(record.index, newsize * sizeof(*newindex));
+        if (newindex) {
+            record.index = newindex;
+            record.index_size = newsize;
+        }
+    }
+
+    if (record.index_count < record.index_size) {
+        struct burst_index_entry *entry = &record.index[record.index_count++];
+        entry->offset = record.offset;
+        entry->position = record.chunk_start;
+        entry->samples = record.chunk_count;
+        entry->reserved = 0;
+    }
+
+    struct burst_record_header rh;
+    rh.magic = BURST_RECORD_MAGIC;
+    rh.samples = record.chunk_count;
+    rh.position = record.chunk_start;
+    rh.timestamp = (uint64_t) (record.chunk_start * 12e6 / record.sample_rate);
+
+    if (recordWrite(&rh, sizeof(rh)))
+        recordWrite(record.chunk, (size_t) record.chunk_count * record.bytes_per_sample);
+
+    record.samples_kept += record.chunk_count;
+    record.chunk_count = 0;
+}
+
+// Append samples that start at input sample number `position` to the record
+static void collect(const char *data, unsigned count, uint64_t position)
+{
+    if (record.chunk_count && position != record.chunk_start + record.chunk_count)
+        flushChunk();
+
+    while (count > 0) {
+        if (record.chunk_count == BURST_MAX_SAMPLES)
+            flushChunk();
+        if (!record.chunk_count)
+            record.chunk_start = position;
+
+        unsigned n = BURST_MAX_SAMPLES - record.chunk_count;
+        if (n > count)
+            n = count;
+
+        memcpy(record.chunk + (size_t) record.chunk_count * record.bytes_per_sample, data, (size_t) n * record.bytes_per_sample);
+        record.chunk_count += n;
+        data += (size_t) n * record.bytes_per_sample;
+        position += n;
+        count -= n;
+    }
+
+    record.next = position;
+}
+
+// A burst starts at sample `offset` of the block: collect up to `margin`
+// samples before it, from the history and the block, that haven't been
+// collected already
+static void collectLeadIn(const char *raw, unsigned offset, uint64_t position)
+{
+    uint64_t burst_start = position + offset;
+    uint64_t from = (burst_start > record.margin ? burst_start - record.margin : 0);
+    if (from < record.next)
+        from = record.next;
+
+    if (from < position && record.history_end == position) {
+        uint64_t history_start = position - record.history_count;
+        if (from < history_start)
+            from = history_start;
+        collect(record.history + (size_t) (from - history_start) * record.bytes_per_sample,
+                (unsigned) (position - from), from);
+    }
+
+    if (from < position)
+        from = position;
+    if (from < burst_start)
+        collect(raw + (size_t) (from - position) * record.bytes_per_sample, (unsigned) (burst_start - from), from);
+}
+
+// Keep the last `margin` samples seen
+static void updateHistory(const char *raw, unsigned samples, uint64_t position)
+{
+    const size_t bps = record.bytes_per_sample;
+
+    if (record.history_end != position)
+        record.history_count = 0;
+
+    if (samples >= record.margin) {
+        memcpy(record.history, raw + (samples - record.margin) * bps, record.margin * bps);
+        record.history_count = record.margin;
+    } else {
+        unsigned keep = record.margin - samples;
+        if (keep > record.history_count)
+            keep = record.history_count;
+        memmove(record.history, record.history + (record.history_count - keep) * bps, keep * bps);
+        memcpy(record.history + keep * bps, raw, samples * bps);
+        record.history_count = keep + samples;
+    }
+
+    record.history_end = position + samples;
+}
+
+// The noise floor is the median of the per-block peaks: most blocks hold
+// only noise, so this tracks the gain and the converter's smoothing without
+// being pulled up by the bursts themselves (as the mean would be).
+static double noiseFloor(const uint16_t *peaks, unsigned blocks)
+{
+    unsigned histogram[1024];
+    memset(histogram, 0, sizeof(histogram));
+    for (unsigned b = 0; b < blocks; ++b)
+        ++histogram[peaks[b] >> 6];
+
+    unsigned seen = 0;
+    for (unsigned i = 0; i < 1024; ++i) {
+        seen += histogram[i];
+        if (seen * 2 >= blocks)
+            return (i << 6) + 32;
+    }
+    return 65535;
+}
+
+void burstRecordSamples(const void *iq, unsigned samples, uint64_t position,
+                        const uint16_t *mag, unsigned mag_len)
+{
+    if (!record.out || !samples)
+        return;
+
+    const char *raw = iq;
+    const size_t bps = record.bytes_per_sample;
+
+    record.samples_seen += samples;
+
+    if (record.open && position != record.next) {
+        // samples were dropped in the middle of a burst
+        flushChunk();
+        record.open = false;
+    }
+
+    unsigned blocks = (mag_len + BURST_SQUELCH_BLOCK - 1) / BURST_SQUELCH_BLOCK;
+    if (blocks > record.peaks_size) {
+        uint16_t *newpeaks = realloc(record.peaks, blocks * sizeof(*newpeaks));
+        if (!newpeaks) {
+            fprintf(stderr, "burst recorder: out of memory\n");
+            return;
+        }
+        record.peaks = newpeaks;
+        record.peaks_size = blocks;
+    }
+
+    starch_block_max_u16(mag, mag_len, BURST_SQUELCH_BLOCK, record.peaks);
+
+    double threshold = noiseFloor(record.peaks, blocks) * record.squelch;
+    if (threshold > 65535)
+        threshold = 65535;
+
+    // Map each block of magnitude data onto the raw samples it came from
+    // (a resampling converter produces fewer magnitude samples than it
+    // consumes; its small delay is covered by the margin)
+    for (unsigned b = 0; b < blocks; ++b) {
+        unsigned r0 = (unsigned) ((uint64_t) b * BURST_SQUELCH_BLOCK * samples / mag_len);
+        unsigned r1 = (unsigned) ((uint64_t) (b + 1) * BURST_SQUELCH_BLOCK * samples / mag_len);
+        if (r1 > samples || b == blocks - 1)
+            r1 = samples;
+        if (r0 >= r1)
+            continue;
+
+        if (record.peaks[b] >= threshold) {
+            if (!record.open) {
+                collectLeadIn(raw, r0, position);
+                record.open = true;
+            }
+            record.quiet = 0;
+            collect(raw + r0 * bps, r1 - r0, position + r0);
+        } else if (record.open) {
+            collect(raw + r0 * bps, r1 - r0, position + r0);
+            record.quiet += r1 - r0;
+            if (record.quiet >= record.margin) {
+                flushChunk();
+                record.open = false;
+            }
+        }
+    }
+
+    updateHistory(raw, samples, position);
+}
+
+void burstRecordStop(void)
+{
+    if (record.out) {
+        flushChunk();
+
+        struct burst_record_header rh;
+        rh.magic = BURST_INDEX_MAGIC;
+        rh.samples = record.index_count;
+        rh.position = 0;
+        rh.timestamp = 0;
+
+        struct burst_file_trailer trailer;
+        trailer.magic = BURST_INDEX_MAGIC;
+        trailer.count = record.index_count;
+        trailer.index_offset = record.offset;
+
+        if (recordWrite(&rh, sizeof(rh)) &&
+            recordWrite(record.index, (size_t) record.index_count * sizeof(*record.index)) &&
+            recordWrite(&trailer, sizeof(trailer))) {
+            if (fclose(record.out) != 0) {
+                fprintf(stderr, "burst recorder: error writing %s: %s\n", Modes.burst_record_file, strerror(errno));
+            } else {
+                fprintf(stderr, "burst recorder: wrote %u bursts, %" PRIu64 " of %" PRIu64 " samples (%.1f%%) to %s\n",
+                        record.index_count, record.samples_kept, record.samples_seen,
+                        record.samples_seen ? 100.0 * record.samples_kept / record.samples_seen : 0.0,
+                        Modes.burst_record_file);
+            }
+            record.out = NULL;
+        }
+    }
+
+    free(record.chunk);
+    free(record.history);
+    free(record.peaks);
+    free(record.index);
+    memset(&record, 0, sizeof(record));
+}
+
+//
+// =============================== Replay =================================
+//
+
+struct burst_reader {
+    burst_read_fn read_fn;
+    void *opaque;
+    const char *filename;
+    input_format_t format;
+    unsigned bytes_per_sample;
+    unsigned margin;
+    burst_gap_t gap;
+
+    uint64_t position;              // input sample number of the next sample to produce
+
+    // the current record
+    char *data;                     // BURST_MAX_SAMPLES samples
+    uint64_t record_start;          // input sample number of data[0]
+    unsigned record_count;
+    unsigned record_used;           // samples of data already produced
+    bool have_record;
+    bool eof;
+    uint64_t last_end;              // input sample number after the previous record
+
+    // synthesized noise
+    double noise_sigma;             // per I/Q component, in raw input units
+    uint32_t rng;
+};
+
+bool burstIsCaptureFile(const void *buf, size_t len)
+{
+    return (len >= sizeof(struct burst_file_header) &&
+            !memcmp(buf, BURST_FILE_MAGIC, sizeof(BURST_FILE_MAGIC)));
+}
+
+struct burst_reader *burstReaderCreate(burst_read_fn read_fn, void *opaque, const char *filename,
+                                       const struct burst_file_header *header,
+                                       burst_gap_t gap)
+{
+    if (header->byte_order != BURST_BYTE_ORDER) {
+        fprintf(stderr, "%s: burst capture was written on a machine with a different byte order\n", filename);
+        return NULL;
+    }
+    if (header->version != BURST_FILE_VERSION) {
+        fprintf(stderr, "%s: unsupported burst capture version %u\n", filename, header->version);
+        return NULL;
+    }
+
+    unsigned bps = bytesPerSample((input_format_t) header->input_format);
+    if (!bps || bps != header->bytes_per_sample) {
+        fprintf(stderr, "%s: unsupported sample format in burst capture\n", filename);
+        return NULL;
+    }
+
+    if (header->sample_rate != Modes.input_sample_rate) {
+        fprintf(stderr, "%s: burst capture was recorded at %.0f samples/second; use --sample-rate %.0f to replay it\n",
+                filename, header->sample_rate, header->sample_rate);
+        return NULL;
+    }
+
+    struct burst_reader *reader = calloc(1, sizeof(*reader));
+    if (!reader || !(reader->data = malloc((size_t) BURST_MAX_SAMPLES * bps))) {
+        fprintf(stderr, "%s: out of memory\n", filename);
+        free(reader);
+        return NULL;
+    }
+
+    reader->read_fn = read_fn;
+    reader->opaque = opaque;
+    reader->filename = filename;
+    reader->format = (input_format_t) header->input_format;
+    reader->bytes_per_sample = bps;
+    reader->margin = header->margin;
+    reader->gap = gap;
+    reader->last_end = UINT64_MAX;
+    reader->rng = 0x2545F491;
+    return reader;
+}
+
+void burstReaderDestroy(struct burst_reader *reader)
+{
+    if (!reader)
+        return;
+    free(reader->data);
+    free(reader);
+}
+
+// Read exactly len bytes; false at EOF or on error
+static bool readFully(struct burst_reader *reader, void *buf, size_t len)
+{
+    return reader->read_fn(reader->opaque, buf, len) == len;
+}
+
+// Estimate the noise level from the lead-in margin of a burst that
+// starts after a gap
+static void measureNoise(struct burst_reader *reader)
+{
+    unsigned n = reader->margin;
+    if (n > reader->record_count / 2)
+        n = reader->record_count / 2;
+    if (!n)
+        return;
+
+    double sum = 0;
+    if (reader->format == INPUT_UC8) {
+        const uc8_t *in = (const uc8_t *) reader->data;
+        for (unsigned i = 0; i < n; ++i) {
+            double I = in[i].I - 127.5, Q = in[i].Q - 127.5;
+            sum += I * I + Q * Q;
+        }
+    } else {
+        const sc16_t *in = (const sc16_t *) reader->data;
+        for (unsigned i = 0; i < n; ++i) {
+            double I = in[i].I, Q = in[i].Q;
+            sum += I * I + Q * Q;
+        }
+    }
+
+    double sigma = sqrt(sum / n / 2);
+    if (reader->noise_sigma == 0)
+        reader->noise_sigma = sigma;
+    else
+        reader->noise_sigma = 0.9 * reader->noise_sigma + 0.1 * sigma;
+}
+
+// Read the next burst record; false at the end of the bursts
+static bool nextRecord(struct burst_reader *reader)
+{
+    for (;;) {
+        struct burst_record_header rh;
+        if (!readFully(reader, &rh, sizeof(rh)) || rh.magic == BURST_INDEX_MAGIC)
+            return false;
+
+        if (rh.magic != BURST_RECORD_MAGIC || rh.samples > BURST_MAX_SAMPLES) {
+            fprintf(stderr, "%s: corrupt burst record, stopping\n", reader->filename);
+            return false;
+        }
+
+        if (!readFully(reader, reader->data, (size_t) rh.samples * reader->bytes_per_sample)) {
+            fprintf(stderr, "%s: truncated burst record, stopping\n", reader->filename);
+            return false;
+        }
+
+        // skip anything that overlaps samples already produced
+        if (rh.position + rh.samples <= reader->position)
+            continue;
+
+        // a record that doesn't continue the previous one starts with
+        // the recorder's lead-in margin, which is noise
+        bool after_gap = (rh.position != reader->last_end);
+        reader->last_end = rh.position + rh.samples;
+        reader->record_start = rh.position;
+        reader->record_count = rh.samples;
+        reader->record_used = (rh.position < reader->position ? (unsigned) (reader->position - rh.position) : 0);
+        reader->have_record = true;
+
+        if (after_gap && reader->gap == BURST_GAP_NOISE)
+            measureNoise(reader);
+        return true;
+    }
+}
+
+static inline uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return (*state = x);
+}
+
+// Approximately gaussian, zero mean, unit variance: the sum of the four
+// bytes of a random word (Irwin-Hall), rescaled
+static inline double gaussian(uint32_t *state)
+{
+    uint32_t r = xorshift32(state);
+    unsigned sum = (r & 0xFF) + ((r >> 8) & 0xFF) + ((r >> 16) & 0xFF) + (r >> 24);
+    return ((double) sum - 510.0) / 147.8;
+}
+
+static void fillGap(struct burst_reader *reader, char *buf, unsigned count)
+{
+    if (reader->gap == BURST_GAP_ZERO || reader->noise_sigma == 0) {
+        // zero signal (as near as UC8 gets to it)
+        memset(buf, reader->format == INPUT_UC8 ? 128 : 0, (size_t) count * reader->bytes_per_sample);
+        return;
+    }
+
+    double sigma = reader->noise_sigma;
+    if (reader->format == INPUT_UC8) {
+        uc8_t *out = (uc8_t *) buf;
+        for (unsigned i = 0; i < count; ++i) {
+            int I = (int) (127.5 + sigma * gaussian(&reader->rng));
+            int Q = (int) (127.5 + sigma * gaussian(&reader->rng));
+            out[i].I = (uint8_t) (I < 0 ? 0 : I > 255 ? 255 : I);
+            out[i].Q = (uint8_t) (Q < 0 ? 0 : Q > 255 ? 255 : Q);
+        }
+    } else {
+        sc16_t *out = (sc16_t *) buf;
+        for (unsigned i = 0; i < count; ++i) {
+            int I = (int) lrint(sigma * gaussian(&reader->rng));
+            int Q = (int) lrint(sigma * gaussian(&reader->rng));
+            out[i].I = (int16_t) (I < INT16_MIN ? INT16_MIN : I > INT16_MAX ? INT16_MAX : I);
+            out[i].Q = (int16_t) (Q < INT16_MIN ? INT16_MIN : Q > INT16_MAX ? INT16_MAX : Q);
+        }
+    }
+}
+
+unsigned burstReaderRead(struct burst_reader *reader, void *buf, unsigned samples)
+{
+    char *out = buf;
+    const size_t bps = reader->bytes_per_sample;
+    unsigned produced = 0;
+
+    while (produced < samples && !reader->eof) {
+        if (!reader->have_record || reader->record_used == reader->record_count) {
+            reader->have_record = false;
+            if (!nextRecord(reader)) {
+                reader->eof = true;
+                break;
+            }
+        }
+
+        unsigned n;
+        if (reader->position < reader->record_start) {
+            // gap before the next burst
+            uint64_t gap = reader->record_start - reader->position;
+            n = (gap < samples - produced ? (unsigned) gap : samples - produced);
+            fillGap(reader, out + produced * bps, n);
+        } else {
+            n = reader->record_count - reader->record_used;
+            if (n > samples - produced)
+                n = samples - produced;
+            memcpy(out + produced * bps, reader->data + reader->record_used * bps, n * bps);
+            reader->record_used += n;
+        }
+
+        produced += n;
+        reader->position += n;
+    }
+
+    return produced;
+}
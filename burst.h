@@ -0,0 +1,141 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// burst.h: sparse burst capture files (header)
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_BURST_H
+#define DUMP1090_BURST_H
+
+// With --record-bursts <file>, the SDR reader thread writes the raw samples
+// around every burst of signal to <file>, and drops the noise in between.
+// A continuous 2.4MHz UC8 capture is about 17GB per hour; a burst capture
+// of the same traffic is typically a few percent of that.
+//
+// The squelch runs on the magnitude data that the converter has already
+// produced: the buffer is split into blocks of BURST_SQUELCH_BLOCK samples,
+// and a block is active if its peak is --record-squelch dB above the noise
+// floor, taken as the median block peak of the buffer. Active blocks, plus --record-margin
+// microseconds of samples either side, are kept, so bursts closer together
+// than twice the margin are recorded as one.
+//
+// The file is a burst_file_header, followed by one record per burst: a
+// burst_record_header and then the raw samples in the recorded input
+// format. Long bursts are split into several back-to-back records of at
+// most BURST_MAX_SAMPLES samples. Each record carries the input sample
+// number of its first sample, so sdr_ifile can replay the file with the
+// original sample timing, filling the gaps with synthesized noise or with
+// zero signal (--burst-gap). When recording stops cleanly, an index record
+// (one burst_index_entry per burst) and a burst_file_trailer are appended;
+// a file without them (e.g. after a crash) is still read up to the last
+// complete record.
+//
+// All values are in the writer's native byte order; byte_order lets a
+// reader detect a file written on a machine of the other endianness.
+
+#define BURST_FILE_MAGIC "dump1090-bursts"
+#define BURST_FILE_VERSION 1
+#define BURST_BYTE_ORDER 0x01020304
+#define BURST_RECORD_MAGIC 0x54535242   // "BRST"
+#define BURST_INDEX_MAGIC 0x58444e49    // "INDX"
+
+#define BURST_SQUELCH_BLOCK 64          // samples per squelch decision
+#define BURST_MAX_SAMPLES 65536         // samples per record, at most
+
+#define BURST_DEFAULT_SQUELCH 3.0       // dB above the noise floor
+#define BURST_DEFAULT_MARGIN 50.0       // microseconds
+
+struct burst_file_header {
+    char magic[16];                 // BURST_FILE_MAGIC, NUL-padded
+    uint32_t version;               // BURST_FILE_VERSION
+    uint32_t byte_order;            // BURST_BYTE_ORDER
+    uint32_t input_format;          // input_format_t of the samples
+    uint32_t bytes_per_sample;
+    double sample_rate;             // input samples per second
+    uint64_t start_time;            // mstime() of sample number 0
+    uint32_t margin;                // samples kept either side of a burst
+    uint32_t reserved;
+};
+
+struct burst_record_header {
+    uint32_t magic;                 // BURST_RECORD_MAGIC, or BURST_INDEX_MAGIC for the index
+    uint32_t samples;               // samples that follow (index: number of entries that follow)
+    uint64_t position;              // input sample number of the first sample
+    uint64_t timestamp;             // 12MHz timestamp of the first sample
+};
+
+struct burst_index_entry {
+    uint64_t offset;                // file offset of the burst_record_header
+    uint64_t position;              // input sample number of the first sample
+    uint32_t samples;
+    uint32_t reserved;
+};
+
+struct burst_file_trailer {
+    uint32_t magic;                 // BURST_INDEX_MAGIC
+    uint32_t count;                 // number of index entries
+    uint64_t index_offset;          // file offset of the index record
+};
+
+typedef enum { BURST_GAP_NOISE = 0, BURST_GAP_ZERO } burst_gap_t;
+
+//
+// Recording. burstRecordStart() and burstRecordSamples() are called by the
+// SDR driver (from its reader thread, for a single input); both do nothing
+// unless --record-bursts was given.
+//
+
+// Start recording samples of the given format and rate. Returns false,
+// with a message on stderr, if the file can't be created.
+bool burstRecordStart(input_format_t format, double sample_rate);
+
+// Offer one block of raw samples to the recorder. `position` is the input
+// sample number of iq[0] (counting any dropped samples); `mag` is the
+// converter's output for the block.
+void burstRecordSamples(const void *iq, unsigned samples, uint64_t position,
+                        const uint16_t *mag, unsigned mag_len);
+
+// Write out any partial burst and the index, and close the file.
+// Call after the reader thread has exited.
+void burstRecordStop(void);
+
+//
+// Replay, used by sdr_ifile.
+//
+
+struct burst_reader;
+
+// Reads up to len bytes of the capture; returns fewer only at EOF or on
+// error (already reported)
+typedef size_t (*burst_read_fn)(void *opaque, void *buf, size_t len);
+
+// True if buf (at least sizeof(struct burst_file_header) bytes) starts a
+// burst capture file
+bool burstIsCaptureFile(const void *buf, size_t len);
+
+// Prepare to replay the records that follow `header`, reading them with
+// read_fn. Returns NULL, with a message on stderr, if the header can't be
+// used.
+struct burst_reader *burstReaderCreate(burst_read_fn read_fn, void *opaque, const char *filename,
+                                       const struct burst_file_header *header,
+                                       burst_gap_t gap);
+
+// Fill buf with the next `samples` samples of the capture, synthesizing
+// the gaps between bursts. Returns the number of samples produced, which
+// is less than requested only at the end of the capture.
+unsigned burstReaderRead(struct burst_reader *reader, void *buf, unsigned samples);
+
+void burstReaderDestroy(struct burst_reader *reader);
+
+#endif
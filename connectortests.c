@@ -0,0 +1,197 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// connectortests.c - tests for the compressed block reader
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#ifdef ENABLE_ZLIB
+
+#include <zlib.h>
+
+// normally defined in dump1090.c / net_io.c
+struct _Modes Modes;
+
+const char *netOutputFormat(const char *name)
+{
+    MODES_NOTUSED(name);
+    return NULL;
+}
+
+struct net_writer *netOutputWriter(const char *format)
+{
+    MODES_NOTUSED(format);
+    return NULL;
+}
+
+static void putBigEndian32(unsigned char *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+// Build a block carrying data; returns its length
+static size_t makeBlock(unsigned char *block, size_t size, const char *data)
+{
+    uLongf clen = size - NET_CONNECTOR_BLOCK_HEADER;
+    if (compress2(block + NET_CONNECTOR_BLOCK_HEADER, &clen, (const unsigned char *) data, strlen(data), Z_DEFAULT_COMPRESSION) != Z_OK)
+        return 0;
+
+    memcpy(block, NET_CONNECTOR_BLOCK_MAGIC, 4);
+    putBigEndian32(block + 4, clen);
+    putBigEndian32(block + 8, strlen(data));
+    return NET_CONNECTOR_BLOCK_HEADER + clen;
+}
+
+// Feed a good block followed by a bad header, then as much data as the
+// bad header claims. The reader must return the good block's data, then
+// fail on every call without reading (or writing) any further.
+static int testBadHeader(const char *descr, uint32_t in_size, uint32_t out_size, const char *magic)
+{
+    static const char payload[] = "hello, world";
+    unsigned char block[256];
+    int fds[2];
+    int ok = 1;
+
+    if (pipe(fds) < 0) {
+        fprintf(stderr, "testBadHeader[%s]:  FAIL (pipe: %s)\n", descr, strerror(errno));
+        return 0;
+    }
+    anetNonBlock(NULL, fds[0]);
+
+    size_t len = makeBlock(block, sizeof(block), payload);
+    if (!len || write(fds[1], block, len) != (ssize_t) len)
+        ok = 0;
+
+    unsigned char bad[NET_CONNECTOR_BLOCK_HEADER];
+    memcpy(bad, magic, 4);
+    putBigEndian32(bad + 4, in_size);
+    putBigEndian32(bad + 8, out_size);
+    if (write(fds[1], bad, sizeof(bad)) != sizeof(bad))
+        ok = 0;
+
+    // what a hostile sender would follow up with
+    char filler[4096];
+    memset(filler, 0x55, sizeof(filler));
+    if (write(fds[1], filler, sizeof(filler)) != sizeof(filler))
+        ok = 0;
+
+    struct block_reader *reader = blockReaderCreate();
+    char buf[256];
+    int nread = blockReaderRead(reader, fds[0], buf, sizeof(buf));
+    if (nread != -1 || errno != EINVAL) {
+        fprintf(stderr, "  first read returned %d (errno %d), expected -1/EINVAL\n", nread, errno);
+        ok = 0;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        nread = blockReaderRead(reader, fds[0], buf, sizeof(buf));
+        if (nread != -1 || errno != EINVAL) {
+            fprintf(stderr, "  read %d after the error returned %d (errno %d), expected -1/EINVAL\n", i, nread, errno);
+            ok = 0;
+        }
+    }
+
+    // the reader must have stopped at the bad header
+    nread = read(fds[0], buf, sizeof(buf));
+    if (nread <= 0 || buf[0] != 0x55) {
+        fprintf(stderr, "  reader consumed data after the bad header\n");
+        ok = 0;
+    }
+
+    blockReaderFree(reader);
+    close(fds[0]);
+    close(fds[1]);
+
+    fprintf(stderr, "testBadHeader[%s]:  %s\n", descr, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+// A good block split across reads comes back intact
+static int testGoodBlocks(void)
+{
+    static const char first[] = "first block ";
+    static const char second[] = "second block";
+    unsigned char block[256];
+    int fds[2];
+    int ok = 1;
+
+    if (pipe(fds) < 0) {
+        fprintf(stderr, "testGoodBlocks:  FAIL (pipe: %s)\n", strerror(errno));
+        return 0;
+    }
+    anetNonBlock(NULL, fds[0]);
+
+    struct block_reader *reader = blockReaderCreate();
+    char buf[256];
+    int total = 0;
+
+    size_t len = makeBlock(block, sizeof(block), first);
+    // header and part of the data, then the rest
+    if (write(fds[1], block, NET_CONNECTOR_BLOCK_HEADER + 2) != NET_CONNECTOR_BLOCK_HEADER + 2)
+        ok = 0;
+    int nread = blockReaderRead(reader, fds[0], buf, sizeof(buf));
+    if (nread != -1 || errno != EAGAIN)
+        ok = 0;
+    if (write(fds[1], block + NET_CONNECTOR_BLOCK_HEADER + 2, len - NET_CONNECTOR_BLOCK_HEADER - 2) != (ssize_t) (len - NET_CONNECTOR_BLOCK_HEADER - 2))
+        ok = 0;
+
+    len = makeBlock(block, sizeof(block), second);
+    if (write(fds[1], block, len) != (ssize_t) len)
+        ok = 0;
+
+    while ((nread = blockReaderRead(reader, fds[0], buf + total, sizeof(buf) - total)) > 0)
+        total += nread;
+
+    if (total != (int) (strlen(first) + strlen(second)) || memcmp(buf, "first block second block", total)) {
+        fprintf(stderr, "  got '%.*s'\n", total, buf);
+        ok = 0;
+    }
+
+    blockReaderFree(reader);
+    close(fds[0]);
+    close(fds[1]);
+
+    fprintf(stderr, "testGoodBlocks:  %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    int ok = 1;
+    ok = testGoodBlocks() && ok;
+    ok = testBadHeader("magic", 16, 16, "XXXX") && ok;
+    ok = testBadHeader("out_size", 16, NET_CONNECTOR_BLOCK_MAX + 1, NET_CONNECTOR_BLOCK_MAGIC) && ok;
+    ok = testBadHeader("in_size", 1000000, 16, NET_CONNECTOR_BLOCK_MAGIC) && ok;
+    return ok ? 0 : 1;
+}
+
+#else /* !ENABLE_ZLIB */
+
+int main(int argc, char **argv)
+{
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    fprintf(stderr, "connectortests: built without zlib, nothing to test\n");
+    return 0;
+}
+
+#endif
@@ -18,18 +18,70 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "dump1090.h"
+#include "dsp/helpers/resampler.h"
 
-static void convert_uc8(void *iq_data,
-                        uint16_t *mag_data,
-                        unsigned nsamples,
-                        struct converter_state *state,
-                        double *out_mean_level,
-                        double *out_mean_power)
+// Cutoff frequency of the DC-blocking filter used with --dcfilter
+#define DC_FILTER_CUTOFF_HZ 1.0
+
+struct converter_state {
+    dc_filter_t dc_filter;
+
+    // when resampling: the converter that produces magnitudes at the input
+    // rate, the resampling filter, and the magnitudes not yet resampled
+    iq_convert_fn magnitude;
+    resampler_t *resampler;
+    uint16_t *carry_data;
+    unsigned carry;
+    unsigned carry_size;
+};
+
+static void convert_preamble_bitmap(const uint16_t *mag_data, unsigned nsamples, uint64_t *out_preamble_bitmap)
+{
+    if (!out_preamble_bitmap)
+        return;
+
+    if (STARCH_IS_ALIGNED(mag_data))
+        starch_preamble_bitmap_u16_aligned(mag_data, nsamples, out_preamble_bitmap);
+    else
+        starch_preamble_bitmap_u16(mag_data, nsamples, out_preamble_bitmap);
+}
+
+static void convert_mean_power(const uint16_t *mag_data, unsigned nsamples, double *out_mean_level, double *out_mean_power)
+{
+    if (!out_mean_level || !out_mean_power)
+        return;
+
+    if (!nsamples) {
+        *out_mean_level = *out_mean_power = 0;
+        return;
+    }
+
+    if (STARCH_IS_ALIGNED(mag_data))
+        starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
+    else
+        starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
+}
+
+static unsigned convert_uc8(void *iq_data,
+                            uint16_t *mag_data,
+                            unsigned nsamples,
+                            struct converter_state *state,
+                            double *out_mean_level,
+                            double *out_mean_power,
+                            uint64_t *out_preamble_bitmap)
 {
     MODES_NOTUSED(state);
 
     const uc8_t *in = (const uc8_t *) iq_data;
 
+    if (out_mean_level && out_mean_power && out_preamble_bitmap) {
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_power_preamble_uc8_aligned(in, mag_data, nsamples, out_mean_level, out_mean_power, out_preamble_bitmap);
+        else
+            starch_magnitude_power_preamble_uc8(in, mag_data, nsamples, out_mean_level, out_mean_power, out_preamble_bitmap);
+        return nsamples;
+    }
+
     if (out_mean_level && out_mean_power) {
         if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
             starch_magnitude_power_uc8_aligned(in, mag_data, nsamples, out_mean_level, out_mean_power);
@@ -41,14 +93,18 @@ static void convert_uc8(void *iq_data,
         else
             starch_magnitude_uc8(in, mag_data, nsamples);
     }
+
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
 }
 
-static void convert_sc16(void *iq_data,
-                         uint16_t *mag_data,
-                         unsigned nsamples,
-                         struct converter_state *state,
-                         double *out_mean_level,
-                         double *out_mean_power)
+static unsigned convert_sc16(void *iq_data,
+                             uint16_t *mag_data,
+                             unsigned nsamples,
+                             struct converter_state *state,
+                             double *out_mean_level,
+                             double *out_mean_power,
+                             uint64_t *out_preamble_bitmap)
 {
     MODES_NOTUSED(state);
 
@@ -59,20 +115,18 @@ static void convert_sc16(void *iq_data,
     else
         starch_magnitude_sc16(in, mag_data, nsamples);
 
-    if (out_mean_level && out_mean_power) {
-        if (STARCH_IS_ALIGNED(mag_data))
-            starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
-        else
-            starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
-    }
+    convert_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
 }
 
-static void convert_sc16q11(void *iq_data,
-                            uint16_t *mag_data,
-                            unsigned nsamples,
-                            struct converter_state *state,
-                            double *out_mean_level,
-                            double *out_mean_power)
+static unsigned convert_sc16q11(void *iq_data,
+                                uint16_t *mag_data,
+                                unsigned nsamples,
+                                struct converter_state *state,
+                                double *out_mean_level,
+                                double *out_mean_power,
+                                uint64_t *out_preamble_bitmap)
 {
     MODES_NOTUSED(state);
 
@@ -83,41 +137,212 @@ static void convert_sc16q11(void *iq_data,
     else
         starch_magnitude_sc16q11(in, mag_data, nsamples);
 
-    if (out_mean_level && out_mean_power) {
-        if (STARCH_IS_ALIGNED(mag_data))
-            starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
+}
+
+// The DC-filtering converters remove the DC offset as part of the magnitude
+// calculation, so they make no more passes over the data than the
+// unfiltered ones. (UC8 can't use the magnitude/power lookup tables, as
+// they assume a fixed DC offset, but still measures power and builds the
+// preamble bitmap in the same pass as the magnitudes.)
+
+static unsigned convert_uc8_dc(void *iq_data,
+                               uint16_t *mag_data,
+                               unsigned nsamples,
+                               struct converter_state *state,
+                               double *out_mean_level,
+                               double *out_mean_power,
+                               uint64_t *out_preamble_bitmap)
+{
+    const uc8_t *in = (const uc8_t *) iq_data;
+
+    if (out_mean_level && out_mean_power && out_preamble_bitmap) {
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_dc_power_preamble_uc8_aligned(in, mag_data, nsamples, &state->dc_filter, out_mean_level, out_mean_power, out_preamble_bitmap);
         else
-            starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
+            starch_magnitude_dc_power_preamble_uc8(in, mag_data, nsamples, &state->dc_filter, out_mean_level, out_mean_power, out_preamble_bitmap);
+        return nsamples;
+    }
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_uc8_aligned(in, mag_data, nsamples, &state->dc_filter);
+    else
+        starch_magnitude_dc_uc8(in, mag_data, nsamples, &state->dc_filter);
+
+    convert_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
+}
+
+static unsigned convert_sc16_dc(void *iq_data,
+                                uint16_t *mag_data,
+                                unsigned nsamples,
+                                struct converter_state *state,
+                                double *out_mean_level,
+                                double *out_mean_power,
+                                uint64_t *out_preamble_bitmap)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16_aligned(in, mag_data, nsamples, &state->dc_filter);
+    else
+        starch_magnitude_dc_sc16(in, mag_data, nsamples, &state->dc_filter);
+
+    convert_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
+}
+
+static unsigned convert_sc16q11_dc(void *iq_data,
+                                   uint16_t *mag_data,
+                                   unsigned nsamples,
+                                   struct converter_state *state,
+                                   double *out_mean_level,
+                                   double *out_mean_power,
+                                   uint64_t *out_preamble_bitmap)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16q11_aligned(in, mag_data, nsamples, &state->dc_filter);
+    else
+        starch_magnitude_dc_sc16q11(in, mag_data, nsamples, &state->dc_filter);
+
+    convert_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, nsamples, out_preamble_bitmap);
+    return nsamples;
+}
+
+// Resampling converter: convert to magnitudes at the input rate (after any
+// samples left over from the last call), then resample as many whole
+// filter groups as possible into mag_data and keep the rest for next time.
+static unsigned convert_resample(void *iq_data,
+                                 uint16_t *mag_data,
+                                 unsigned nsamples,
+                                 struct converter_state *state,
+                                 double *out_mean_level,
+                                 double *out_mean_power,
+                                 uint64_t *out_preamble_bitmap)
+{
+    const resampler_t *r = state->resampler;
+
+    unsigned available = state->carry + nsamples;
+    if (available > state->carry_size) {
+        uint16_t *grown = realloc(state->carry_data, available * sizeof(uint16_t));
+        if (!grown) {
+            fprintf(stderr, "can't allocate resampling buffer, dropping samples\n");
+            state->carry = 0;
+            convert_mean_power(mag_data, 0, out_mean_level, out_mean_power);
+            return 0;
+        }
+        state->carry_data = grown;
+        state->carry_size = available;
     }
+
+    state->magnitude(iq_data, state->carry_data + state->carry, nsamples, state, NULL, NULL, NULL);
+
+    // never produce more samples than were passed in, so callers can size
+    // their output buffers as for the non-resampling converters
+    unsigned groups = (available >= r->span ? (available - r->span) / r->down + 1 : 0);
+    if (groups * r->up > nsamples)
+        groups = nsamples / r->up;
+
+    const uint16_t *in = state->carry_data;
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_resample_u16_aligned(in, mag_data, groups, r);
+    else
+        starch_resample_u16(in, mag_data, groups, r);
+
+    unsigned consumed = groups * r->down;
+    state->carry = available - consumed;
+    memmove(state->carry_data, state->carry_data + consumed, state->carry * sizeof(uint16_t));
+
+    unsigned produced = groups * r->up;
+    convert_mean_power(mag_data, produced, out_mean_level, out_mean_power);
+    convert_preamble_bitmap(mag_data, produced, out_preamble_bitmap);
+    return produced;
 }
 
 iq_convert_fn init_converter(input_format_t format,
-                             double sample_rate,
+                             double input_rate,
+                             double output_rate,
                              int filter_dc,
                              struct converter_state **out_state)
 {
-    MODES_NOTUSED(sample_rate);
-    MODES_NOTUSED(out_state);
-
-    if (filter_dc) {
-        fprintf(stderr, "DC filtering not supported (yet)\n");
-        return NULL;
-    }
+    *out_state = NULL;
 
+    iq_convert_fn converter;
     switch (format) {
     case INPUT_UC8:
-        return convert_uc8;
+        converter = (filter_dc ? convert_uc8_dc : convert_uc8);
+        break;
     case INPUT_SC16:
-        return convert_sc16;
+        converter = (filter_dc ? convert_sc16_dc : convert_sc16);
+        break;
     case INPUT_SC16Q11:
-        return convert_sc16q11;
+        converter = (filter_dc ? convert_sc16q11_dc : convert_sc16q11);
+        break;
     default:
         fprintf(stderr, "no suitable converter for format=%u\n", (unsigned) format);
         return NULL;
     }
+
+    // Rates within 0.1% (e.g. a ppm-corrected rate) are demodulated as-is
+    bool resample = (fabs(input_rate - output_rate) > output_rate * 1e-3);
+    unsigned up = 1, down = 1;
+    if (resample && !resampler_ratio(input_rate, output_rate, &up, &down)) {
+        fprintf(stderr, "can't resample from %.0fHz to %.0fHz: the input rate must be higher, and a simple multiple of %.0fHz/%u\n",
+                input_rate, output_rate, output_rate, (unsigned) RESAMPLER_MAX_UP);
+        return NULL;
+    }
+
+    if (!filter_dc && !resample)
+        return converter;
+
+    struct converter_state *state = calloc(1, sizeof(*state));
+    if (!state) {
+        fprintf(stderr, "can't allocate converter state\n");
+        return NULL;
+    }
+
+    if (filter_dc) {
+        // UC8 samples are centered on 127.4 (see dsp/helpers/tables.c);
+        // start there rather than waiting for the filter to converge
+        float dc = (format == INPUT_UC8 ? 127.4f : 0.0f);
+        state->dc_filter.dc_I = dc;
+        state->dc_filter.dc_Q = dc;
+        state->dc_filter.rate = 2 * M_PI * DC_FILTER_CUTOFF_HZ / input_rate;
+    }
+
+    if (resample) {
+        if (!(state->resampler = malloc(sizeof(*state->resampler))) || !resampler_build(state->resampler, up, down)) {
+            fprintf(stderr, "can't set up resampling from %.0fHz to %.0fHz\n", input_rate, output_rate);
+            cleanup_converter(state);
+            return NULL;
+        }
+
+        state->magnitude = converter;
+        converter = convert_resample;
+    }
+
+    *out_state = state;
+    return converter;
+}
+
+unsigned converter_carry(const struct converter_state *state)
+{
+    return (state ? state->carry : 0);
 }
 
 void cleanup_converter(struct converter_state *state)
 {
-    MODES_NOTUSED(state);
+    if (!state)
+        return;
+
+    free(state->resampler);
+    free(state->carry_data);
+    free(state);
 }
@@ -23,18 +23,38 @@
 struct converter_state;
 typedef enum { INPUT_UC8=0, INPUT_SC16, INPUT_SC16Q11 } input_format_t;
 
-typedef void (*iq_convert_fn)(void *iq_data,
+// Convert nsamples of IQ data to magnitudes in mag_data, and return the number
+// of magnitude samples written. That is nsamples, unless the converter is
+// resampling to a lower rate; it is never more than nsamples.
+// If out_mean_level and out_mean_power are non-NULL, also measure the mean level and power.
+// If out_preamble_bitmap is non-NULL, also fill in a preamble candidate bitmap for the
+// converted samples (see dsp/helpers/preamble_bitmap.h); it must have room for
+// PREAMBLE_BITMAP_WORDS(nsamples) words.
+
+typedef unsigned (*iq_convert_fn)(void *iq_data,
                               uint16_t *mag_data,
                               unsigned nsamples,
                               struct converter_state *state,
                               double *out_mean_level,
-                              double *out_mean_power);
+                              double *out_mean_power,
+                              uint64_t *out_preamble_bitmap);
 
+// Set up a converter for IQ data sampled at input_rate, producing magnitudes
+// at output_rate (the demodulator's rate). If the rates differ, the
+// magnitudes are resampled; input_rate must be higher than output_rate, by
+// a ratio that is a fraction with a small denominator (e.g. 6, 8 or 10MHz
+// to 2.4MHz).
 iq_convert_fn init_converter(input_format_t format,
-                             double sample_rate,
+                             double input_rate,
+                             double output_rate,
                              int filter_dc,
                              struct converter_state **out_state);
 
+// The number of input samples held over by a resampling converter from
+// previous calls. The next call's first output sample corresponds to the
+// input sample this many samples before the start of that call's data.
+unsigned converter_carry(const struct converter_state *state);
+
 void cleanup_converter(struct converter_state *state);
 
 #endif
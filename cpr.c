@@ -48,10 +48,15 @@
 //   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "cpr.h"
+#include "cpr_nl_table.h"
 
 #include <math.h>
 #include <stdio.h>
 
+// Fixed-point latitudes used by the airborne global decoder
+#define CPR_LAT_90 (CPR_LAT_360 / 4)
+#define CPR_LAT_270 (CPR_LAT_360 / 4 * 3)
+
 //
 //=========================================================================
 //
@@ -63,78 +68,40 @@ static int cprModInt(int a, int b) {
     return res;
 }
 
-static double cprModDouble(double a, double b) {
-    double res = fmod(a, b);
-    if (res < 0) res += b;
+// floor(a / b) for b > 0
+static int cprFloorDiv(int a, int b) {
+    int res = a / b;
+    if (a % b < 0) --res;
     return res;
 }
 
 //
 //=========================================================================
 //
-// The NL function uses the precomputed table from 1090-WP-9-14
+// The NL function uses the precomputed table from 1090-WP-9-14,
+// quantized by latitude (see tools/cpr-nl-table.py)
 //
-static int cprNLFunction(double lat) {
+int cprNLFunction(double lat) {
     if (lat < 0) lat = -lat; // Table is simmetric about the equator
-    if (lat < 10.47047130) return 59;
-    if (lat < 14.82817437) return 58;
-    if (lat < 18.18626357) return 57;
-    if (lat < 21.02939493) return 56;
-    if (lat < 23.54504487) return 55;
-    if (lat < 25.82924707) return 54;
-    if (lat < 27.93898710) return 53;
-    if (lat < 29.91135686) return 52;
-    if (lat < 31.77209708) return 51;
-    if (lat < 33.53993436) return 50;
-    if (lat < 35.22899598) return 49;
-    if (lat < 36.85025108) return 48;
-    if (lat < 38.41241892) return 47;
-    if (lat < 39.92256684) return 46;
-    if (lat < 41.38651832) return 45;
-    if (lat < 42.80914012) return 44;
-    if (lat < 44.19454951) return 43;
-    if (lat < 45.54626723) return 42;
-    if (lat < 46.86733252) return 41;
-    if (lat < 48.16039128) return 40;
-    if (lat < 49.42776439) return 39;
-    if (lat < 50.67150166) return 38;
-    if (lat < 51.89342469) return 37;
-    if (lat < 53.09516153) return 36;
-    if (lat < 54.27817472) return 35;
-    if (lat < 55.44378444) return 34;
-    if (lat < 56.59318756) return 33;
-    if (lat < 57.72747354) return 32;
-    if (lat < 58.84763776) return 31;
-    if (lat < 59.95459277) return 30;
-    if (lat < 61.04917774) return 29;
-    if (lat < 62.13216659) return 28;
-    if (lat < 63.20427479) return 27;
-    if (lat < 64.26616523) return 26;
-    if (lat < 65.31845310) return 25;
-    if (lat < 66.36171008) return 24;
-    if (lat < 67.39646774) return 23;
-    if (lat < 68.42322022) return 22;
-    if (lat < 69.44242631) return 21;
-    if (lat < 70.45451075) return 20;
-    if (lat < 71.45986473) return 19;
-    if (lat < 72.45884545) return 18;
-    if (lat < 73.45177442) return 17;
-    if (lat < 74.43893416) return 16;
-    if (lat < 75.42056257) return 15;
-    if (lat < 76.39684391) return 14;
-    if (lat < 77.36789461) return 13;
-    if (lat < 78.33374083) return 12;
-    if (lat < 79.29428225) return 11;
-    if (lat < 80.24923213) return 10;
-    if (lat < 81.19801349) return 9;
-    if (lat < 82.13956981) return 8;
-    if (lat < 83.07199445) return 7;
-    if (lat < 83.99173563) return 6;
-    if (lat < 84.89166191) return 5;
-    if (lat < 85.75541621) return 4;
-    if (lat < 86.53536998) return 3;
-    if (lat < 87.00000000) return 2;
-    else return 1;
+    if (!(lat < CPR_NL_LAST_TRANSITION)) return 1;
+
+    unsigned bucket = (unsigned) (lat * CPR_NL_BUCKETS_PER_DEGREE);
+    if (lat < cpr_nl_table[bucket].boundary)
+        return cpr_nl_table[bucket].nl;
+    else
+        return cpr_nl_table[bucket].nl - 1;
+}
+
+// As above, for a fixed-point latitude (CPR_LAT_360 units per 360 degrees)
+static int cprNLFunctionFixed(int lat) {
+    if (lat < 0) lat = -lat;
+    if (lat >= CPR_NL_FIXED_LAST_TRANSITION) return 1;
+
+    unsigned bucket = (unsigned) lat >> CPR_NL_FIXED_SHIFT;
+    if (lat < cpr_nl_fixed_table[bucket].boundary)
+        return cpr_nl_fixed_table[bucket].nl;
+    else
+        return cpr_nl_fixed_table[bucket].nl - 1;
 }
 //
 //=========================================================================
@@ -158,54 +125,43 @@ static double cprDlonFunction(double lat, int fflag, int surface) {
 //
 // A few remarks:
 // 1) 131072 is 2^17 since CPR latitude and longitude are encoded in 17 bits.
+// 2) Latitudes are kept in fixed point (CPR_LAT_360 units per 360 degrees);
+//    this unit is a multiple of both the even and odd zone resolution, so
+//    everything up to the final conversion to degrees is exact integer math.
 //
 int decodeCPRairborne(int even_cprlat, int even_cprlon,
                       int odd_cprlat, int odd_cprlon,
                       int fflag,
                       double *out_lat, double *out_lon)
 {
-    double AirDlat0 = 360.0 / 60.0;
-    double AirDlat1 = 360.0 / 59.0;
-    double lat0 = even_cprlat;
-    double lat1 = odd_cprlat;
-    double lon0 = even_cprlon;
-    double lon1 = odd_cprlon;
-
-    double rlat, rlon;
-
     // Compute the Latitude Index "j"
-    int    j     = (int) floor(((59*lat0 - 60*lat1) / 131072) + 0.5);
-    double rlat0 = AirDlat0 * (cprModInt(j,60) + lat0 / 131072);
-    double rlat1 = AirDlat1 * (cprModInt(j,59) + lat1 / 131072);
+    int j = cprFloorDiv(59 * even_cprlat - 60 * odd_cprlat + 65536, 131072);
+    int lat0 = (cprModInt(j, 60) * 131072 + even_cprlat) * 59;
+    int lat1 = (cprModInt(j, 59) * 131072 + odd_cprlat) * 60;
 
-    if (rlat0 >= 270) rlat0 -= 360;
-    if (rlat1 >= 270) rlat1 -= 360;
+    if (lat0 >= CPR_LAT_270) lat0 -= CPR_LAT_360;
+    if (lat1 >= CPR_LAT_270) lat1 -= CPR_LAT_360;
 
     // Check to see that the latitude is in range: -90 .. +90
-    if (rlat0 < -90 || rlat0 > 90 || rlat1 < -90 || rlat1 > 90)
+    if (lat0 < -CPR_LAT_90 || lat0 > CPR_LAT_90 || lat1 < -CPR_LAT_90 || lat1 > CPR_LAT_90)
         return (-2); // bad data
 
     // Check that both are in the same latitude zone, or abort.
-    if (cprNLFunction(rlat0) != cprNLFunction(rlat1))
+    int nl = cprNLFunctionFixed(lat0);
+    if (nl != cprNLFunctionFixed(lat1))
         return (-1); // positions crossed a latitude zone, try again later
 
     // Compute ni and the Longitude Index "m"
-    if (fflag) { // Use odd packet.
-        int ni = cprNFunction(rlat1,1);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat1)-1)) -
-                              (lon1 * cprNLFunction(rlat1))) / 131072.0) + 0.5);
-        rlon = cprDlonFunction(rlat1, 1, 0) * (cprModInt(m, ni)+lon1/131072);
-        rlat = rlat1;
-    } else {     // Use even packet.
-        int ni = cprNFunction(rlat0,0);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat0)-1)) -
-                              (lon1 * cprNLFunction(rlat0))) / 131072) + 0.5);
-        rlon = cprDlonFunction(rlat0, 0, 0) * (cprModInt(m, ni)+lon0/131072);
-        rlat = rlat0;
-    }
+    int ni = nl - (fflag ? 1 : 0);
+    if (ni < 1) ni = 1;
+    int m = cprFloorDiv(even_cprlon * (nl - 1) - odd_cprlon * nl + 65536, 131072);
+    int lon = cprModInt(m, ni) * 131072 + (fflag ? odd_cprlon : even_cprlon);
+
+    double rlat = (fflag ? lat1 : lat0) * (360.0 / CPR_LAT_360);
+    double rlon = lon * (360.0 / 131072) / ni;
 
     // Renormalize to -180 .. +180
-    rlon -= floor( (rlon + 180) / 360 ) * 360;
+    if (rlon >= 180) rlon -= 360;
 
     *out_lat = rlat;
     *out_lon = rlon;
@@ -223,12 +179,10 @@ int decodeCPRsurface(double reflat, double reflon,
     double AirDlat1 = 90.0 / 59.0;
     double lat0 = even_cprlat;
     double lat1 = odd_cprlat;
-    double lon0 = even_cprlon;
-    double lon1 = odd_cprlon;
     double rlon, rlat;
 
     // Compute the Latitude Index "j"
-    int    j     = (int) floor(((59*lat0 - 60*lat1) / 131072) + 0.5);
+    int    j     = cprFloorDiv(59 * even_cprlat - 60 * odd_cprlat + 65536, 131072);
     double rlat0 = AirDlat0 * (cprModInt(j,60) + lat0 / 131072);
     double rlat1 = AirDlat1 * (cprModInt(j,59) + lat1 / 131072);
 
@@ -278,23 +232,17 @@ int decodeCPRsurface(double reflat, double reflon,
         return (-2); // bad data
 
     // Check that both are in the same latitude zone, or abort.
-    if (cprNLFunction(rlat0) != cprNLFunction(rlat1))
+    int nl = cprNLFunction(rlat0);
+    if (nl != cprNLFunction(rlat1))
         return (-1); // positions crossed a latitude zone, try again later
 
     // Compute ni and the Longitude Index "m"
-    if (fflag) { // Use odd packet.
-        int ni = cprNFunction(rlat1,1);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat1)-1)) -
-                              (lon1 * cprNLFunction(rlat1))) / 131072.0) + 0.5);
-        rlon = cprDlonFunction(rlat1, 1, 1) * (cprModInt(m, ni)+lon1/131072);
-        rlat = rlat1;
-    } else {     // Use even packet.
-        int ni = cprNFunction(rlat0,0);
-        int m = (int) floor((((lon0 * (cprNLFunction(rlat0)-1)) -
-                              (lon1 * cprNLFunction(rlat0))) / 131072) + 0.5);
-        rlon = cprDlonFunction(rlat0, 0, 1) * (cprModInt(m, ni)+lon0/131072);
-        rlat = rlat0;
-    }
+    int ni = nl - (fflag ? 1 : 0);
+    if (ni < 1) ni = 1;
+    int m = cprFloorDiv(even_cprlon * (nl - 1) - odd_cprlon * nl + 65536, 131072);
+    int lon = cprModInt(m, ni) * 131072 + (fflag ? odd_cprlon : even_cprlon);
+    rlon = lon * (90.0 / 131072) / ni;
+    rlat = fflag ? rlat1 : rlat0;
 
     // Pick the quadrant that's closest to the reference location -
     // this is not necessarily the same quadrant that contains the
@@ -337,8 +285,10 @@ int decodeCPRrelative(double reflat, double reflon,
     AirDlat = (surface ? 90.0 : 360.0) / (fflag ? 59.0 : 60.0);
 
     // Compute the Latitude Index "j"
-    j = (int) (floor(reflat/AirDlat) +
-               floor(0.5 + cprModDouble(reflat, AirDlat)/AirDlat - fractional_lat));
+    //
+    // This is floor(reflat/AirDlat) + floor(0.5 + MOD(reflat, AirDlat)/AirDlat - fractional_lat)
+    // and the integer part of reflat/AirDlat can be folded into a single floor()
+    j = (int) floor(reflat/AirDlat + 0.5 - fractional_lat);
     rlat = AirDlat * (j + fractional_lat);
     if (rlat >= 270) rlat -= 360;
 
@@ -354,8 +304,7 @@ int decodeCPRrelative(double reflat, double reflon,
 
     // Compute the Longitude Index "m"
     AirDlon = cprDlonFunction(rlat, fflag, surface);
-    m = (int) (floor(reflon/AirDlon) +
-               floor(0.5 + cprModDouble(reflon, AirDlon)/AirDlon - fractional_lon));
+    m = (int) floor(reflon/AirDlon + 0.5 - fractional_lon);
     rlon = AirDlon * (m + fractional_lon);
     if (rlon > 180) rlon -= 360;
 
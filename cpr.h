@@ -36,4 +36,7 @@ int decodeCPRrelative(double reflat, double reflon,
                       int fflag, int surface,
                       double *out_lat, double *out_lon);
 
+// Number of longitude zones (NL) at the given latitude
+int cprNLFunction(double lat);
+
 #endif
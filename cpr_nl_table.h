@@ -0,0 +1,587 @@
+// Generated by tools/cpr-nl-table.py, do not edit.
+// Run "make cprtables" to regenerate.
+
+#ifndef DUMP1090_CPR_NL_TABLE_H
+#define DUMP1090_CPR_NL_TABLE_H
+
+#define CPR_NL_BUCKETS_PER_DEGREE 4
+#define CPR_NL_LAST_TRANSITION 87.00000000
+#define CPR_LAT_360 463994880
+#define CPR_NL_FIXED_SHIFT 19
+#define CPR_NL_FIXED_LAST_TRANSITION 112132096
+
+static const struct {
+    double boundary; // latitude of the first NL transition above the start of this bucket
+    int nl; // NL at the start of this bucket
+} cpr_nl_table[348] = {
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 10.47047130, 59 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 14.82817437, 58 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 18.18626357, 57 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 21.02939493, 56 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 23.54504487, 55 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 25.82924707, 54 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 27.93898710, 53 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 29.91135686, 52 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 31.77209708, 51 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 33.53993436, 50 },
+    { 35.22899598, 49 },
+    { 35.22899598, 49 },
+    { 35.22899598, 49 },
+    { 35.22899598, 49 },
+    { 35.22899598, 49 },
+    { 35.22899598, 49 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 36.85025108, 48 },
+    { 38.41241892, 47 },
+    { 38.41241892, 47 },
+    { 38.41241892, 47 },
+    { 38.41241892, 47 },
+    { 38.41241892, 47 },
+    { 38.41241892, 47 },
+    { 39.92256684, 46 },
+    { 39.92256684, 46 },
+    { 39.92256684, 46 },
+    { 39.92256684, 46 },
+    { 39.92256684, 46 },
+    { 39.92256684, 46 },
+    { 41.38651832, 45 },
+    { 41.38651832, 45 },
+    { 41.38651832, 45 },
+    { 41.38651832, 45 },
+    { 41.38651832, 45 },
+    { 41.38651832, 45 },
+    { 42.80914012, 44 },
+    { 42.80914012, 44 },
+    { 42.80914012, 44 },
+    { 42.80914012, 44 },
+    { 42.80914012, 44 },
+    { 42.80914012, 44 },
+    { 44.19454951, 43 },
+    { 44.19454951, 43 },
+    { 44.19454951, 43 },
+    { 44.19454951, 43 },
+    { 44.19454951, 43 },
+    { 45.54626723, 42 },
+    { 45.54626723, 42 },
+    { 45.54626723, 42 },
+    { 45.54626723, 42 },
+    { 45.54626723, 42 },
+    { 45.54626723, 42 },
+    { 46.86733252, 41 },
+    { 46.86733252, 41 },
+    { 46.86733252, 41 },
+    { 46.86733252, 41 },
+    { 46.86733252, 41 },
+    { 48.16039128, 40 },
+    { 48.16039128, 40 },
+    { 48.16039128, 40 },
+    { 48.16039128, 40 },
+    { 48.16039128, 40 },
+    { 49.42776439, 39 },
+    { 49.42776439, 39 },
+    { 49.42776439, 39 },
+    { 49.42776439, 39 },
+    { 49.42776439, 39 },
+    { 50.67150166, 38 },
+    { 50.67150166, 38 },
+    { 50.67150166, 38 },
+    { 50.67150166, 38 },
+    { 50.67150166, 38 },
+    { 51.89342469, 37 },
+    { 51.89342469, 37 },
+    { 51.89342469, 37 },
+    { 51.89342469, 37 },
+    { 51.89342469, 37 },
+    { 53.09516153, 36 },
+    { 53.09516153, 36 },
+    { 53.09516153, 36 },
+    { 53.09516153, 36 },
+    { 53.09516153, 36 },
+    { 54.27817472, 35 },
+    { 54.27817472, 35 },
+    { 54.27817472, 35 },
+    { 54.27817472, 35 },
+    { 54.27817472, 35 },
+    { 55.44378444, 34 },
+    { 55.44378444, 34 },
+    { 55.44378444, 34 },
+    { 55.44378444, 34 },
+    { 56.59318756, 33 },
+    { 56.59318756, 33 },
+    { 56.59318756, 33 },
+    { 56.59318756, 33 },
+    { 56.59318756, 33 },
+    { 57.72747354, 32 },
+    { 57.72747354, 32 },
+    { 57.72747354, 32 },
+    { 57.72747354, 32 },
+    { 58.84763776, 31 },
+    { 58.84763776, 31 },
+    { 58.84763776, 31 },
+    { 58.84763776, 31 },
+    { 58.84763776, 31 },
+    { 59.95459277, 30 },
+    { 59.95459277, 30 },
+    { 59.95459277, 30 },
+    { 59.95459277, 30 },
+    { 61.04917774, 29 },
+    { 61.04917774, 29 },
+    { 61.04917774, 29 },
+    { 61.04917774, 29 },
+    { 61.04917774, 29 },
+    { 62.13216659, 28 },
+    { 62.13216659, 28 },
+    { 62.13216659, 28 },
+    { 62.13216659, 28 },
+    { 63.20427479, 27 },
+    { 63.20427479, 27 },
+    { 63.20427479, 27 },
+    { 63.20427479, 27 },
+    { 64.26616523, 26 },
+    { 64.26616523, 26 },
+    { 64.26616523, 26 },
+    { 64.26616523, 26 },
+    { 64.26616523, 26 },
+    { 65.31845310, 25 },
+    { 65.31845310, 25 },
+    { 65.31845310, 25 },
+    { 65.31845310, 25 },
+    { 66.36171008, 24 },
+    { 66.36171008, 24 },
+    { 66.36171008, 24 },
+    { 66.36171008, 24 },
+    { 67.39646774, 23 },
+    { 67.39646774, 23 },
+    { 67.39646774, 23 },
+    { 67.39646774, 23 },
+    { 68.42322022, 22 },
+    { 68.42322022, 22 },
+    { 68.42322022, 22 },
+    { 68.42322022, 22 },
+    { 69.44242631, 21 },
+    { 69.44242631, 21 },
+    { 69.44242631, 21 },
+    { 69.44242631, 21 },
+    { 70.45451075, 20 },
+    { 70.45451075, 20 },
+    { 70.45451075, 20 },
+    { 70.45451075, 20 },
+    { 71.45986473, 19 },
+    { 71.45986473, 19 },
+    { 71.45986473, 19 },
+    { 71.45986473, 19 },
+    { 72.45884545, 18 },
+    { 72.45884545, 18 },
+    { 72.45884545, 18 },
+    { 72.45884545, 18 },
+    { 73.45177442, 17 },
+    { 73.45177442, 17 },
+    { 73.45177442, 17 },
+    { 73.45177442, 17 },
+    { 74.43893416, 16 },
+    { 74.43893416, 16 },
+    { 74.43893416, 16 },
+    { 74.43893416, 16 },
+    { 75.42056257, 15 },
+    { 75.42056257, 15 },
+    { 75.42056257, 15 },
+    { 75.42056257, 15 },
+    { 76.39684391, 14 },
+    { 76.39684391, 14 },
+    { 76.39684391, 14 },
+    { 76.39684391, 14 },
+    { 77.36789461, 13 },
+    { 77.36789461, 13 },
+    { 77.36789461, 13 },
+    { 77.36789461, 13 },
+    { 78.33374083, 12 },
+    { 78.33374083, 12 },
+    { 78.33374083, 12 },
+    { 78.33374083, 12 },
+    { 79.29428225, 11 },
+    { 79.29428225, 11 },
+    { 79.29428225, 11 },
+    { 79.29428225, 11 },
+    { 80.24923213, 10 },
+    { 80.24923213, 10 },
+    { 80.24923213, 10 },
+    { 81.19801349, 9 },
+    { 81.19801349, 9 },
+    { 81.19801349, 9 },
+    { 81.19801349, 9 },
+    { 82.13956981, 8 },
+    { 82.13956981, 8 },
+    { 82.13956981, 8 },
+    { 82.13956981, 8 },
+    { 83.07199445, 7 },
+    { 83.07199445, 7 },
+    { 83.07199445, 7 },
+    { 83.07199445, 7 },
+    { 83.99173563, 6 },
+    { 83.99173563, 6 },
+    { 83.99173563, 6 },
+    { 84.89166191, 5 },
+    { 84.89166191, 5 },
+    { 84.89166191, 5 },
+    { 84.89166191, 5 },
+    { 85.75541621, 4 },
+    { 85.75541621, 4 },
+    { 85.75541621, 4 },
+    { 85.75541621, 4 },
+    { 86.53536998, 3 },
+    { 86.53536998, 3 },
+    { 86.53536998, 3 },
+    { 87.00000000, 2 },
+};
+
+static const struct {
+    int boundary; // latitude of the first NL transition above the start of this bucket
+    int nl; // NL at the start of this bucket
+} cpr_nl_fixed_table[214] = {
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 13495126, 59 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 19111659, 58 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 23439815, 57 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 27104255, 56 },
+    { 30346612, 55 },
+    { 30346612, 55 },
+    { 30346612, 55 },
+    { 30346612, 55 },
+    { 30346612, 55 },
+    { 30346612, 55 },
+    { 33290663, 54 },
+    { 33290663, 54 },
+    { 33290663, 54 },
+    { 33290663, 54 },
+    { 33290663, 54 },
+    { 33290663, 54 },
+    { 36009853, 53 },
+    { 36009853, 53 },
+    { 36009853, 53 },
+    { 36009853, 53 },
+    { 36009853, 53 },
+    { 38551991, 52 },
+    { 38551991, 52 },
+    { 38551991, 52 },
+    { 38551991, 52 },
+    { 38551991, 52 },
+    { 40950252, 51 },
+    { 40950252, 51 },
+    { 40950252, 51 },
+    { 40950252, 51 },
+    { 40950252, 51 },
+    { 43228772, 50 },
+    { 43228772, 50 },
+    { 43228772, 50 },
+    { 43228772, 50 },
+    { 45405761, 49 },
+    { 45405761, 49 },
+    { 45405761, 49 },
+    { 45405761, 49 },
+    { 47495356, 48 },
+    { 47495356, 48 },
+    { 47495356, 48 },
+    { 47495356, 48 },
+    { 49508794, 47 },
+    { 49508794, 47 },
+    { 49508794, 47 },
+    { 49508794, 47 },
+    { 51455186, 46 },
+    { 51455186, 46 },
+    { 51455186, 46 },
+    { 51455186, 46 },
+    { 53342036, 45 },
+    { 53342036, 45 },
+    { 53342036, 45 },
+    { 55175617, 44 },
+    { 55175617, 44 },
+    { 55175617, 44 },
+    { 55175617, 44 },
+    { 56961236, 43 },
+    { 56961236, 43 },
+    { 56961236, 43 },
+    { 58703430, 42 },
+    { 58703430, 42 },
+    { 58703430, 42 },
+    { 60406118, 41 },
+    { 60406118, 41 },
+    { 60406118, 41 },
+    { 60406118, 41 },
+    { 62072709, 40 },
+    { 62072709, 40 },
+    { 62072709, 40 },
+    { 63706194, 39 },
+    { 63706194, 39 },
+    { 63706194, 39 },
+    { 65309215, 38 },
+    { 65309215, 38 },
+    { 65309215, 38 },
+    { 66884121, 37 },
+    { 66884121, 37 },
+    { 66884121, 37 },
+    { 68433009, 36 },
+    { 68433009, 36 },
+    { 68433009, 36 },
+    { 69957765, 35 },
+    { 69957765, 35 },
+    { 69957765, 35 },
+    { 71460090, 34 },
+    { 71460090, 34 },
+    { 71460090, 34 },
+    { 72941526, 33 },
+    { 72941526, 33 },
+    { 72941526, 33 },
+    { 74403479, 32 },
+    { 74403479, 32 },
+    { 75847230, 31 },
+    { 75847230, 31 },
+    { 75847230, 31 },
+    { 77273956, 30 },
+    { 77273956, 30 },
+    { 77273956, 30 },
+    { 78684739, 29 },
+    { 78684739, 29 },
+    { 78684739, 29 },
+    { 80080576, 28 },
+    { 80080576, 28 },
+    { 81462389, 27 },
+    { 81462389, 27 },
+    { 81462389, 27 },
+    { 82831033, 26 },
+    { 82831033, 26 },
+    { 84187300, 25 },
+    { 84187300, 25 },
+    { 84187300, 25 },
+    { 85531927, 24 },
+    { 85531927, 24 },
+    { 85531927, 24 },
+    { 86865600, 23 },
+    { 86865600, 23 },
+    { 88188956, 22 },
+    { 88188956, 22 },
+    { 88188956, 22 },
+    { 89502585, 21 },
+    { 89502585, 21 },
+    { 90807035, 20 },
+    { 90807035, 20 },
+    { 90807035, 20 },
+    { 92102810, 19 },
+    { 92102810, 19 },
+    { 93390371, 18 },
+    { 93390371, 18 },
+    { 93390371, 18 },
+    { 94670132, 17 },
+    { 94670132, 17 },
+    { 95942457, 16 },
+    { 95942457, 16 },
+    { 97207653, 15 },
+    { 97207653, 15 },
+    { 97207653, 15 },
+    { 98465957, 14 },
+    { 98465957, 14 },
+    { 99717520, 13 },
+    { 99717520, 13 },
+    { 99717520, 13 },
+    { 100962375, 12 },
+    { 100962375, 12 },
+    { 102200392, 11 },
+    { 102200392, 11 },
+    { 103431203, 10 },
+    { 103431203, 10 },
+    { 103431203, 10 },
+    { 104654063, 9 },
+    { 104654063, 9 },
+    { 105867611, 8 },
+    { 105867611, 8 },
+    { 107069390, 7 },
+    { 107069390, 7 },
+    { 107069390, 7 },
+    { 108254821, 6 },
+    { 108254821, 6 },
+    { 109414713, 5 },
+    { 109414713, 5 },
+    { 110527984, 4 },
+    { 110527984, 4 },
+    { 111533247, 3 },
+    { 111533247, 3 },
+    { 112132096, 2 },
+};
+
+#endif
@@ -20,9 +20,331 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #include "cpr.h"
 
+//
+//=========================================================================
+//
+// Reference implementation: the original floating-point decoder and
+// NL comparison chain, used to verify the table-driven / fixed-point
+// versions in cpr.c and as a baseline for benchmarking.
+//
+static int refModInt(int a, int b) {
+    int res = a % b;
+    if (res < 0) res += b;
+    return res;
+}
+
+static double refModDouble(double a, double b) {
+    double res = fmod(a, b);
+    if (res < 0) res += b;
+    return res;
+}
+
+//
+//=========================================================================
+//
+// The NL function uses the precomputed table from 1090-WP-9-14
+//
+static int refNLFunction(double lat) {
+    if (lat < 0) lat = -lat; // Table is simmetric about the equator
+    if (lat < 10.47047130) return 59;
+    if (lat < 14.82817437) return 58;
+    if (lat < 18.18626357) return 57;
+    if (lat < 21.02939493) return 56;
+    if (lat < 23.54504487) return 55;
+    if (lat < 25.82924707) return 54;
+    if (lat < 27.93898710) return 53;
+    if (lat < 29.91135686) return 52;
+    if (lat < 31.77209708) return 51;
+    if (lat < 33.53993436) return 50;
+    if (lat < 35.22899598) return 49;
+    if (lat < 36.85025108) return 48;
+    if (lat < 38.41241892) return 47;
+    if (lat < 39.92256684) return 46;
+    if (lat < 41.38651832) return 45;
+    if (lat < 42.80914012) return 44;
+    if (lat < 44.19454951) return 43;
+    if (lat < 45.54626723) return 42;
+    if (lat < 46.86733252) return 41;
+    if (lat < 48.16039128) return 40;
+    if (lat < 49.42776439) return 39;
+    if (lat < 50.67150166) return 38;
+    if (lat < 51.89342469) return 37;
+    if (lat < 53.09516153) return 36;
+    if (lat < 54.27817472) return 35;
+    if (lat < 55.44378444) return 34;
+    if (lat < 56.59318756) return 33;
+    if (lat < 57.72747354) return 32;
+    if (lat < 58.84763776) return 31;
+    if (lat < 59.95459277) return 30;
+    if (lat < 61.04917774) return 29;
+    if (lat < 62.13216659) return 28;
+    if (lat < 63.20427479) return 27;
+    if (lat < 64.26616523) return 26;
+    if (lat < 65.31845310) return 25;
+    if (lat < 66.36171008) return 24;
+    if (lat < 67.39646774) return 23;
+    if (lat < 68.42322022) return 22;
+    if (lat < 69.44242631) return 21;
+    if (lat < 70.45451075) return 20;
+    if (lat < 71.45986473) return 19;
+    if (lat < 72.45884545) return 18;
+    if (lat < 73.45177442) return 17;
+    if (lat < 74.43893416) return 16;
+    if (lat < 75.42056257) return 15;
+    if (lat < 76.39684391) return 14;
+    if (lat < 77.36789461) return 13;
+    if (lat < 78.33374083) return 12;
+    if (lat < 79.29428225) return 11;
+    if (lat < 80.24923213) return 10;
+    if (lat < 81.19801349) return 9;
+    if (lat < 82.13956981) return 8;
+    if (lat < 83.07199445) return 7;
+    if (lat < 83.99173563) return 6;
+    if (lat < 84.89166191) return 5;
+    if (lat < 85.75541621) return 4;
+    if (lat < 86.53536998) return 3;
+    if (lat < 87.00000000) return 2;
+    else return 1;
+}
+//
+//=========================================================================
+//
+static int refNFunction(double lat, int fflag) {
+    int nl = refNLFunction(lat) - (fflag ? 1 : 0);
+    if (nl < 1) nl = 1;
+    return nl;
+}
+//
+//=========================================================================
+//
+static double refDlonFunction(double lat, int fflag, int surface) {
+    return (surface ? 90.0 : 360.0) / refNFunction(lat, fflag);
+}
+//
+//=========================================================================
+//
+// This algorithm comes from:
+// http://www.lll.lu/~edward/edward/adsb/DecodingADSBposition.html.
+//
+// A few remarks:
+// 1) 131072 is 2^17 since CPR latitude and longitude are encoded in 17 bits.
+//
+static int refDecodeCPRairborne(int even_cprlat, int even_cprlon,
+                                          int odd_cprlat, int odd_cprlon,
+                                int fflag,
+                                double *out_lat, double *out_lon)
+{
+    double AirDlat0 = 360.0 / 60.0;
+    double AirDlat1 = 360.0 / 59.0;
+    double lat0 = even_cprlat;
+    double lat1 = odd_cprlat;
+    double lon0 = even_cprlon;
+    double lon1 = odd_cprlon;
+
+    double rlat, rlon;
+
+    // Compute the Latitude Index "j"
+    int    j     = (int) floor(((59*lat0 - 60*lat1) / 131072) + 0.5);
+    double rlat0 = AirDlat0 * (refModInt(j,60) + lat0 / 131072);
+    double rlat1 = AirDlat1 * (refModInt(j,59) + lat1 / 131072);
+
+    if (rlat0 >= 270) rlat0 -= 360;
+    if (rlat1 >= 270) rlat1 -= 360;
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat0 < -90 || rlat0 > 90 || rlat1 < -90 || rlat1 > 90)
+        return (-2); // bad data
+
+    // Check that both are in the same latitude zone, or abort.
+    if (refNLFunction(rlat0) != refNLFunction(rlat1))
+        return (-1); // positions crossed a latitude zone, try again later
+
+    // Compute ni and the Longitude Index "m"
+    if (fflag) { // Use odd packet.
+        int ni = refNFunction(rlat1,1);
+        int m = (int) floor((((lon0 * (refNLFunction(rlat1)-1)) -
+                              (lon1 * refNLFunction(rlat1))) / 131072.0) + 0.5);
+        rlon = refDlonFunction(rlat1, 1, 0) * (refModInt(m, ni)+lon1/131072);
+        rlat = rlat1;
+    } else {     // Use even packet.
+        int ni = refNFunction(rlat0,0);
+        int m = (int) floor((((lon0 * (refNLFunction(rlat0)-1)) -
+                              (lon1 * refNLFunction(rlat0))) / 131072) + 0.5);
+        rlon = refDlonFunction(rlat0, 0, 0) * (refModInt(m, ni)+lon0/131072);
+        rlat = rlat0;
+    }
+
+    // Renormalize to -180 .. +180
+    rlon -= floor( (rlon + 180) / 360 ) * 360;
+
+    *out_lat = rlat;
+    *out_lon = rlon;
+
+    return 0;
+}
+
+static int refDecodeCPRsurface(double reflat, double reflon,
+                               int even_cprlat, int even_cprlon,
+                               int odd_cprlat, int odd_cprlon,
+                               int fflag,
+                               double *out_lat, double *out_lon)
+{
+    double AirDlat0 = 90.0 / 60.0;
+    double AirDlat1 = 90.0 / 59.0;
+    double lat0 = even_cprlat;
+    double lat1 = odd_cprlat;
+    double lon0 = even_cprlon;
+    double lon1 = odd_cprlon;
+    double rlon, rlat;
+
+    // Compute the Latitude Index "j"
+    int    j     = (int) floor(((59*lat0 - 60*lat1) / 131072) + 0.5);
+    double rlat0 = AirDlat0 * (refModInt(j,60) + lat0 / 131072);
+    double rlat1 = AirDlat1 * (refModInt(j,59) + lat1 / 131072);
+
+    // Pick the quadrant that's closest to the reference location -
+    // this is not necessarily the same quadrant that contains the
+    // reference location.
+    //
+    // There are also only two valid quadrants: -90..0 and 0..90;
+    // no correct message would try to encoding a latitude in the
+    // ranges -180..-90 and 90..180.
+    //
+    // If the computed latitude is more than 45 degrees north of
+    // the reference latitude (using the northern hemisphere
+    // solution), then the southern hemisphere solution will be
+    // closer to the refernce latitude.
+    //
+    // e.g. reflat=0, rlat=44, use rlat=44
+    //      reflat=0, rlat=46, use rlat=46-90 = -44
+    //      reflat=40, rlat=84, use rlat=84
+    //      reflat=40, rlat=86, use rlat=86-90 = -4
+    //      reflat=-40, rlat=4, use rlat=4
+    //      reflat=-40, rlat=6, use rlat=6-90 = -84
+
+    // As a special case, -90, 0 and +90 all encode to zero, so
+    // there's a little extra work to do there.
+
+    if (rlat0 == 0) {
+        if (reflat < -45)
+            rlat0 = -90;
+        else if (reflat > 45)
+            rlat0 = 90;
+    } else if ((rlat0 - reflat) > 45) {
+        rlat0 -= 90;
+    }
+
+    if (rlat1 == 0) {
+        if (reflat < -45)
+            rlat1 = -90;
+        else if (reflat > 45)
+            rlat1 = 90;
+    } else if ((rlat1 - reflat) > 45) {
+        rlat1 -= 90;
+    }
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat0 < -90 || rlat0 > 90 || rlat1 < -90 || rlat1 > 90)
+        return (-2); // bad data
+
+    // Check that both are in the same latitude zone, or abort.
+    if (refNLFunction(rlat0) != refNLFunction(rlat1))
+        return (-1); // positions crossed a latitude zone, try again later
+
+    // Compute ni and the Longitude Index "m"
+    if (fflag) { // Use odd packet.
+        int ni = refNFunction(rlat1,1);
+        int m = (int) floor((((lon0 * (refNLFunction(rlat1)-1)) -
+                              (lon1 * refNLFunction(rlat1))) / 131072.0) + 0.5);
+        rlon = refDlonFunction(rlat1, 1, 1) * (refModInt(m, ni)+lon1/131072);
+        rlat = rlat1;
+    } else {     // Use even packet.
+        int ni = refNFunction(rlat0,0);
+        int m = (int) floor((((lon0 * (refNLFunction(rlat0)-1)) -
+                              (lon1 * refNLFunction(rlat0))) / 131072) + 0.5);
+        rlon = refDlonFunction(rlat0, 0, 1) * (refModInt(m, ni)+lon0/131072);
+        rlat = rlat0;
+    }
+
+    // Pick the quadrant that's closest to the reference location -
+    // this is not necessarily the same quadrant that contains the
+    // reference location. Unlike the latitude case, all four
+    // quadrants are valid.
+
+    // if reflon is more than 45 degrees away, move some multiple of 90 degrees towards it
+    rlon += floor( (reflon - rlon + 45) / 90 ) * 90;  // this might move us outside (-180..+180), we fix this below
+
+    // Renormalize to -180 .. +180
+    rlon -= floor( (rlon + 180) / 360 ) * 360;
+
+    *out_lat = rlat;
+    *out_lon = rlon;
+    return 0;
+}
+
+//
+//=========================================================================
+//
+// This algorithm comes from:
+// 1090-WP29-07-Draft_CPR101 (which also defines decodeCPR() )
+//
+// Despite what the earlier comment here said, we should *not* be using trunc().
+// See Figure 5-5 / 5-6 and note that floor is applied to (0.5 + fRP - fEP), not
+// directly to (fRP - fEP). Eq 38 is correct.
+//
+static int refDecodeCPRrelative(double reflat, double reflon,
+                                int cprlat, int cprlon,
+                                int fflag, int surface,
+                                double *out_lat, double *out_lon)
+{
+    double AirDlat;
+    double AirDlon;
+    double fractional_lat = cprlat / 131072.0;
+    double fractional_lon = cprlon / 131072.0;
+    double rlon, rlat;
+    int j,m;
+
+    AirDlat = (surface ? 90.0 : 360.0) / (fflag ? 59.0 : 60.0);
+
+    // Compute the Latitude Index "j"
+    j = (int) (floor(reflat/AirDlat) +
+               floor(0.5 + refModDouble(reflat, AirDlat)/AirDlat - fractional_lat));
+    rlat = AirDlat * (j + fractional_lat);
+    if (rlat >= 270) rlat -= 360;
+
+    // Check to see that the latitude is in range: -90 .. +90
+    if (rlat < -90 || rlat > 90) {
+        return (-1);                               // Time to give up - Latitude error
+    }
+
+    // Check to see that answer is reasonable - ie no more than 1/2 cell away
+    if (fabs(rlat - reflat) > (AirDlat/2)) {
+        return (-1);                               // Time to give up - Latitude error
+    }
+
+    // Compute the Longitude Index "m"
+    AirDlon = refDlonFunction(rlat, fflag, surface);
+    m = (int) (floor(reflon/AirDlon) +
+               floor(0.5 + refModDouble(reflon, AirDlon)/AirDlon - fractional_lon));
+    rlon = AirDlon * (m + fractional_lon);
+    if (rlon > 180) rlon -= 360;
+
+    // Check to see that answer is reasonable - ie no more than 1/2 cell away
+    if (fabs(rlon - reflon) > (AirDlon/2))
+        return (-1);                               // Time to give up - Longitude error
+
+    *out_lat = rlat;
+    *out_lon = rlon;
+    return (0);
+}
+
 // Global, airborne CPR test data:
 static const struct {
     int even_cprlat, even_cprlon;   // input: raw CPR values, even message
@@ -300,10 +622,293 @@ static int testCPRRelative() {
     return ok;
 }
 
-int main(int __attribute__ ((unused)) argc, char __attribute__ ((unused)) **argv) {
+// Check the table-driven NL function against the comparison chain,
+// on a fine grid and either side of every transition.
+static int testCPRNLTable() {
+    int ok = 1;
+    unsigned errors = 0;
+
+    for (int i = -9100000; i <= 9100000; ++i) {
+        double lat = i * 1e-5;
+        if (cprNLFunction(lat) != refNLFunction(lat)) {
+            if (errors++ < 10)
+                fprintf(stderr, "testCPRNLTable:  FAIL: NL(%.8f) = %d  (expected %d)\n", lat, cprNLFunction(lat), refNLFunction(lat));
+        }
+    }
+
+    for (double lat = 0; lat < 90; ) {
+        // find the next transition by bisection on the reference function
+        double lo = lat, hi = 90;
+        int nl = refNLFunction(lat);
+        while (hi - lo > 1e-12) {
+            double mid = (lo + hi) / 2;
+            if (refNLFunction(mid) == nl)
+                lo = mid;
+            else
+                hi = mid;
+        }
+
+        double probes[4] = { lo, hi, nextafter(lo, 0), nextafter(hi, 90) };
+        for (unsigned k = 0; k < 4; ++k) {
+            if (cprNLFunction(probes[k]) != refNLFunction(probes[k]) || cprNLFunction(-probes[k]) != refNLFunction(-probes[k])) {
+                if (errors++ < 10)
+                    fprintf(stderr, "testCPRNLTable:  FAIL: NL(%.12f) = %d  (expected %d)\n", probes[k], cprNLFunction(probes[k]), refNLFunction(probes[k]));
+            }
+        }
+
+        lat = hi;
+    }
+
+    if (errors) {
+        ok = 0;
+        fprintf(stderr, "testCPRNLTable:  FAIL: %u mismatches\n", errors);
+    } else {
+        fprintf(stderr, "testCPRNLTable:  PASS\n");
+    }
+
+    return ok;
+}
+
+//
+// Random test data
+//
+
+// xorshift PRNG, so runs are repeatable across platforms
+static uint64_t prng_state = 88172645463325252ULL;
+static uint32_t prng() {
+    prng_state ^= prng_state << 13;
+    prng_state ^= prng_state >> 7;
+    prng_state ^= prng_state << 17;
+    return (uint32_t) (prng_state >> 32);
+}
+
+static double prng_uniform(double lo, double hi) {
+    return lo + (hi - lo) * (prng() / 4294967296.0);
+}
+
+// Encode a position as CPR, per DO-260B A.1.7
+static void encodeCPR(double lat, double lon, int fflag, int surface, int *cprlat, int *cprlon) {
+    double dlat = (surface ? 90.0 : 360.0) / (fflag ? 59 : 60);
+    int yz = (int) floor(131072 * refModDouble(lat, dlat) / dlat + 0.5);
+    double rlat = dlat * (yz / 131072.0 + floor(lat / dlat));
+    int ni = refNLFunction(rlat) - (fflag ? 1 : 0);
+    if (ni < 1)
+        ni = 1;
+    double dlon = (surface ? 90.0 : 360.0) / ni;
+    int xz = (int) floor(131072 * refModDouble(lon, dlon) / dlon + 0.5);
+
+    *cprlat = yz & 0x1FFFF;
+    *cprlon = xz & 0x1FFFF;
+}
+
+typedef struct {
+    double reflat, reflon;
+    int even_cprlat, even_cprlon;
+    int odd_cprlat, odd_cprlon;
+    int fflag;
+} random_cpr_t;
+
+// Mostly plausible even/odd pairs from an aircraft moving a short distance
+// between messages, with a proportion of arbitrary bit patterns mixed in.
+static void generateRandomCPR(random_cpr_t *out, unsigned count, int surface) {
+    for (unsigned i = 0; i < count; ++i) {
+        if ((prng() & 15) == 0) {
+            out[i].reflat = prng_uniform(-90, 90);
+            out[i].reflon = prng_uniform(-180, 180);
+            out[i].even_cprlat = prng() & 0x1FFFF;
+            out[i].even_cprlon = prng() & 0x1FFFF;
+            out[i].odd_cprlat = prng() & 0x1FFFF;
+            out[i].odd_cprlon = prng() & 0x1FFFF;
+        } else {
+            double lat = prng_uniform(surface ? -85 : -89, surface ? 85 : 89);
+            double lon = prng_uniform(-180, 180);
+            double step = surface ? 0.0005 : 0.02;
+
+            encodeCPR(lat, lon, 0, surface, &out[i].even_cprlat, &out[i].even_cprlon);
+            encodeCPR(lat + prng_uniform(-step, step), lon + prng_uniform(-step, step), 1, surface, &out[i].odd_cprlat, &out[i].odd_cprlon);
+            out[i].reflat = lat + prng_uniform(-0.5, 0.5);
+            out[i].reflon = lon + prng_uniform(-0.5, 0.5);
+            if (out[i].reflon >= 180)
+                out[i].reflon -= 360;
+            if (out[i].reflon < -180)
+                out[i].reflon += 360;
+        }
+        out[i].fflag = prng() & 1;
+    }
+}
+
+static int sameResult(int res, double rlat, double rlon, int ref_res, double ref_rlat, double ref_rlon) {
+    if (res != ref_res)
+        return 0;
+    if (res != 0)
+        return 1;
+    if (fabs(rlat - ref_rlat) > 1e-9)
+        return 0;
+    double dlon = fabs(rlon - ref_rlon);
+    // +180 and -180 are the same place
+    return (dlon <= 1e-9 || fabs(dlon - 360) <= 1e-9);
+}
+
+// Check the optimized decoders against the reference decoders on random data
+static int testCPRRandom(unsigned count) {
+    int ok = 1;
+    random_cpr_t *data = malloc(sizeof(*data) * count);
+    if (!data) {
+        fprintf(stderr, "testCPRRandom:  FAIL: out of memory\n");
+        return 0;
+    }
+
+    for (int surface = 0; surface <= 1; ++surface) {
+        unsigned errors_global = 0, errors_relative = 0;
+        generateRandomCPR(data, count, surface);
+
+        for (unsigned i = 0; i < count; ++i) {
+            const random_cpr_t *d = &data[i];
+            double rlat = 0, rlon = 0, ref_rlat = 0, ref_rlon = 0;
+            int res, ref_res;
+
+            if (surface) {
+                res = decodeCPRsurface(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+                ref_res = refDecodeCPRsurface(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &ref_rlat, &ref_rlon);
+            } else {
+                res = decodeCPRairborne(d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+                ref_res = refDecodeCPRairborne(d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &ref_rlat, &ref_rlon);
+            }
+            if (!sameResult(res, rlat, rlon, ref_res, ref_rlat, ref_rlon)) {
+                if (errors_global++ < 10)
+                    fprintf(stderr, "testCPRRandom[%s global]:  FAIL: (%.6f,%.6f,%d,%d,%d,%d,%d): result %d lat %.9f lon %.9f  (expected %d %.9f %.9f)\n",
+                            surface ? "surface" : "airborne",
+                            d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag,
+                            res, rlat, rlon, ref_res, ref_rlat, ref_rlon);
+            }
+
+            int cprlat = d->fflag ? d->odd_cprlat : d->even_cprlat;
+            int cprlon = d->fflag ? d->odd_cprlon : d->even_cprlon;
+            res = decodeCPRrelative(d->reflat, d->reflon, cprlat, cprlon, d->fflag, surface, &rlat, &rlon);
+            ref_res = refDecodeCPRrelative(d->reflat, d->reflon, cprlat, cprlon, d->fflag, surface, &ref_rlat, &ref_rlon);
+            if (!sameResult(res, rlat, rlon, ref_res, ref_rlat, ref_rlon)) {
+                if (errors_relative++ < 10)
+                    fprintf(stderr, "testCPRRandom[%s relative]:  FAIL: (%.6f,%.6f,%d,%d,%d): result %d lat %.9f lon %.9f  (expected %d %.9f %.9f)\n",
+                            surface ? "surface" : "airborne",
+                            d->reflat, d->reflon, cprlat, cprlon, d->fflag,
+                            res, rlat, rlon, ref_res, ref_rlat, ref_rlon);
+            }
+        }
+
+        if (errors_global || errors_relative) {
+            ok = 0;
+            fprintf(stderr, "testCPRRandom[%s]:  FAIL: %u global and %u relative mismatches in %u decodes\n",
+                    surface ? "surface" : "airborne", errors_global, errors_relative, count);
+        } else {
+            fprintf(stderr, "testCPRRandom[%s]:  PASS (%u decodes)\n", surface ? "surface" : "airborne", count);
+        }
+    }
+
+    free(data);
+    return ok;
+}
+
+//
+// Benchmarks
+//
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+typedef enum { BENCH_AIRBORNE, BENCH_SURFACE, BENCH_RELATIVE } bench_type_t;
+
+static double benchmarkDecoder(const random_cpr_t *data, unsigned count, bench_type_t type, int surface, int reference, unsigned *decoded) {
+    struct timespec start, end;
+    unsigned ok = 0;
+    double rlat, rlon;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned i = 0; i < count; ++i) {
+        const random_cpr_t *d = &data[i];
+        int res;
+
+        switch (type) {
+        case BENCH_AIRBORNE:
+            if (reference)
+                res = refDecodeCPRairborne(d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+            else
+                res = decodeCPRairborne(d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+            break;
+        case BENCH_SURFACE:
+            if (reference)
+                res = refDecodeCPRsurface(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+            else
+                res = decodeCPRsurface(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, d->odd_cprlat, d->odd_cprlon, d->fflag, &rlat, &rlon);
+            break;
+        default:
+            if (reference)
+                res = refDecodeCPRrelative(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, 0, surface, &rlat, &rlon);
+            else
+                res = decodeCPRrelative(d->reflat, d->reflon, d->even_cprlat, d->even_cprlon, 0, surface, &rlat, &rlon);
+            break;
+        }
+
+        if (res == 0)
+            ++ok;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    *decoded = ok;
+    return elapsed_ns(&start, &end);
+}
+
+static void benchmarkCPR(unsigned count) {
+    static const struct {
+        const char *name;
+        bench_type_t type;
+        int surface;
+    } benchmarks[] = {
+        { "global airborne", BENCH_AIRBORNE, 0 },
+        { "global surface", BENCH_SURFACE, 1 },
+        { "relative airborne", BENCH_RELATIVE, 0 },
+        { "relative surface", BENCH_RELATIVE, 1 },
+    };
+
+    random_cpr_t *data = malloc(sizeof(*data) * count);
+    if (!data) {
+        fprintf(stderr, "benchmarkCPR: out of memory\n");
+        return;
+    }
+
+    fprintf(stderr, "benchmarking %u random CPR pairs per decoder\n", count);
+    for (unsigned b = 0; b < sizeof(benchmarks)/sizeof(benchmarks[0]); ++b) {
+        unsigned decoded, ref_decoded;
+        generateRandomCPR(data, count, benchmarks[b].surface);
+
+        double ref_ns = benchmarkDecoder(data, count, benchmarks[b].type, benchmarks[b].surface, 1, &ref_decoded);
+        double ns = benchmarkDecoder(data, count, benchmarks[b].type, benchmarks[b].surface, 0, &decoded);
+
+        fprintf(stderr, "  %-18s  reference %6.1f ns/decode (%5.1fM/s)  current %6.1f ns/decode (%5.1fM/s)  speedup %.2fx  (%u/%u decoded)\n",
+                benchmarks[b].name,
+                ref_ns / count, count / ref_ns * 1e3,
+                ns / count, count / ns * 1e3,
+                ref_ns / ns,
+                decoded, count);
+        if (decoded != ref_decoded)
+            fprintf(stderr, "  %-18s  warning: reference decoded %u\n", "", ref_decoded);
+    }
+
+    free(data);
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && !strcmp(argv[1], "--benchmark")) {
+        unsigned count = (argc > 2 ? strtoul(argv[2], NULL, 10) : 5000000);
+        benchmarkCPR(count);
+        return 0;
+    }
+
     int ok = 1;
     ok = testCPRGlobalAirborne() && ok;
     ok = testCPRGlobalSurface() && ok;
     ok = testCPRRelative() && ok;
+    ok = testCPRNLTable() && ok;
+    ok = testCPRRandom(1000000) && ok;
     return ok ? 0 : 1;
 }
@@ -1,6 +1,8 @@
 #include "cpu.h"
 
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
 
 #ifdef ENABLE_CPUFEATURES
 #include "cpu_features_macros.h"
@@ -46,6 +48,15 @@ int cpu_supports_avx2(void)
 #endif
 }
 
+int cpu_supports_avx512(void)
+{
+#ifdef CPU_FEATURES_ARCH_X86
+    return x86_info()->features.avx512f && x86_info()->features.avx512bw && x86_info()->features.popcnt;
+#else
+    return 0;
+#endif
+}
+
 //
 // ARM
 //
@@ -107,3 +118,74 @@ int cpu_supports_armv8_simd(void)
     return 0;
 #endif
 }
+
+int cpu_supports_armv8_sve(void)
+{
+#ifdef CPU_FEATURES_ARCH_AARCH64
+    return aarch64_info()->features.asimd && aarch64_info()->features.sve;
+#else
+    return 0;
+#endif
+}
+
+//
+// CPU model
+//
+
+const char *cpu_model(void)
+{
+    static bool valid = false;
+    static char model[256];
+
+    if (valid)
+        return model;
+
+    valid = true;
+    strcpy(model, "unknown");
+
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+    if (!fp)
+        return model;
+
+    // x86 has "model name"; ARM has some combination of "Hardware",
+    // "Model" (e.g. the Raspberry Pi model) and the CPU part numbers.
+    // Use the first instance of each of these that is present.
+    static const char *keys[] = { "model name", "Hardware", "Model", "CPU implementer", "CPU part", "CPU revision", NULL };
+    bool seen[sizeof(keys) / sizeof(keys[0])] = { false };
+    size_t used = 0;
+
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        char *colon = strchr(line, ':');
+        if (!colon)
+            continue;
+
+        char *end = colon;
+        while (end > line && (end[-1] == ' ' || end[-1] == '\t'))
+            --end;
+        *end = 0;
+
+        char *value = colon + 1;
+        while (*value == ' ' || *value == '\t')
+            ++value;
+        value[strcspn(value, "\r\n")] = 0;
+        if (!*value)
+            continue;
+
+        for (unsigned i = 0; keys[i]; ++i) {
+            if (seen[i] || strcmp(line, keys[i]))
+                continue;
+            seen[i] = true;
+
+            int n = snprintf(model + used, sizeof(model) - used, "%s%s", used ? "; " : "", value);
+            if (n > 0)
+                used += ((size_t) n < sizeof(model) - used ? (size_t) n : sizeof(model) - used - 1);
+        }
+    }
+
+    fclose(fp);
+
+    if (!used)
+        strcpy(model, "unknown");
+    return model;
+}
@@ -4,12 +4,17 @@
 // x86
 int cpu_supports_avx(void);
 int cpu_supports_avx2(void);
+int cpu_supports_avx512(void);
 
 // ARM
 int cpu_supports_armv7_neon_vfpv4(void);
 
 // AARCH64
 int cpu_supports_armv8_simd(void);
-int cpu_supports_armv8_simd_sve(void);
+int cpu_supports_armv8_sve(void);
+
+// A short description of the CPU model (e.g. from /proc/cpuinfo),
+// or "unknown" if it can't be determined
+const char *cpu_model(void);
 
 #endif
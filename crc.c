@@ -351,8 +351,196 @@ static struct errorinfo *prepareErrorTable(int bits, int max_correct, int max_de
     return table;
 }
 
+// Error tables are cached as a header followed by the sorted table, in
+// this build's struct errorinfo layout
+#define CRC_CACHE_MAGIC "dump1090-crc"
+#define CRC_CACHE_VERSION 1
+
+struct crc_cache_header {
+    char magic[16];                 // CRC_CACHE_MAGIC, NUL-padded
+    uint32_t version;               // CRC_CACHE_VERSION
+    uint32_t poly;                  // MODES_GENERATOR_POLY
+    uint32_t entry_size;            // sizeof(struct errorinfo)
+    uint32_t bits;                  // message length
+    uint32_t max_correct;           // arguments to prepareErrorTable
+    uint32_t max_detect;
+    uint32_t count;                 // number of entries that follow
+    uint32_t reserved;
+};
+
+_Static_assert(sizeof(struct crc_cache_header) == 48, "crc_cache_header layout changed");
+
+#ifndef _WIN32
+
+#include <sys/mman.h>
+
+static void fillCacheHeader(struct crc_cache_header *header, int bits, int max_correct, int max_detect, int count)
+{
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, CRC_CACHE_MAGIC, sizeof(CRC_CACHE_MAGIC));
+    header->version = CRC_CACHE_VERSION;
+    header->poly = MODES_GENERATOR_POLY;
+    header->entry_size = sizeof(struct errorinfo);
+    header->bits = bits;
+    header->max_correct = max_correct;
+    header->max_detect = max_detect;
+    header->count = count;
+}
+
+static char *cacheFile(const char *cache_dir, int bits, int max_correct, int max_detect)
+{
+    size_t len = strlen(cache_dir) + 32;
+    char *path = malloc(len);
+    if (path)
+        snprintf(path, len, "%s/crc-%d-%d-%d.v%d", cache_dir, bits, max_correct, max_detect, CRC_CACHE_VERSION);
+    return path;
+}
+
+// Check every entry of a cached table against the syndromes computed
+// here, and that the table is sorted for bsearch. This is a few thousand
+// entries, so much cheaper than rebuilding the table.
+static bool checkErrorTable(const struct errorinfo *table, int size, int bits, int max_correct)
+{
+    for (int i = 0; i < size; ++i) {
+        const struct errorinfo *ei = &table[i];
+        uint32_t syndrome = 0;
+
+        if (ei->errors < 1 || ei->errors > max_correct)
+            return false;
+        for (int j = 0; j < ei->errors; ++j) {
+            if (ei->bit[j] < 0 || ei->bit[j] >= bits || (j > 0 && ei->bit[j] <= ei->bit[j-1]))
+                return false;
+            syndrome ^= single_bit_syndrome[ei->bit[j] + 112 - bits];
+        }
+
+        if (syndrome != ei->syndrome)
+            return false;
+        if (i > 0 && syndrome_compare(&table[i-1], ei) >= 0)
+            return false;
+    }
+
+    return true;
+}
+
+// Map a table written by saveErrorTable; returns NULL if there is no
+// usable cached table
+static struct errorinfo *loadErrorTable(const char *cache_dir, int bits, int max_correct, int max_detect, int *size_out)
+{
+    if (!cache_dir)
+        return NULL;
+
+    char *path = cacheFile(cache_dir, bits, max_correct, max_detect);
+    if (!path)
+        return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT)
+            fprintf(stderr, "crc: can't open %s: %s\n", path, strerror(errno));
+        free(path);
+        return NULL;
+    }
+
+    struct stat st;
+    void *base = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t) st.st_size >= sizeof(struct crc_cache_header))
+        base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "crc: %s is unreadable or truncated, rebuilding it\n", path);
+        free(path);
+        return NULL;
+    }
+
+    const struct crc_cache_header *header = base;
+    struct crc_cache_header expected;
+    fillCacheHeader(&expected, bits, max_correct, max_detect, header->count);
+
+    struct errorinfo *table = (struct errorinfo *) (header + 1);
+    if (memcmp(header, &expected, sizeof(expected)) ||
+        (size_t) st.st_size != sizeof(*header) + (size_t) header->count * sizeof(struct errorinfo) ||
+        !checkErrorTable(table, header->count, bits, max_correct)) {
+        fprintf(stderr, "crc: %s is stale or damaged, rebuilding it\n", path);
+        munmap(base, st.st_size);
+        free(path);
+        return NULL;
+    }
+
+    // The mapping is kept for the life of the process
+    *size_out = header->count;
+    free(path);
+    return table;
+}
+
+// Write a table prepared by prepareErrorTable to the cache directory
+static void saveErrorTable(const char *cache_dir, const struct errorinfo *table, int size, int bits, int max_correct, int max_detect)
+{
+    if (!cache_dir)
+        return;
+
+    char *path = cacheFile(cache_dir, bits, max_correct, max_detect);
+    if (!path)
+        return;
+
+    size_t len = strlen(path) + 5;
+    char *tmppath = malloc(len);
+    if (!tmppath) {
+        free(path);
+        return;
+    }
+    snprintf(tmppath, len, "%s.tmp", path);
+
+    FILE *fp = fopen(tmppath, "wb");
+    if (!fp) {
+        fprintf(stderr, "crc: can't write %s: %s\n", tmppath, strerror(errno));
+        goto done;
+    }
+
+    struct crc_cache_header header;
+    fillCacheHeader(&header, bits, max_correct, max_detect, size);
+
+    bool ok = (fwrite(&header, sizeof(header), 1, fp) == 1 &&
+               (size == 0 || fwrite(table, sizeof(struct errorinfo), size, fp) == (size_t) size));
+    if (fclose(fp) != 0)
+        ok = false;
+
+    if (!ok || rename(tmppath, path) < 0) {
+        fprintf(stderr, "crc: can't write %s: %s\n", path, strerror(errno));
+        unlink(tmppath);
+    }
+
+ done:
+    free(tmppath);
+    free(path);
+}
+
+#else /* _WIN32 */
+
+static struct errorinfo *loadErrorTable(const char *cache_dir, int bits, int max_correct, int max_detect, int *size_out)
+{
+    MODES_NOTUSED(cache_dir);
+    MODES_NOTUSED(bits);
+    MODES_NOTUSED(max_correct);
+    MODES_NOTUSED(max_detect);
+    MODES_NOTUSED(size_out);
+    return NULL;
+}
+
+static void saveErrorTable(const char *cache_dir, const struct errorinfo *table, int size, int bits, int max_correct, int max_detect)
+{
+    MODES_NOTUSED(cache_dir);
+    MODES_NOTUSED(table);
+    MODES_NOTUSED(size);
+    MODES_NOTUSED(bits);
+    MODES_NOTUSED(max_correct);
+    MODES_NOTUSED(max_detect);
+}
+
+#endif /* _WIN32 */
+
 // Precompute syndrome tables for 56- and 112-bit messages.
-void modesChecksumInit(int fixBits)
+void modesChecksumInit(int fixBits, const char *cache_dir)
 {
     initLookupTables();
 
@@ -371,10 +559,21 @@ void modesChecksumInit(int fixBits)
 
     default:
         // Detect out to 4 bit errors; this reduces our 2-bit coverage to about 65%.
+        bitErrorTable_short = loadErrorTable(cache_dir, MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
+        bitErrorTable_long = loadErrorTable(cache_dir, MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
+        if (bitErrorTable_short && bitErrorTable_long)
+            break;
+
         // This can take a little while - tell the user.
         fprintf(stderr, "Preparing error correction tables.. ");
-        bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
-        bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
+        if (!bitErrorTable_short) {
+            bitErrorTable_short = prepareErrorTable(MODES_SHORT_MSG_BITS, 2, 4, &bitErrorTableSize_short);
+            saveErrorTable(cache_dir, bitErrorTable_short, bitErrorTableSize_short, MODES_SHORT_MSG_BITS, 2, 4);
+        }
+        if (!bitErrorTable_long) {
+            bitErrorTable_long = prepareErrorTable(MODES_LONG_MSG_BITS, 2, 4, &bitErrorTableSize_long);
+            saveErrorTable(cache_dir, bitErrorTable_long, bitErrorTableSize_long, MODES_LONG_MSG_BITS, 2, 4);
+        }
         fprintf(stderr, "done.\n");
         break;
     }
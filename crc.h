@@ -31,7 +31,11 @@ struct errorinfo {
     int8_t   bit[MODES_MAX_BITERRORS]; // bit positions to fix (-1 = no bit)
 };
 
-void modesChecksumInit(int fixBits);
+// Prepare the error correction tables for fixBits-bit correction. If
+// cache_dir is not NULL, the two-bit tables (which are slow to build) are
+// mapped from versioned files there if present and intact, and written
+// there after building them otherwise.
+void modesChecksumInit(int fixBits, const char *cache_dir);
 uint32_t modesChecksum(const uint8_t *msg, int bitlen);
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
 void modesChecksumFix(uint8_t *msg, struct errorinfo *info);
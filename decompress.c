@@ -0,0 +1,490 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// decompress.c: streaming decompression of compressed sample files
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <poll.h>
+
+#ifdef ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef ENABLE_LZMA
+#include <lzma.h>
+#endif
+
+static const unsigned char zstd_magic[] = { 0x28, 0xB5, 0x2F, 0xFD };
+static const unsigned char xz_magic[] = { 0xFD, '7', 'z', 'X', 'Z', 0x00 };
+
+struct decompress_buffer {
+    char *data;
+    size_t len;
+};
+
+struct decompressor {
+    int fd;
+    const char *filename;
+    compression_t type;
+    pthread_t thread;
+
+    pthread_mutex_t lock;
+    pthread_cond_t filled;          // signalled when a buffer is added to the ring, or the thread finishes
+    pthread_cond_t emptied;         // signalled when the reader frees a buffer
+
+    // the ring; buffers[head] .. buffers[head + full - 1] hold data for
+    // the reader, and buffers[tail] is being filled by the decompressor
+    struct decompress_buffer buffers[DECOMPRESS_BUFFERS];
+    unsigned head;
+    unsigned tail;
+    unsigned full;
+    size_t head_pos;                // bytes of buffers[head] already read
+    size_t fill_len;                // bytes of buffers[tail] filled so far (decompressor only)
+    bool finished;                  // decompressor thread has produced everything it will produce
+    atomic_bool stop;               // set by decompressorDestroy
+
+    // compressed input, owned by the decompressor thread
+    char *input;
+    size_t input_len;
+    char *prefix;
+    size_t prefix_len;
+    bool input_error;
+
+    // throughput accounting
+    uint64_t start_us;
+    uint64_t end_us;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint64_t reader_wait_us;        // reader waiting for decompressed data
+    uint64_t buffer_wait_us;        // decompressor waiting for a free buffer
+    uint64_t input_wait_us;         // decompressor waiting for compressed input
+    struct timespec cpu_time;       // decompressor thread CPU time
+};
+
+compression_t decompressDetect(const void *buf, size_t len)
+{
+    if (len >= sizeof(zstd_magic) && !memcmp(buf, zstd_magic, sizeof(zstd_magic)))
+        return COMPRESSION_ZSTD;
+    if (len >= sizeof(xz_magic) && !memcmp(buf, xz_magic, sizeof(xz_magic)))
+        return COMPRESSION_XZ;
+    return COMPRESSION_NONE;
+}
+
+const char *decompressName(compression_t type)
+{
+    switch (type) {
+    case COMPRESSION_ZSTD:
+        return "zstd";
+    case COMPRESSION_XZ:
+        return "xz";
+    default:
+        return "uncompressed";
+    }
+}
+
+//
+// Decompressor thread side
+//
+
+// Read the next block of compressed input into d->input. Returns false at
+// EOF, on error (input_error is set) or when asked to stop.
+static bool fillInput(struct decompressor *d)
+{
+    if (d->prefix_len) {
+        memcpy(d->input, d->prefix, d->prefix_len);
+        d->input_len = d->prefix_len;
+        d->prefix_len = 0;
+        d->bytes_in += d->input_len;
+        return true;
+    }
+
+    uint64_t start = monotonic_us();
+    ssize_t nread = -1;
+    while (!atomic_load(&d->stop)) {
+        // don't block indefinitely on a pipe, so that we can be stopped
+        struct pollfd pfd = { .fd = d->fd, .events = POLLIN };
+        int ready = poll(&pfd, 1, 100);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (ready <= 0)
+            continue;
+
+        nread = read(d->fd, d->input, DECOMPRESS_INPUT_SIZE);
+        if (nread < 0 && (errno == EINTR || errno == EAGAIN))
+            continue;
+        break;
+    }
+    d->input_wait_us += monotonic_us() - start;
+
+    if (atomic_load(&d->stop))
+        return false;
+
+    if (nread < 0) {
+        fprintf(stderr, "ifile: error reading %s: %s\n", d->filename, strerror(errno));
+        d->input_error = true;
+        return false;
+    }
+
+    d->input_len = nread;
+    d->bytes_in += nread;
+    return nread > 0;
+}
+
+// Return space to decompress into, waiting for the reader to free a buffer
+// if the ring is full. Returns NULL when asked to stop.
+static char *outputSpace(struct decompressor *d, size_t *space)
+{
+    if (d->fill_len == 0) {
+        // starting a new buffer
+        pthread_mutex_lock(&d->lock);
+        if (d->full == DECOMPRESS_BUFFERS && !atomic_load(&d->stop)) {
+            uint64_t start = monotonic_us();
+            while (d->full == DECOMPRESS_BUFFERS && !atomic_load(&d->stop))
+                pthread_cond_wait(&d->emptied, &d->lock);
+            d->buffer_wait_us += monotonic_us() - start;
+        }
+        pthread_mutex_unlock(&d->lock);
+
+        if (atomic_load(&d->stop))
+            return NULL;
+    }
+
+    *space = DECOMPRESS_BUFFER_SIZE - d->fill_len;
+    return d->buffers[d->tail].data + d->fill_len;
+}
+
+// Hand the buffer being filled to the reader
+static void publishBuffer(struct decompressor *d)
+{
+    if (!d->fill_len)
+        return;
+
+    pthread_mutex_lock(&d->lock);
+    d->buffers[d->tail].len = d->fill_len;
+    d->fill_len = 0;
+    d->tail = (d->tail + 1) % DECOMPRESS_BUFFERS;
+    ++d->full;
+    pthread_cond_signal(&d->filled);
+    pthread_mutex_unlock(&d->lock);
+}
+
+// Account for n bytes written at outputSpace(); publish the buffer once full
+static void outputDone(struct decompressor *d, size_t n)
+{
+    d->fill_len += n;
+    d->bytes_out += n;
+    if (d->fill_len == DECOMPRESS_BUFFER_SIZE)
+        publishBuffer(d);
+}
+
+#ifdef ENABLE_ZSTD
+static void decompressZstd(struct decompressor *d)
+{
+    ZSTD_DStream *zds = ZSTD_createDStream();
+    if (!zds) {
+        fprintf(stderr, "ifile: %s: out of memory\n", d->filename);
+        return;
+    }
+    ZSTD_initDStream(zds);
+
+    size_t ret = 0;
+    while (fillInput(d)) {
+        ZSTD_inBuffer in = { d->input, d->input_len, 0 };
+        bool output_full = false;
+
+        // keep going until all input is consumed and zstd has room to spare,
+        // i.e. it has flushed everything it can from this input
+        while (in.pos < in.size || output_full) {
+            size_t space;
+            char *p = outputSpace(d, &space);
+            if (!p)
+                goto done;
+
+            ZSTD_outBuffer out = { p, space, 0 };
+            ret = ZSTD_decompressStream(zds, &out, &in);
+            if (ZSTD_isError(ret)) {
+                fprintf(stderr, "ifile: %s: zstd decompression failed: %s\n", d->filename, ZSTD_getErrorName(ret));
+                goto done;
+            }
+
+            output_full = (out.pos == out.size);
+            outputDone(d, out.pos);
+        }
+    }
+
+    if (ret != 0 && !d->input_error && !atomic_load(&d->stop))
+        fprintf(stderr, "ifile: %s: compressed data is truncated\n", d->filename);
+
+ done:
+    ZSTD_freeDStream(zds);
+}
+#endif
+
+#ifdef ENABLE_LZMA
+static const char *lzmaError(lzma_ret ret)
+{
+    switch (ret) {
+    case LZMA_MEM_ERROR:
+        return "out of memory";
+    case LZMA_FORMAT_ERROR:
+        return "not in xz format";
+    case LZMA_OPTIONS_ERROR:
+        return "unsupported compression options";
+    case LZMA_DATA_ERROR:
+        return "compressed data is corrupt";
+    case LZMA_BUF_ERROR:
+        return "compressed data is truncated";
+    default:
+        return "internal error";
+    }
+}
+
+static void decompressXz(struct decompressor *d)
+{
+    lzma_stream strm = LZMA_STREAM_INIT;
+    lzma_ret ret = lzma_stream_decoder(&strm, UINT64_MAX, LZMA_CONCATENATED);
+    if (ret != LZMA_OK) {
+        fprintf(stderr, "ifile: %s: xz decompression failed: %s\n", d->filename, lzmaError(ret));
+        return;
+    }
+
+    lzma_action action = LZMA_RUN;
+    for (;;) {
+        if (strm.avail_in == 0 && action == LZMA_RUN) {
+            if (fillInput(d)) {
+                strm.next_in = (const uint8_t *) d->input;
+                strm.avail_in = d->input_len;
+            } else if (d->input_error || atomic_load(&d->stop)) {
+                break;
+            } else {
+                action = LZMA_FINISH;
+            }
+        }
+
+        size_t space;
+        char *p = outputSpace(d, &space);
+        if (!p)
+            break;
+
+        strm.next_out = (uint8_t *) p;
+        strm.avail_out = space;
+        ret = lzma_code(&strm, action);
+        outputDone(d, space - strm.avail_out);
+
+        if (ret == LZMA_STREAM_END)
+            break;
+        if (ret != LZMA_OK) {
+            fprintf(stderr, "ifile: %s: xz decompression failed: %s\n", d->filename, lzmaError(ret));
+            break;
+        }
+    }
+
+    lzma_end(&strm);
+}
+#endif
+
+static void *decompressThreadEntryPoint(void *arg)
+{
+    struct decompressor *d = arg;
+    struct timespec cpu_start;
+
+    set_thread_name("dump1090-unzip");
+    start_cpu_timing(&cpu_start);
+
+    switch (d->type) {
+#ifdef ENABLE_ZSTD
+    case COMPRESSION_ZSTD:
+        decompressZstd(d);
+        break;
+#endif
+#ifdef ENABLE_LZMA
+    case COMPRESSION_XZ:
+        decompressXz(d);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    publishBuffer(d);
+    end_cpu_timing(&cpu_start, &d->cpu_time);
+
+    pthread_mutex_lock(&d->lock);
+    d->finished = true;
+    d->end_us = monotonic_us();
+    pthread_cond_broadcast(&d->filled);
+    pthread_mutex_unlock(&d->lock);
+    return NULL;
+}
+
+//
+// Reader side
+//
+
+static void freeDecompressor(struct decompressor *d)
+{
+    for (unsigned i = 0; i < DECOMPRESS_BUFFERS; ++i)
+        free(d->buffers[i].data);
+    free(d->input);
+    free(d->prefix);
+    free(d);
+}
+
+struct decompressor *decompressorStart(int fd, const char *filename, compression_t type,
+                                       const void *prefix, size_t prefix_len)
+{
+    bool supported = false;
+#ifdef ENABLE_ZSTD
+    if (type == COMPRESSION_ZSTD)
+        supported = true;
+#endif
+#ifdef ENABLE_LZMA
+    if (type == COMPRESSION_XZ)
+        supported = true;
+#endif
+    if (!supported) {
+        fprintf(stderr, "ifile: %s is %s-compressed, but this build has no %s support\n",
+                filename, decompressName(type), decompressName(type));
+        return NULL;
+    }
+
+    struct decompressor *d = calloc(1, sizeof(*d));
+    if (!d) {
+        fprintf(stderr, "ifile: %s: out of memory\n", filename);
+        return NULL;
+    }
+
+    d->fd = fd;
+    d->filename = filename;
+    d->type = type;
+    atomic_init(&d->stop, false);
+
+    bool ok = (d->input = malloc(DECOMPRESS_INPUT_SIZE)) != NULL;
+    for (unsigned i = 0; ok && i < DECOMPRESS_BUFFERS; ++i)
+        ok = (d->buffers[i].data = malloc(DECOMPRESS_BUFFER_SIZE)) != NULL;
+    if (ok && prefix_len) {
+        ok = (d->prefix = malloc(prefix_len)) != NULL;
+        if (ok) {
+            memcpy(d->prefix, prefix, prefix_len);
+            d->prefix_len = prefix_len;
+        }
+    }
+    if (!ok) {
+        fprintf(stderr, "ifile: %s: out of memory\n", filename);
+        freeDecompressor(d);
+        return NULL;
+    }
+
+    pthread_mutex_init(&d->lock, NULL);
+    pthread_cond_init(&d->filled, NULL);
+    pthread_cond_init(&d->emptied, NULL);
+
+    d->start_us = monotonic_us();
+    int err = pthread_create(&d->thread, NULL, decompressThreadEntryPoint, d);
+    if (err) {
+        fprintf(stderr, "ifile: can't start decompression thread for %s: %s\n", filename, strerror(err));
+        pthread_cond_destroy(&d->emptied);
+        pthread_cond_destroy(&d->filled);
+        pthread_mutex_destroy(&d->lock);
+        freeDecompressor(d);
+        return NULL;
+    }
+
+    return d;
+}
+
+size_t decompressorRead(struct decompressor *d, void *buf, size_t len)
+{
+    char *out = buf;
+    size_t copied = 0;
+
+    pthread_mutex_lock(&d->lock);
+    while (copied < len) {
+        if (!d->full) {
+            if (d->finished || Modes.exit)
+                break;
+
+            // wake up periodically to notice Modes.exit, as a blocking
+            // read() on an uncompressed input would be interrupted
+            struct timespec deadline;
+            get_deadline(100, &deadline);
+            uint64_t start = monotonic_us();
+            pthread_cond_timedwait(&d->filled, &d->lock, &deadline);
+            d->reader_wait_us += monotonic_us() - start;
+            continue;
+        }
+
+        // The decompressor doesn't touch a buffer that is in the ring, so
+        // copy out of it without holding the lock
+        struct decompress_buffer *b = &d->buffers[d->head];
+        size_t n = b->len - d->head_pos;
+        if (n > len - copied)
+            n = len - copied;
+
+        pthread_mutex_unlock(&d->lock);
+        memcpy(out + copied, b->data + d->head_pos, n);
+        pthread_mutex_lock(&d->lock);
+
+        copied += n;
+        d->head_pos += n;
+        if (d->head_pos == b->len) {
+            d->head_pos = 0;
+            d->head = (d->head + 1) % DECOMPRESS_BUFFERS;
+            --d->full;
+            pthread_cond_signal(&d->emptied);
+        }
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    return copied;
+}
+
+void decompressorDestroy(struct decompressor *d)
+{
+    if (!d)
+        return;
+
+    pthread_mutex_lock(&d->lock);
+    atomic_store(&d->stop, true);
+    pthread_cond_broadcast(&d->emptied);
+    pthread_mutex_unlock(&d->lock);
+    pthread_join(d->thread, NULL);
+
+    double elapsed = (d->end_us - d->start_us) / 1e6;
+    double cpu = d->cpu_time.tv_sec + d->cpu_time.tv_nsec / 1e9;
+    double reader_wait = d->reader_wait_us / 1e6;
+    double buffer_wait = d->buffer_wait_us / 1e6;
+    double input_wait = d->input_wait_us / 1e6;
+
+    const char *bottleneck;
+    if (reader_wait > buffer_wait)
+        bottleneck = (input_wait > cpu ? "reading the compressed file is" : "decompression is");
+    else
+        bottleneck = "conversion and demodulation are";
+
+    fprintf(stderr, "ifile: %s: %s, %.1f MB decompressed to %.1f MB in %.1f seconds (%.1f MB/s, decompressor busy %.0f%%)\n",
+            d->filename, decompressName(d->type), d->bytes_in / 1e6, d->bytes_out / 1e6, elapsed,
+            elapsed > 0 ? d->bytes_out / 1e6 / elapsed : 0.0,
+            elapsed > 0 ? 100.0 * cpu / elapsed : 0.0);
+    fprintf(stderr, "ifile: %s: reader waited %.1fs for data, decompressor waited %.1fs for free buffers and %.1fs for input: %s the bottleneck\n",
+            d->filename, reader_wait, buffer_wait, input_wait, bottleneck);
+
+    pthread_cond_destroy(&d->emptied);
+    pthread_cond_destroy(&d->filled);
+    pthread_mutex_destroy(&d->lock);
+    freeDecompressor(d);
+}
@@ -0,0 +1,66 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// decompress.h: streaming decompression of compressed sample files (header)
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_DECOMPRESS_H
+#define DUMP1090_DECOMPRESS_H
+
+// sdr_ifile reads zstd- and xz-compressed captures (raw samples or burst
+// captures) directly. The compressed file is decoded on its own thread into
+// a ring of DECOMPRESS_BUFFERS buffers, and the ifile reader thread copies
+// decoded bytes out of the ring as it needs them; neither side blocks the
+// other until the ring is empty or full.
+//
+// Each side records how long it spent waiting on the other. When the
+// decompressor is destroyed it prints those times: if the reader mostly
+// waited for data, decompression (or reading the compressed file) limits
+// the decode rate; if the decompressor mostly waited for free buffers,
+// conversion and demodulation do.
+//
+// Support for each format is compiled in with ENABLE_ZSTD / ENABLE_LZMA.
+
+#define DECOMPRESS_BUFFERS 8
+#define DECOMPRESS_BUFFER_SIZE (1024 * 1024)    // decompressed bytes per ring buffer
+#define DECOMPRESS_INPUT_SIZE (256 * 1024)      // compressed bytes per read()
+
+typedef enum { COMPRESSION_NONE = 0, COMPRESSION_ZSTD, COMPRESSION_XZ } compression_t;
+
+struct decompressor;
+
+// Identify the compression format from the first len bytes of a file
+compression_t decompressDetect(const void *buf, size_t len);
+
+// Human-readable name of a compression format
+const char *decompressName(compression_t type);
+
+// Start decompressing fd on a new thread. `prefix` holds bytes that were
+// already read from fd (while detecting the format) and are decoded first.
+// Returns NULL, with a message on stderr, if this build can't decode the
+// format or the thread can't be started.
+struct decompressor *decompressorStart(int fd, const char *filename, compression_t type,
+                                       const void *prefix, size_t prefix_len);
+
+// Copy up to len decompressed bytes to buf, waiting for the decompressor
+// if needed. Returns fewer than len bytes only at the end of the data,
+// after an error (which has been reported on stderr), or once Modes.exit
+// is set.
+size_t decompressorRead(struct decompressor *d, void *buf, size_t len);
+
+// Stop the decompressor thread, print the throughput report and free
+// everything. Does not close fd.
+void decompressorDestroy(struct decompressor *d);
+
+#endif
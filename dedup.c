@@ -0,0 +1,151 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// dedup.c: duplicate suppression for aggregated network input
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+struct dedup_entry {
+    uint64_t time;          // arrival time of the first copy, milliseconds
+    uint32_t addr;          // aircraft updated by the first copy, or 0
+    long messages;          // that aircraft's message count after the update
+    double signal;          // strongest signal level seen so far
+    double used;            // signal level the aircraft was updated with
+    unsigned char len;
+    unsigned char msg[MODES_LONG_MSG_BYTES];
+};
+
+#define INDEX_SIZE (DEDUP_ENTRIES * 2)
+
+static struct dedup_entry *ring;
+static uint32_t *slots;         // ring sequence numbers; never cleared
+static uint32_t next_seq;       // sequence number of the next ring entry
+static struct dedup_entry *last;
+
+bool dedupInit(void)
+{
+    if (!Modes.net_dedup_window)
+        return true;
+
+    ring = calloc(DEDUP_ENTRIES, sizeof(*ring));
+    slots = calloc(INDEX_SIZE, sizeof(*slots));
+    if (!ring || !slots) {
+        fprintf(stderr, "--net-dedup: out of memory\n");
+        dedupCleanup();
+        return false;
+    }
+
+    // liveEntry treats seq as live while next_seq - seq <= DEDUP_ENTRIES;
+    // starting one above that keeps zeroed (seq 0) slots dead
+    next_seq = DEDUP_ENTRIES + 1;
+    return true;
+}
+
+void dedupCleanup(void)
+{
+    free(ring);
+    free(slots);
+    ring = NULL;
+    slots = NULL;
+    last = NULL;
+}
+
+static uint32_t hashMessage(const unsigned char *msg, int len)
+{
+    // FNV-1a; the trailing parity bytes are already well mixed
+    uint32_t h = 2166136261U;
+    for (int i = 0; i < len; ++i) {
+        h ^= msg[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+// The ring entry for an index slot, if it is still within the window
+static struct dedup_entry *liveEntry(uint32_t seq, uint64_t now)
+{
+    if ((uint32_t) (next_seq - seq - 1) >= DEDUP_ENTRIES)
+        return NULL;   // overwritten since, or never used
+
+    struct dedup_entry *e = &ring[seq & (DEDUP_ENTRIES - 1)];
+    if (now >= e->time + Modes.net_dedup_window)
+        return NULL;
+    return e;
+}
+
+bool dedupCheck(const unsigned char *msg, int len, uint64_t now, double signal)
+{
+    last = NULL;
+    if (!ring)
+        return false;
+
+    uint32_t h = hashMessage(msg, len);
+    uint32_t *slot = NULL;
+    uint32_t oldest = 0;
+
+    for (unsigned i = 0; i < DEDUP_PROBE; ++i) {
+        uint32_t *s = &slots[(h + i) & (INDEX_SIZE - 1)];
+        struct dedup_entry *e = liveEntry(*s, now);
+
+        if (!e) {
+            if (!slot || oldest != UINT32_MAX) {
+                // prefer a dead slot over evicting a live one
+                slot = s;
+                oldest = UINT32_MAX;
+            }
+            continue;
+        }
+
+        if (e->len == len && !memcmp(e->msg, msg, len)) {
+            if (!Modes.net_dedup_observe && signal > e->signal) {
+                e->signal = signal;
+                if (e->addr && trackMergeDuplicateSignal(e->addr, e->messages, e->used, signal))
+                    e->used = signal;
+            }
+            return true;
+        }
+
+        uint32_t age = next_seq - *s;
+        if (!slot || (oldest != UINT32_MAX && age > oldest)) {
+            slot = s;
+            oldest = age;
+        }
+    }
+
+    uint32_t seq = next_seq++;
+    if (next_seq == 0)
+        next_seq = DEDUP_ENTRIES + 1;   // keep seq 0 slots dead after wrapping
+
+    last = &ring[seq & (DEDUP_ENTRIES - 1)];
+    last->time = now;
+    last->addr = 0;
+    last->messages = 0;
+    last->signal = signal;
+    last->used = signal;
+    last->len = len;
+    memcpy(last->msg, msg, len);
+
+    *slot = seq;
+    return false;
+}
+
+void dedupSetAircraft(const struct aircraft *a)
+{
+    if (!last || !a)
+        return;
+
+    last->addr = a->addr;
+    last->messages = a->messages;
+}
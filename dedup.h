@@ -0,0 +1,59 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// dedup.h: duplicate suppression for aggregated network input
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_DEDUP_H
+#define DUMP1090_DEDUP_H
+
+// When several receivers with overlapping coverage feed the same dump1090
+// (--net-bi-port / --net-ri-port), most transmissions arrive once per
+// receiver. With --net-dedup <ms>, a Mode S message whose bytes are identical
+// to one received less than <ms> milliseconds earlier, on any Beast or raw
+// input, is dropped before it is decoded. If the duplicate was received with
+// a stronger signal, that signal level replaces the one recorded for the
+// copy that was used.
+//
+// Recently seen messages are kept in a ring in arrival order, indexed by a
+// small open-addressed hash table. Index slots are never deleted: a slot is
+// only trusted while the ring entry it refers to is still within the window,
+// so old entries age out as the ring wraps. If messages arrive faster than
+// DEDUP_ENTRIES per window, the oldest ones are forgotten early and some
+// duplicates are let through.
+//
+// With --net-dedup-observe, duplicates are counted but not dropped.
+//
+// Mode A/C messages and messages from a shared memory ring are not checked.
+
+#define DEDUP_ENTRIES 65536     // ring size, power of two
+#define DEDUP_PROBE 8           // index slots searched per lookup
+
+struct aircraft;
+
+// Allocate the tables if --net-dedup was given. Returns false, with a message
+// on stderr, on failure.
+bool dedupInit(void);
+void dedupCleanup(void);
+
+// Check a Mode S message received from a network input at time 'now'
+// (milliseconds) with the given signal level. Returns true if it duplicates a
+// message seen within the window; otherwise remembers it and returns false.
+bool dedupCheck(const unsigned char *msg, int len, uint64_t now, double signal);
+
+// Record the aircraft that was updated by the message most recently passed to
+// dedupCheck, so that a stronger duplicate can update its signal level.
+void dedupSetAircraft(const struct aircraft *a);
+
+#endif
@@ -18,6 +18,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "dump1090.h"
+#include "dsp/helpers/preamble_bitmap.h"
 
 #include <assert.h>
 
@@ -103,7 +104,12 @@ void demodulate2400(struct mag_buf *mag)
     unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
     uint32_t j;
 
-    static unsigned last_message_end = 0;
+    // where the last message ended, relative to the start of the next buffer, for each input
+    static unsigned last_message_end_by_input[MODES_MAX_INPUTS];
+    unsigned last_message_end = last_message_end_by_input[mag->input];
+
+    // adaptive gain only controls the primary input
+    bool adaptive = (mag->input == 0);
 
     // initialize bitsets on first call
     if (!valid_df_short_bitset)
@@ -131,7 +137,23 @@ void demodulate2400(struct mag_buf *mag)
     if (last_message_end > mlen)
         last_message_end = mlen;
 
+    // If the reader thread built a preamble bitmap for the new sample data
+    // (starting at m[overlap]), use it to skip directly to the next
+    // candidate rather than testing every sample here
+    const uint64_t *bitmap = NULL;
+    uint32_t bitmap_start = mlen;
+    if ((mag->flags & MAGBUF_PREAMBLE_BITMAP) && mag->overlap < mlen) {
+        bitmap = mag->preamble_bitmap;
+        bitmap_start = mag->overlap;
+    }
+
     for (j = last_message_end; j < mlen; j++) {
+        if (j >= bitmap_start) {
+            j = bitmap_start + preamble_bitmap_next(bitmap, j - bitmap_start, mlen - bitmap_start);
+            if (j >= mlen)
+                break;
+        }
+
         uint16_t *preamble = &m[j];
         int high;
         uint32_t base_signal, base_noise;
@@ -152,7 +174,8 @@ void demodulate2400(struct mag_buf *mag)
         //
 
         // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
+        // (already done, as part of the bitmap test, for samples covered by the bitmap)
+        if (j < bitmap_start && ! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
            continue;
 
         if (preamble[1] > preamble[2] &&                                       // 1
@@ -369,6 +392,7 @@ void demodulate2400(struct mag_buf *mag)
         mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
 
         mm.score = bestscore;
+        mm.input = mag->input;
 
         // Decode the received message
         if (decodeModesMessage(&mm, bestmsg) < 0) {
@@ -376,8 +400,13 @@ void demodulate2400(struct mag_buf *mag)
             continue;
         } else {
             Modes.stats_current.demod_accepted[mm.correctedbits]++;
+            Modes.stats_current.input_messages[mag->input]++;
         }
 
+        mm.dequeueTime = mag->dequeueTime;
+        mm.decodeTime = monotonic_us();
+        stats_add_latency(&Modes.stats_current, LATENCY_DEMOD, mm.decodeTime - mm.dequeueTime);
+
         // measure signal power
         {
             double signal_power;
@@ -403,12 +432,13 @@ void demodulate2400(struct mag_buf *mag)
         }
 
         // Feed "empty" sample to adaptive gain logic
-        if (j > last_message_end)
+        if (adaptive && j > last_message_end)
             adaptive_update(&m[last_message_end], j - last_message_end, NULL);
 
         // Feed message samples to adaptive gain logic, update end pointer
         last_message_end = j + (msglen + 8) * 12/5;
-        adaptive_update(&m[j], last_message_end - j, &mm);
+        if (adaptive)
+            adaptive_update(&m[j], last_message_end - j, &mm);
 
         // Skip over the message:
         // (we actually skip to 8 bits before the end of the message,
@@ -433,7 +463,8 @@ void demodulate2400(struct mag_buf *mag)
     if (last_message_end < mlen) {
         // trailing data from end of last message to start of overlap;
         // on the next pass, start from the start of the overlap
-        adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
+        if (adaptive)
+            adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
         last_message_end = 0;
     } else {
         // last decoded message runs into the overlap region;
@@ -441,6 +472,8 @@ void demodulate2400(struct mag_buf *mag)
         // no trailing data to pass this time
         last_message_end -= mlen;
     }
+
+    last_message_end_by_input[mag->input] = last_message_end;
 }
 
 #ifdef MODEAC_DEBUG
@@ -536,191 +569,220 @@ static void draw_modeac(uint16_t *m, unsigned modeac, unsigned f1_clock, unsigne
 //
 // one 2.4MHz sample = 25 cycles
 
+// Number of F1 offsets scanned per call to starch_modeac_scan_u16
+#define MODEAC_SCAN_BLOCK_SIZE 4096
+
 void demodulate2400AC(struct mag_buf *mag)
 {
     struct modesMessage mm;
     uint16_t *m = mag->data;
     uint32_t mlen = mag->validLength - mag->overlap;
     unsigned f1_sample;
+    unsigned next_f1_sample = 1;
 
     memset(&mm, 0, sizeof(mm));
+    mm.input = mag->input;
 
     double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
     unsigned noise_level = (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
 
-    for (f1_sample = 1; f1_sample < mlen; ++f1_sample) {
-        // Mode A/C messages should match this bit sequence:
-
-        // bit #     value
-        //   -1       0    quiet zone
-        //    0       1    framing pulse (F1)
-        //    1      C1
-        //    2      A1
-        //    3      C2
-        //    4      A2
-        //    5      C4
-        //    6      A4
-        //    7       0    quiet zone (X1)
-        //    8      B1
-        //    9      D1
-        //   10      B2
-        //   11      D2
-        //   12      B4
-        //   13      D4
-        //   14       1    framing pulse (F2)
-        //   15       0    quiet zone (X2)
-        //   16       0    quiet zone (X3)
-        //   17     SPI
-        //   18       0    quiet zone (X4)
-        //   19       0    quiet zone (X5)
-
-        // Look for a F1 and F2 pair,
-        // with F1 starting at offset f1_sample.
-
-        // the first framing pulse covers 3.5 samples:
-        //
-        // |----|        |----|
-        // | F1 |________| C1 |_
-        //
-        // | 0 | 1 | 2 | 3 | 4 |
-        //
-        // and there is some unknown phase offset of the
-        // leading edge e.g.:
-        //
-        //   |----|        |----|
-        // __| F1 |________| C1 |_
-        //
-        // | 0 | 1 | 2 | 3 | 4 |
-        //
-        // in theory the "on" period can straddle 3 samples
-        // but it's not a big deal as at most 4% of the power
-        // is in the third sample.
-
-        if (!(m[f1_sample-1] < m[f1_sample+0]))
-            continue;      // not a rising edge
-
-        if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
-            continue;      // quiet part of bit wasn't sufficiently quiet
-
-        unsigned f1_level = (m[f1_sample+0] + m[f1_sample+1]) / 2;
-
-        if (noise_level * 2 > f1_level) {
-            // require 6dB above noise
-            continue;
-        }
-
-        // estimate initial clock phase based on the amount of power
-        // that ended up in the second sample
-
-        float f1a_power = (float)m[f1_sample] * m[f1_sample];
-        float f1b_power = (float)m[f1_sample+1] * m[f1_sample+1];
-        float fraction = f1b_power / (f1a_power + f1b_power);
-        unsigned f1_clock = (unsigned) (25 * (f1_sample + fraction * fraction) + 0.5);
-
-        // same again for F2
-        // F2 is 20.3us / 14 bit periods after F1
-        unsigned f2_clock = f1_clock + (87 * 14);
-        unsigned f2_sample = f2_clock / 25;
-        assert(f2_sample < mlen + mag->overlap);
+    // maximum lookahead used by the scan and by the bit decoding below
+    assert(mag->overlap >= 20*87/25 + 3);
+
+    // The framing pulse checks below are done in bulk by the
+    // modeac_scan_u16 starch kernel, a block at a time, and only the
+    // offsets it returns are examined further.
+    static unsigned candidates[MODEAC_SCAN_BLOCK_SIZE];
+
+    for (unsigned base = 0; base + 1 < mlen; base += MODEAC_SCAN_BLOCK_SIZE) {
+        unsigned scan_len = mlen - 1 - base;
+        if (scan_len > MODEAC_SCAN_BLOCK_SIZE)
+            scan_len = MODEAC_SCAN_BLOCK_SIZE;
+
+        // require 6dB above noise for both framing pulses:
+        // (m[n] + m[n+1]) / 2 >= noise_level * 2
+        unsigned num_candidates;
+        if (STARCH_IS_ALIGNED(&m[base]))
+            starch_modeac_scan_u16_aligned(&m[base], scan_len, noise_level * 4, candidates, &num_candidates);
+        else
+            starch_modeac_scan_u16(&m[base], scan_len, noise_level * 4, candidates, &num_candidates);
+
+        for (unsigned c = 0; c < num_candidates; ++c) {
+            f1_sample = base + candidates[c];
+            if (f1_sample < next_f1_sample)
+                continue;  // overlaps a message we already decoded
+
+            // Mode A/C messages should match this bit sequence:
+
+            // bit #     value
+            //   -1       0    quiet zone
+            //    0       1    framing pulse (F1)
+            //    1      C1
+            //    2      A1
+            //    3      C2
+            //    4      A2
+            //    5      C4
+            //    6      A4
+            //    7       0    quiet zone (X1)
+            //    8      B1
+            //    9      D1
+            //   10      B2
+            //   11      D2
+            //   12      B4
+            //   13      D4
+            //   14       1    framing pulse (F2)
+            //   15       0    quiet zone (X2)
+            //   16       0    quiet zone (X3)
+            //   17     SPI
+            //   18       0    quiet zone (X4)
+            //   19       0    quiet zone (X5)
+
+            // Look for a F1 and F2 pair,
+            // with F1 starting at offset f1_sample.
+
+            // the first framing pulse covers 3.5 samples:
+            //
+            // |----|        |----|
+            // | F1 |________| C1 |_
+            //
+            // | 0 | 1 | 2 | 3 | 4 |
+            //
+            // and there is some unknown phase offset of the
+            // leading edge e.g.:
+            //
+            //   |----|        |----|
+            // __| F1 |________| C1 |_
+            //
+            // | 0 | 1 | 2 | 3 | 4 |
+            //
+            // in theory the "on" period can straddle 3 samples
+            // but it's not a big deal as at most 4% of the power
+            // is in the third sample.
+
+            // The scan has already checked that there is a rising edge at
+            // f1_sample, that the quiet part of the bit is sufficiently quiet,
+            // and that the pulse is 6dB above noise.
+
+            unsigned f1_level = (m[f1_sample+0] + m[f1_sample+1]) / 2;
+
+            // estimate initial clock phase based on the amount of power
+            // that ended up in the second sample
+
+            float f1a_power = (float)m[f1_sample] * m[f1_sample];
+            float f1b_power = (float)m[f1_sample+1] * m[f1_sample+1];
+            float fraction = f1b_power / (f1a_power + f1b_power);
+            unsigned f1_clock = (unsigned) (25 * (f1_sample + fraction * fraction) + 0.5);
+
+            // same again for F2
+            // F2 is 20.3us / 14 bit periods after F1
+            unsigned f2_clock = f1_clock + (87 * 14);
+            unsigned f2_sample = f2_clock / 25;
+            assert(f2_sample < mlen + mag->overlap);
+
+            if (!(m[f2_sample-1] < m[f2_sample+0]))
+                continue;
 
-        if (!(m[f2_sample-1] < m[f2_sample+0]))
-            continue;
+            if (m[f2_sample+2] > m[f2_sample+0] || m[f2_sample+2] > m[f2_sample+1])
+                continue;      // quiet part of bit wasn't sufficiently quiet
 
-        if (m[f2_sample+2] > m[f2_sample+0] || m[f2_sample+2] > m[f2_sample+1])
-            continue;      // quiet part of bit wasn't sufficiently quiet
+            unsigned f2_level = (m[f2_sample+0] + m[f2_sample+1]) / 2;
 
-        unsigned f2_level = (m[f2_sample+0] + m[f2_sample+1]) / 2;
+            if (noise_level * 2 > f2_level) {
+                // require 6dB above noise
+                continue;
+            }
 
-        if (noise_level * 2 > f2_level) {
-            // require 6dB above noise
-            continue;
-        }
+            unsigned f1f2_level = (f1_level > f2_level ? f1_level : f2_level);
 
-        unsigned f1f2_level = (f1_level > f2_level ? f1_level : f2_level);
+            float midpoint = sqrtf(noise_level * f1f2_level); // geometric mean of the two levels
+            unsigned signal_threshold = (unsigned) (midpoint * M_SQRT2 + 0.5); // +3dB
+            unsigned noise_threshold = (unsigned) (midpoint / M_SQRT2 + 0.5);  // -3dB
 
-        float midpoint = sqrtf(noise_level * f1f2_level); // geometric mean of the two levels
-        unsigned signal_threshold = (unsigned) (midpoint * M_SQRT2 + 0.5); // +3dB
-        unsigned noise_threshold = (unsigned) (midpoint / M_SQRT2 + 0.5);  // -3dB
+            // Looks like a real signal. Demodulate all the bits.
+            unsigned uncertain_bits = 0;
+            unsigned noisy_bits = 0;
+            unsigned bits = 0;
+            unsigned bit;
+            unsigned clock;
+            for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
+                unsigned sample = clock / 25;
 
-        // Looks like a real signal. Demodulate all the bits.
-        unsigned uncertain_bits = 0;
-        unsigned noisy_bits = 0;
-        unsigned bits = 0;
-        unsigned bit;
-        unsigned clock;
-        for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
-            unsigned sample = clock / 25;
+                bits <<= 1;
+                noisy_bits <<= 1;
+                uncertain_bits <<= 1;
 
-            bits <<= 1;
-            noisy_bits <<= 1;
-            uncertain_bits <<= 1;
+                // check for excessive noise in the quiet period
+                if (m[sample+2] >= signal_threshold) {
+                    noisy_bits |= 1;
+                }
 
-            // check for excessive noise in the quiet period
-            if (m[sample+2] >= signal_threshold) {
-                noisy_bits |= 1;
+                // decide if this bit is on or off
+                if (m[sample+0] >= signal_threshold || m[sample+1] >= signal_threshold) {
+                    bits |= 1;
+                } else if (m[sample+0] > noise_threshold && m[sample+1] > noise_threshold) {
+                    /* not certain about this bit */
+                    uncertain_bits |= 1;
+                } else {
+                    /* this bit is off */
+                }
             }
 
-            // decide if this bit is on or off
-            if (m[sample+0] >= signal_threshold || m[sample+1] >= signal_threshold) {
-                bits |= 1;
-            } else if (m[sample+0] > noise_threshold && m[sample+1] > noise_threshold) {
-                /* not certain about this bit */
-                uncertain_bits |= 1;
-            } else {
-                /* this bit is off */
+            // framing bits must be on
+            if ((bits & 0x80020) != 0x80020) {
+                continue;
             }
-        }
 
-        // framing bits must be on
-        if ((bits & 0x80020) != 0x80020) {
-            continue;
-        }
-
-        // quiet bits must be off
-        if ((bits & 0x0101B) != 0) {
-            continue;
-        }
+            // quiet bits must be off
+            if ((bits & 0x0101B) != 0) {
+                continue;
+            }
 
-        if (noisy_bits || uncertain_bits) {
-            continue;
-        }
+            if (noisy_bits || uncertain_bits) {
+                continue;
+            }
 
-        // Convert to the form that we use elsewhere:
-        //  00 A4 A2 A1  00 B4 B2 B1  SPI C4 C2 C1  00 D4 D2 D1
-        unsigned modeac =
-            ((bits & 0x40000) ? 0x0010 : 0) |  // C1
-            ((bits & 0x20000) ? 0x1000 : 0) |  // A1
-            ((bits & 0x10000) ? 0x0020 : 0) |  // C2
-            ((bits & 0x08000) ? 0x2000 : 0) |  // A2
-            ((bits & 0x04000) ? 0x0040 : 0) |  // C4
-            ((bits & 0x02000) ? 0x4000 : 0) |  // A4
-            ((bits & 0x00800) ? 0x0100 : 0) |  // B1
-            ((bits & 0x00400) ? 0x0001 : 0) |  // D1
-            ((bits & 0x00200) ? 0x0200 : 0) |  // B2
-            ((bits & 0x00100) ? 0x0002 : 0) |  // D2
-            ((bits & 0x00080) ? 0x0400 : 0) |  // B4
-            ((bits & 0x00040) ? 0x0004 : 0) |  // D4
-            ((bits & 0x00004) ? 0x0080 : 0);   // SPI
+            // Convert to the form that we use elsewhere:
+            //  00 A4 A2 A1  00 B4 B2 B1  SPI C4 C2 C1  00 D4 D2 D1
+            unsigned modeac =
+                ((bits & 0x40000) ? 0x0010 : 0) |  // C1
+                ((bits & 0x20000) ? 0x1000 : 0) |  // A1
+                ((bits & 0x10000) ? 0x0020 : 0) |  // C2
+                ((bits & 0x08000) ? 0x2000 : 0) |  // A2
+                ((bits & 0x04000) ? 0x0040 : 0) |  // C4
+                ((bits & 0x02000) ? 0x4000 : 0) |  // A4
+                ((bits & 0x00800) ? 0x0100 : 0) |  // B1
+                ((bits & 0x00400) ? 0x0001 : 0) |  // D1
+                ((bits & 0x00200) ? 0x0200 : 0) |  // B2
+                ((bits & 0x00100) ? 0x0002 : 0) |  // D2
+                ((bits & 0x00080) ? 0x0400 : 0) |  // B4
+                ((bits & 0x00040) ? 0x0004 : 0) |  // D4
+                ((bits & 0x00004) ? 0x0080 : 0);   // SPI
 
 #ifdef MODEAC_DEBUG
-        draw_modeac(m, modeac, f1_clock, noise_threshold, signal_threshold, bits, noisy_bits, uncertain_bits);
+            draw_modeac(m, modeac, f1_clock, noise_threshold, signal_threshold, bits, noisy_bits, uncertain_bits);
 #endif
 
-        // This message looks good, submit it
+            // This message looks good, submit it
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the second framing pulse (F2)
-        mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
+            // For consistency with how the Beast / Radarcape does it,
+            // we report the timestamp at the second framing pulse (F2)
+            mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+            // compute message receive time as block-start-time + difference in the 12MHz clock
+            mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
 
-        decodeModeAMessage(&mm, modeac);
+            decodeModeAMessage(&mm, modeac);
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+            mm.dequeueTime = mag->dequeueTime;
+            mm.decodeTime = monotonic_us();
+            stats_add_latency(&Modes.stats_current, LATENCY_DEMOD, mm.decodeTime - mm.dequeueTime);
+
+            // Pass data to the next layer
+            useModesMessage(&mm);
 
-        f1_sample += (20*87 / 25);
-        Modes.stats_current.demod_modeac++;
+            next_f1_sample = f1_sample + (20*87 / 25) + 1;
+            Modes.stats_current.demod_modeac++;
+            Modes.stats_current.input_messages[mag->input]++;
+        }
     }
 }
@@ -18,4 +18,31 @@ typedef struct {
     int16_t Q;
 } __attribute__((__packed__, __aligned__(2))) sc16_t;
 
+// State of the DC-blocking filter used by the magnitude_dc_* functions,
+// carried from one buffer to the next. The DC estimate is in raw input
+// units (e.g. 0..255 for UC8).
+typedef struct {
+    float dc_I;
+    float dc_Q;
+    float rate;        // 2 * pi * cutoff frequency / sample rate
+} dc_filter_t;
+
+// Polyphase resampling filter used by resample_u16 to reduce the sample rate
+// by a factor of down/up. Output samples are produced in groups of `up`;
+// group g reads input from g * down onwards, and output p of the group is
+// sum(in[g * down + offsets[p] + j] * weights[p * RESAMPLER_MAX_TAPS + j])
+// over j < taps, in Q16. See dsp/helpers/resampler.h.
+
+#define RESAMPLER_MAX_UP 32
+#define RESAMPLER_MAX_TAPS 16
+
+typedef struct {
+    unsigned up;
+    unsigned down;
+    unsigned taps;
+    unsigned span;     // input samples read by one group (max offsets[p], plus taps)
+    unsigned offsets[RESAMPLER_MAX_UP];
+    uint32_t weights[RESAMPLER_MAX_UP * RESAMPLER_MAX_TAPS];
+} resampler_t;
+
 #endif
@@ -0,0 +1,45 @@
+#include <stdlib.h>
+
+void STARCH_BENCHMARK(block_max_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint16_t *out_max = NULL;
+    const unsigned len = 65536;
+    const unsigned block = 64;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(out_max = STARCH_BENCHMARK_ALLOC(len / block, uint16_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand() % 65536;
+    }
+
+    STARCH_BENCHMARK_RUN( block_max_u16, in, len, block, out_max );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_max);
+}
+
+bool STARCH_BENCHMARK_VERIFY(block_max_u16) (const uint16_t *in, unsigned len, unsigned block, uint16_t *out_max)
+{
+    bool okay = true;
+
+    for (unsigned b = 0; b * block < len; ++b) {
+        uint16_t expected = 0;
+        for (unsigned i = b * block; i < (b + 1) * block && i < len; ++i) {
+            if (in[i] > expected)
+                expected = in[i];
+        }
+
+        if (out_max[b] != expected) {
+            if (okay)
+                fprintf(stderr, "verification failed: block %u expected max %u, got %u\n", b, expected, out_max[b]);
+            okay = false;
+        }
+    }
+
+    return okay;
+}
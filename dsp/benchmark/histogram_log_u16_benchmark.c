@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/helpers/log_histogram.h"
+
+void STARCH_BENCHMARK(histogram_log_u16) (void)
+{
+    uint16_t *in = NULL;
+    unsigned *histogram = NULL;
+    const unsigned len = 65536;
+    const unsigned stride = 4;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(histogram = STARCH_BENCHMARK_ALLOC(LOG_HISTOGRAM_BUCKETS, unsigned))) {
+        goto done;
+    }
+
+    // Mostly low-level noise, as seen by the noise floor measurement
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        if (rand() % 16)
+            in[i] = rand() % 2000 + rand() % 2000;
+        else
+            in[i] = rand() % 32768;
+    }
+
+    // exactly one sample in the top bucket, see the verify function
+    in[len - stride] = 65535;
+
+    memset(histogram, 0, LOG_HISTOGRAM_BUCKETS * sizeof(unsigned));
+    STARCH_BENCHMARK_RUN( histogram_log_u16, in, len, stride, histogram );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(histogram);
+}
+
+bool STARCH_BENCHMARK_VERIFY(histogram_log_u16) (const uint16_t *in, unsigned len, unsigned stride, unsigned *histogram)
+{
+    // The benchmark runs the function repeatedly without resetting the
+    // histogram, so every count is a multiple of the number of runs so far
+    // (modulo 2^32, as the counters may wrap). The benchmark input has
+    // exactly one sample in the top bucket, which gives us that number.
+    unsigned expected[LOG_HISTOGRAM_BUCKETS];
+    memset(expected, 0, sizeof(expected));
+
+    for (unsigned i = 0; i < len; i += stride) {
+        uint16_t value = in[i];
+
+        // find the bucket the slow way
+        unsigned bucket;
+        for (bucket = 0; bucket + 1 < LOG_HISTOGRAM_BUCKETS; ++bucket) {
+            if (value < log_histogram_bucket_low(bucket) + log_histogram_bucket_width(bucket))
+                break;
+        }
+        ++expected[bucket];
+    }
+
+    if (expected[LOG_HISTOGRAM_BUCKETS - 1] != 1) {
+        fprintf(stderr, "verification failed: unexpected benchmark input\n");
+        return false;
+    }
+
+    unsigned runs = histogram[LOG_HISTOGRAM_BUCKETS - 1];
+    bool okay = true;
+    for (unsigned bucket = 0; bucket < LOG_HISTOGRAM_BUCKETS; ++bucket) {
+        if (histogram[bucket] != expected[bucket] * runs) {
+            fprintf(stderr, "verification failed: bucket %u: expected count %u * %u, got %u\n",
+                    bucket, expected[bucket], runs, histogram[bucket]);
+            okay = false;
+            break;
+        }
+    }
+
+    return okay;
+}
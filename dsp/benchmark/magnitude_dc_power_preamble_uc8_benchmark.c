@@ -0,0 +1,101 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "dsp/helpers/preamble_bitmap.h"
+
+// As for magnitude_dc_uc8: the input has a constant DC offset that the
+// filter starts out converged on, so verification can use the fixed offset.
+
+#ifndef MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I
+#define MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I 130
+#define MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q 120
+#endif
+
+void STARCH_BENCHMARK(magnitude_dc_power_preamble_uc8) (void)
+{
+    uc8_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    uint64_t *bitmap = NULL;
+    const unsigned len = 131072; /* one full sample buffer */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uc8_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t)) ||
+        !(bitmap = STARCH_BENCHMARK_ALLOC(PREAMBLE_BITMAP_WORDS(len), uint64_t))) {
+        goto done;
+    }
+
+    // random values in pairs symmetric about the DC offset
+    srand(1);
+    for (unsigned i = 0; i + 1 < len; i += 2) {
+        int dI = rand() % (2 * 110 + 1) - 110;
+        int dQ = rand() % (2 * 110 + 1) - 110;
+        in[i + 0].I = (uint8_t) (MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I + dI);
+        in[i + 0].Q = (uint8_t) (MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q + dQ);
+        in[i + 1].I = (uint8_t) (MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I - dI);
+        in[i + 1].Q = (uint8_t) (MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q - dQ);
+    }
+
+    dc_filter_t state = { MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I, MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q, 2 * M_PI * 1.0 / 2400000 };
+    double level, power;
+    STARCH_BENCHMARK_RUN( magnitude_dc_power_preamble_uc8, in, out_mag, len, &state, &level, &power, bitmap );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+    STARCH_BENCHMARK_FREE(bitmap);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_dc_power_preamble_uc8) (const uc8_t *in, uint16_t *out_mag, unsigned len, dc_filter_t *state, double *out_level, double *out_power, uint64_t *bitmap)
+{
+    const double max_error = 0.015; // tolerate 1.5% error in magnitudes
+    const double epsilon = 3.0;
+
+    if (fabs(state->dc_I - MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I) > 0.01 || fabs(state->dc_Q - MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q) > 0.01) {
+        fprintf(stderr, "verification failed: DC estimate moved from (%d,%d) to (%.2f,%.2f)\n",
+                MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I, MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q, state->dc_I, state->dc_Q);
+        return false;
+    }
+
+    double sum_level = 0, sum_power = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        double I = (in[i].I - MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_I) * 512.0;
+        double Q = (in[i].Q - MAGNITUDE_DC_POWER_PREAMBLE_UC8_BENCHMARK_DC_Q) * 512.0;
+        double expected = round(sqrt(I * I + Q * Q));
+        if (expected > 65535.0)
+            expected = 65535.0;
+        double actual = out_mag[i];
+
+        double error = fabs(expected - actual);
+        double error_fraction = error / (expected > epsilon ? expected : epsilon);
+        if (error > epsilon && error_fraction > max_error) {
+            fprintf(stderr, "verification failed: in[%u].I=%u in[%u].Q=%u out[%u]=%u, expected=%.0f, error=%.2f%%\n",
+                    i, in[i].I, i, in[i].Q, i, out_mag[i], expected, error_fraction * 100.0);
+            return false;
+        }
+
+        // level and power are of the magnitudes actually produced
+        sum_level += actual / 65536.0;
+        sum_power += (actual / 65536.0) * (actual / 65536.0);
+    }
+
+    // tolerate 0.01% error, some implementations approximate the power
+    const double max_power_error = 0.0001;
+    sum_level /= len;
+    sum_power /= len;
+    if (fabs(sum_level - *out_level) > sum_level * max_power_error || fabs(sum_power - *out_power) > sum_power * max_power_error) {
+        fprintf(stderr, "verification failed: expected level %.6f power %.6f, got level %.6f power %.6f\n",
+                sum_level, sum_power, *out_level, *out_power);
+        return false;
+    }
+
+    for (unsigned j = 0; j < PREAMBLE_BITMAP_WORDS(len) * 64; ++j) {
+        bool expected = (j + PREAMBLE_BITMAP_LOOKAHEAD < len && preamble_bitmap_test(&out_mag[j]));
+        bool actual = (bitmap[j / 64] >> (j % 64)) & 1;
+        if (expected != actual) {
+            fprintf(stderr, "verification failed: bitmap bit %u: expected %d, got %d\n", j, expected, actual);
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+// The input has a constant DC offset, every filter block has exactly that
+// mean, and the filter starts out converged on it. So the DC estimate
+// doesn't move however many times the function is run, and verification
+// can use the fixed offset.
+
+#ifndef MAGNITUDE_DC_UC8_BENCHMARK_DC_I
+#define MAGNITUDE_DC_UC8_BENCHMARK_DC_I 130
+#define MAGNITUDE_DC_UC8_BENCHMARK_DC_Q 120
+#endif
+
+void STARCH_BENCHMARK(magnitude_dc_uc8) (void)
+{
+    uc8_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uc8_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t))) {
+        goto done;
+    }
+
+    // random values in pairs symmetric about the DC offset
+    srand(1);
+    for (unsigned i = 0; i + 1 < len; i += 2) {
+        int dI = rand() % (2 * 110 + 1) - 110;
+        int dQ = rand() % (2 * 110 + 1) - 110;
+        in[i + 0].I = (uint8_t) (MAGNITUDE_DC_UC8_BENCHMARK_DC_I + dI);
+        in[i + 0].Q = (uint8_t) (MAGNITUDE_DC_UC8_BENCHMARK_DC_Q + dQ);
+        in[i + 1].I = (uint8_t) (MAGNITUDE_DC_UC8_BENCHMARK_DC_I - dI);
+        in[i + 1].Q = (uint8_t) (MAGNITUDE_DC_UC8_BENCHMARK_DC_Q - dQ);
+    }
+
+    dc_filter_t state = { MAGNITUDE_DC_UC8_BENCHMARK_DC_I, MAGNITUDE_DC_UC8_BENCHMARK_DC_Q, 2 * M_PI * 1.0 / 2400000 };
+    STARCH_BENCHMARK_RUN( magnitude_dc_uc8, in, out_mag, len, &state );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_dc_uc8) (const uc8_t *in, uint16_t *out, unsigned len, dc_filter_t *state)
+{
+    const double max_error = 0.015; // tolerate 1.5% error
+    const double epsilon = 3.0;
+    bool okay = true;
+
+    if (fabs(state->dc_I - MAGNITUDE_DC_UC8_BENCHMARK_DC_I) > 0.01 || fabs(state->dc_Q - MAGNITUDE_DC_UC8_BENCHMARK_DC_Q) > 0.01) {
+        fprintf(stderr, "verification failed: DC estimate moved from (%d,%d) to (%.2f,%.2f)\n",
+                MAGNITUDE_DC_UC8_BENCHMARK_DC_I, MAGNITUDE_DC_UC8_BENCHMARK_DC_Q, state->dc_I, state->dc_Q);
+        okay = false;
+    }
+
+    for (unsigned i = 0; i < len; ++i) {
+        double I = (in[i].I - MAGNITUDE_DC_UC8_BENCHMARK_DC_I) * 512.0;
+        double Q = (in[i].Q - MAGNITUDE_DC_UC8_BENCHMARK_DC_Q) * 512.0;
+        double expected = round(sqrt(I * I + Q * Q));
+        if (expected > 65535.0)
+            expected = 65535.0;
+        double actual = out[i];
+
+        double error = fabs(expected - actual);
+        double error_fraction = error / (expected > epsilon ? expected : epsilon);
+        if (error > epsilon && error_fraction > max_error) {
+            fprintf(stderr, "verification failed: in[%u].I=%u in[%u].Q=%u out[%u]=%u, expected=%.0f, error=%.2f%%\n",
+                    i, in[i].I,
+                    i, in[i].Q,
+                    i, out[i],
+                    expected,
+                    error_fraction * 100.0);
+            okay = false;
+        }
+    }
+
+    return okay;
+}
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "dsp/helpers/tables.h"
+#include "dsp/helpers/preamble_bitmap.h"
+
+void STARCH_BENCHMARK(magnitude_power_preamble_uc8) (void)
+{
+    uc8_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    uint64_t *bitmap = NULL;
+    const unsigned len = 131072; /* one full sample buffer */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uc8_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t)) ||
+        !(bitmap = STARCH_BENCHMARK_ALLOC(PREAMBLE_BITMAP_WORDS(len), uint64_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i].I = rand() % 256;
+        in[i].Q = rand() % 256;
+    }
+
+    double level, power;
+    STARCH_BENCHMARK_RUN( magnitude_power_preamble_uc8, in, out_mag, len, &level, &power, bitmap );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+    STARCH_BENCHMARK_FREE(bitmap);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_power_preamble_uc8) (const uc8_t *in, uint16_t *out_mag, unsigned len, double *out_level, double *out_power, uint64_t *bitmap)
+{
+    const uint16_t *mag_table = get_uc8_mag_table();
+    double sum_level = 0, sum_power = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        uc8_u16_t u;
+        u.uc8 = in[i];
+        uint16_t expected = mag_table[u.u16];
+        if (out_mag[i] != expected) {
+            fprintf(stderr, "verification failed: sample %u: expected magnitude %u, got %u\n", i, expected, out_mag[i]);
+            return false;
+        }
+        sum_level += expected / 65536.0;
+        sum_power += (expected / 65536.0) * (expected / 65536.0);
+    }
+
+    // tolerate 0.01% error, some implementations approximate the power
+    const double max_error = 0.0001;
+    sum_level /= len;
+    sum_power /= len;
+    if (fabs(sum_level - *out_level) > sum_level * max_error || fabs(sum_power - *out_power) > sum_power * max_error) {
+        fprintf(stderr, "verification failed: expected level %.6f power %.6f, got level %.6f power %.6f\n",
+                sum_level, sum_power, *out_level, *out_power);
+        return false;
+    }
+
+    for (unsigned j = 0; j < PREAMBLE_BITMAP_WORDS(len) * 64; ++j) {
+        bool expected = (j + PREAMBLE_BITMAP_LOOKAHEAD < len && preamble_bitmap_test(&out_mag[j]));
+        bool actual = (bitmap[j / 64] >> (j % 64)) & 1;
+        if (expected != actual) {
+            fprintf(stderr, "verification failed: bitmap bit %u: expected %d, got %d\n", j, expected, actual);
+            return false;
+        }
+    }
+
+    return true;
+}
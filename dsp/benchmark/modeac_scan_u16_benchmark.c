@@ -0,0 +1,85 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+void STARCH_BENCHMARK(modeac_scan_u16) (void)
+{
+    uint16_t *in = NULL;
+    unsigned *out_offsets = NULL;
+    const unsigned len = 65536;
+    const unsigned noise_level = 2000;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + 52, uint16_t)) || !(out_offsets = STARCH_BENCHMARK_ALLOC(len, unsigned))) {
+        goto done;
+    }
+
+    // background noise
+    srand(1);
+    for (unsigned i = 0; i < len + 52; ++i) {
+        in[i] = rand() % (2 * noise_level);
+    }
+
+    // a Mode A/C reply (random code, with framing pulses) every 1000 samples or so,
+    // with varying clock phase
+    for (unsigned f1_clock = 25 * 100 + 7; f1_clock / 25 + 20 * 87 / 25 + 3 < len; f1_clock += 25 * 1000 + 11) {
+        unsigned bits = (rand() & 0x7FFFF) | 0x80020;
+        for (unsigned bit = 0; bit < 20; ++bit) {
+            if (!(bits & (0x80000 >> bit)))
+                continue;
+
+            unsigned clock = f1_clock + bit * 87;
+            unsigned sample = clock / 25;
+            unsigned phase = clock % 25;
+            in[sample] = 20000 - phase * 300;
+            in[sample + 1] = 12000 + phase * 300;
+            in[sample + 2] = noise_level / 2;
+        }
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( modeac_scan_u16, in, len, noise_level * 4, out_offsets, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_offsets);
+}
+
+bool STARCH_BENCHMARK_VERIFY(modeac_scan_u16) (const uint16_t *in, unsigned len, unsigned threshold, unsigned *out_offsets, unsigned *out_count)
+{
+    // The same checks that demodulate2400AC makes, in the same order
+    unsigned expected = 0;
+    bool okay = true;
+
+    for (unsigned f1_sample = 1; f1_sample <= len; ++f1_sample) {
+        bool found = false;
+
+        if (in[f1_sample-1] < in[f1_sample+0] &&
+            !(in[f1_sample+2] > in[f1_sample+0] || in[f1_sample+2] > in[f1_sample+1]) &&
+            !(threshold > (unsigned) in[f1_sample+0] + in[f1_sample+1])) {
+            for (unsigned f2_sample = f1_sample + 48; f2_sample <= f1_sample + 49; ++f2_sample) {
+                if (in[f2_sample-1] < in[f2_sample+0] &&
+                    !(in[f2_sample+2] > in[f2_sample+0] || in[f2_sample+2] > in[f2_sample+1]) &&
+                    !(threshold > (unsigned) in[f2_sample+0] + in[f2_sample+1])) {
+                    found = true;
+                }
+            }
+        }
+
+        if (!found)
+            continue;
+
+        if (expected >= *out_count || out_offsets[expected] != f1_sample) {
+            if (okay)
+                fprintf(stderr, "verification failed: expected candidate #%u at offset %u, got %u\n",
+                        expected, f1_sample, expected < *out_count ? out_offsets[expected] : 0);
+            okay = false;
+        }
+        ++expected;
+    }
+
+    if (expected != *out_count) {
+        fprintf(stderr, "verification failed: expected %u candidates, got %u\n", expected, *out_count);
+        okay = false;
+    }
+
+    return okay;
+}
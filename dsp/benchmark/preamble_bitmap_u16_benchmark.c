@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+void STARCH_BENCHMARK(preamble_bitmap_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint64_t *bitmap = NULL;
+    const unsigned len = 131072; /* one full sample buffer */
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(bitmap = STARCH_BENCHMARK_ALLOC((len + 63) / 64, uint64_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand() % 65536;
+    }
+
+    STARCH_BENCHMARK_RUN( preamble_bitmap_u16, in, len, bitmap );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(bitmap);
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_bitmap_u16) (const uint16_t *in, unsigned len, uint64_t *bitmap)
+{
+    for (unsigned j = 0; j < len; ++j) {
+        const uint16_t *preamble = &in[j];
+        bool expected = false;
+
+        // the checks made by demodulate2400, up to the per-phase pulse shapes
+        if (j + 13 < len && preamble[0] < preamble[1] && preamble[12] > preamble[13]) {
+            expected =
+                (preamble[1] > preamble[2] && preamble[2] < preamble[3] && preamble[3] > preamble[4] &&
+                 preamble[8] < preamble[9] && preamble[9] > preamble[10] && preamble[10] < preamble[11]) ||
+                (preamble[1] > preamble[2] && preamble[2] < preamble[3] && preamble[3] > preamble[4] &&
+                 preamble[8] < preamble[9] && preamble[9] > preamble[10] && preamble[11] < preamble[12]) ||
+                (preamble[1] > preamble[2] && preamble[2] < preamble[3] && preamble[4] > preamble[5] &&
+                 preamble[8] < preamble[9] && preamble[10] > preamble[11] && preamble[11] < preamble[12]) ||
+                (preamble[1] > preamble[2] && preamble[3] < preamble[4] && preamble[4] > preamble[5] &&
+                 preamble[9] < preamble[10] && preamble[10] > preamble[11] && preamble[11] < preamble[12]) ||
+                (preamble[2] > preamble[3] && preamble[3] < preamble[4] && preamble[4] > preamble[5] &&
+                 preamble[9] < preamble[10] && preamble[10] > preamble[11] && preamble[11] < preamble[12]);
+        }
+
+        bool actual = (bitmap[j / 64] >> (j % 64)) & 1;
+        if (expected && !actual) {
+            fprintf(stderr, "verification failed: sample %u could be a preamble, but is not flagged\n", j);
+            return false;
+        }
+        if (!actual)
+            continue;
+
+        // flagged samples must at least pass the quick checks
+        if (j + 13 >= len || !(preamble[0] < preamble[1] && preamble[12] > preamble[13])) {
+            fprintf(stderr, "verification failed: sample %u is flagged, but is not a preamble candidate\n", j);
+            return false;
+        }
+    }
+
+    for (unsigned j = len; j < (len + 63) / 64 * 64; ++j) {
+        if ((bitmap[j / 64] >> (j % 64)) & 1) {
+            fprintf(stderr, "verification failed: bit %u past the end of the buffer is set\n", j);
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "dsp/helpers/resampler.h"
+
+void STARCH_BENCHMARK(resample_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint16_t *out = NULL;
+    resampler_t *r = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(out = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(r = STARCH_BENCHMARK_ALLOC(1, resampler_t))) {
+        goto done;
+    }
+
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        in[i] = rand() % 65536;
+    }
+
+    // 8MHz -> 2.4MHz, and 6MHz -> 2.4MHz
+    resampler_build(r, 3, 10);
+    STARCH_BENCHMARK_RUN( resample_u16, in, out, (len - r->span) / r->down + 1, r );
+
+    resampler_build(r, 2, 5);
+    STARCH_BENCHMARK_RUN( resample_u16, in, out, (len - r->span) / r->down + 1, r );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+    STARCH_BENCHMARK_FREE(r);
+}
+
+bool STARCH_BENCHMARK_VERIFY(resample_u16) (const uint16_t *in, uint16_t *out, unsigned groups, const resampler_t *r)
+{
+    // integrate the input over each output period, in floating point
+    bool okay = true;
+    const double period = (double) r->down / r->up;
+
+    for (unsigned k = 0; k < groups * r->up; ++k) {
+        double start = k * period, end = (k + 1) * period;
+        double sum = 0;
+        for (unsigned i = (unsigned) start; i < end; ++i) {
+            double lo = (i < start ? start : i);
+            double hi = (i + 1 > end ? end : i + 1);
+            sum += in[i] * (hi - lo);
+        }
+
+        double expected = sum / period;
+        if (fabs(expected - out[k]) > 2.0) {
+            if (okay)
+                fprintf(stderr, "verification failed: out[%u]=%u, expected=%.1f (up=%u down=%u)\n",
+                        k, out[k], expected, r->up, r->down);
+            okay = false;
+        }
+    }
+
+    return okay;
+}
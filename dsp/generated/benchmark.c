@@ -122,6 +122,230 @@ static bool starch_benchmark_flavor_in_list(const char *flavor, const starch_ben
 }
 
 
+/* prototypes for benchmark helpers provided by user code */
+void starch_block_max_u16_benchmark (void);
+bool starch_block_max_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_block_max_u16_benchmark(void);
+
+static void starch_benchmark_one_block_max_u16( starch_block_max_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_block_max_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "block_max_u16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_block_max_u16( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 )
+{
+    for (starch_block_max_u16_regentry *_entry = starch_block_max_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_block_max_u16( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_block_max_u16_aligned_benchmark (void);
+bool starch_block_max_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_block_max_u16_aligned_benchmark(void);
+
+static void starch_benchmark_one_block_max_u16_aligned( starch_block_max_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_block_max_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "block_max_u16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_block_max_u16_aligned( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 )
+{
+    for (starch_block_max_u16_aligned_regentry *_entry = starch_block_max_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_block_max_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
 /* prototypes for benchmark helpers provided by user code */
 void starch_count_above_u16_benchmark (void);
 bool starch_count_above_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
@@ -347,13 +571,2029 @@ static void starch_benchmark_run_count_above_u16_aligned( const uint16_t * arg0,
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_power_uc8_benchmark (void);
-bool starch_magnitude_power_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_histogram_log_u16_benchmark (void);
+bool starch_histogram_log_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_power_uc8_benchmark(void);
+void starch_histogram_log_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_one_histogram_log_u16( starch_histogram_log_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_histogram_log_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "histogram_log_u16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_histogram_log_u16( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 )
+{
+    for (starch_histogram_log_u16_regentry *_entry = starch_histogram_log_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_histogram_log_u16( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_histogram_log_u16_aligned_benchmark (void);
+bool starch_histogram_log_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_histogram_log_u16_aligned_benchmark(void);
+
+static void starch_benchmark_one_histogram_log_u16_aligned( starch_histogram_log_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_histogram_log_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "histogram_log_u16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_histogram_log_u16_aligned( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 )
+{
+    for (starch_histogram_log_u16_aligned_regentry *_entry = starch_histogram_log_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_histogram_log_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_power_preamble_uc8_benchmark (void);
+bool starch_magnitude_dc_power_preamble_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_power_preamble_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_power_preamble_uc8( starch_magnitude_dc_power_preamble_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_power_preamble_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_power_preamble_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_power_preamble_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 )
+{
+    for (starch_magnitude_dc_power_preamble_uc8_regentry *_entry = starch_magnitude_dc_power_preamble_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_power_preamble_uc8( _entry, arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_power_preamble_uc8_aligned_benchmark (void);
+bool starch_magnitude_dc_power_preamble_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_power_preamble_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_power_preamble_uc8_aligned( starch_magnitude_dc_power_preamble_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_power_preamble_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_power_preamble_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_power_preamble_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 )
+{
+    for (starch_magnitude_dc_power_preamble_uc8_aligned_regentry *_entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_power_preamble_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16_benchmark (void);
+bool starch_magnitude_dc_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16( starch_magnitude_dc_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16_regentry *_entry = starch_magnitude_dc_sc16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16_aligned_benchmark (void);
+bool starch_magnitude_dc_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16_aligned( starch_magnitude_dc_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16_aligned_regentry *_entry = starch_magnitude_dc_sc16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16q11_benchmark (void);
+bool starch_magnitude_dc_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16q11_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16q11( starch_magnitude_dc_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16q11_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16q11_regentry *_entry = starch_magnitude_dc_sc16q11_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16q11( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16q11_aligned_benchmark (void);
+bool starch_magnitude_dc_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16q11_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16q11_aligned( starch_magnitude_dc_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *_entry = starch_magnitude_dc_sc16q11_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16q11_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_uc8_benchmark (void);
+bool starch_magnitude_dc_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_uc8( starch_magnitude_dc_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_uc8_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_uc8_regentry *_entry = starch_magnitude_dc_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_uc8( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_uc8_aligned_benchmark (void);
+bool starch_magnitude_dc_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_uc8_aligned( starch_magnitude_dc_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 )
+{
+    for (starch_magnitude_dc_uc8_aligned_regentry *_entry = starch_magnitude_dc_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_uc8_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_preamble_uc8_benchmark (void);
+bool starch_magnitude_power_preamble_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_preamble_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_preamble_uc8( starch_magnitude_power_preamble_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_preamble_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4, arg5 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_preamble_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_preamble_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 )
+{
+    for (starch_magnitude_power_preamble_uc8_regentry *_entry = starch_magnitude_power_preamble_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_preamble_uc8( _entry, arg0, arg1, arg2, arg3, arg4, arg5 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_preamble_uc8_aligned_benchmark (void);
+bool starch_magnitude_power_preamble_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_preamble_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_preamble_uc8_aligned( starch_magnitude_power_preamble_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_preamble_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4, arg5 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_preamble_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_preamble_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 )
+{
+    for (starch_magnitude_power_preamble_uc8_aligned_regentry *_entry = starch_magnitude_power_preamble_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_preamble_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4, arg5 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_uc8_benchmark (void);
+bool starch_magnitude_power_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_regentry *_entry = starch_magnitude_power_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_uc8_aligned_benchmark (void);
+bool starch_magnitude_power_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_power_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_aligned_regentry *_entry = starch_magnitude_power_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16_benchmark (void);
+bool starch_magnitude_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16_regentry *_entry = starch_magnitude_sc16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16_aligned_benchmark (void);
+bool starch_magnitude_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16_aligned_regentry *_entry = starch_magnitude_sc16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16_aligned( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16q11_benchmark (void);
+bool starch_magnitude_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16q11_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16q11_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16q11_regentry *_entry = starch_magnitude_sc16q11_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16q11( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16q11_aligned_benchmark (void);
+bool starch_magnitude_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16q11_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 100ms */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 127;
+    while (_elapsed < 100000000) {
+        _loops *= 2;
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx 1 second */
+    _loops = _loops * 1000000000 / _elapsed;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16q11_aligned_regentry *_entry = starch_magnitude_sc16q11_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16q11_aligned( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_uc8_benchmark (void);
+bool starch_magnitude_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -380,10 +2620,10 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        _entry->callable ( arg0, arg1, arg2 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_power_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+    if (! starch_magnitude_uc8_benchmark_verify ( arg0, arg1, arg2 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -401,7 +2641,7 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -415,7 +2655,7 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -445,27 +2685,27 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_power_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_run_magnitude_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
 {
-    for (starch_magnitude_power_uc8_regentry *_entry = starch_magnitude_power_uc8_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_power_uc8( _entry, arg0, arg1, arg2, arg3, arg4 );
+    for (starch_magnitude_uc8_regentry *_entry = starch_magnitude_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_uc8( _entry, arg0, arg1, arg2 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_power_uc8_aligned_benchmark (void);
-bool starch_magnitude_power_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_uc8_aligned_benchmark (void);
+bool starch_magnitude_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_power_uc8_aligned_benchmark(void);
+void starch_magnitude_uc8_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_power_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -492,10 +2732,10 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        _entry->callable ( arg0, arg1, arg2 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_power_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+    if (! starch_magnitude_uc8_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -513,7 +2753,7 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -527,7 +2767,7 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -557,27 +2797,27 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_power_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_run_magnitude_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
 {
-    for (starch_magnitude_power_uc8_aligned_regentry *_entry = starch_magnitude_power_uc8_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_power_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    for (starch_magnitude_uc8_aligned_regentry *_entry = starch_magnitude_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_uc8_aligned( _entry, arg0, arg1, arg2 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16_benchmark (void);
-bool starch_magnitude_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_mean_power_u16_benchmark (void);
+bool starch_mean_power_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16_benchmark(void);
+void starch_mean_power_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -604,10 +2844,10 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_mean_power_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -625,7 +2865,7 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -639,7 +2879,7 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -669,27 +2909,27 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_mean_power_u16( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
-    for (starch_magnitude_sc16_regentry *_entry = starch_magnitude_sc16_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16( _entry, arg0, arg1, arg2 );
+    for (starch_mean_power_u16_regentry *_entry = starch_mean_power_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_mean_power_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16_aligned_benchmark (void);
-bool starch_magnitude_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_mean_power_u16_aligned_benchmark (void);
+bool starch_mean_power_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16_aligned_benchmark(void);
+void starch_mean_power_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -716,10 +2956,10 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_mean_power_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -737,7 +2977,7 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -751,7 +2991,7 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -781,27 +3021,27 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
-    for (starch_magnitude_sc16_aligned_regentry *_entry = starch_magnitude_sc16_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_mean_power_u16_aligned_regentry *_entry = starch_mean_power_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_mean_power_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16q11_benchmark (void);
-bool starch_magnitude_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_modeac_scan_u16_benchmark (void);
+bool starch_modeac_scan_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16q11_benchmark(void);
+void starch_modeac_scan_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_modeac_scan_u16( starch_modeac_scan_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -828,10 +3068,10 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16q11_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_modeac_scan_u16_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -849,7 +3089,7 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -863,7 +3103,7 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -893,27 +3133,27 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].name = "modeac_scan_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_modeac_scan_u16( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 )
 {
-    for (starch_magnitude_sc16q11_regentry *_entry = starch_magnitude_sc16q11_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16q11( _entry, arg0, arg1, arg2 );
+    for (starch_modeac_scan_u16_regentry *_entry = starch_modeac_scan_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_modeac_scan_u16( _entry, arg0, arg1, arg2, arg3, arg4 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16q11_aligned_benchmark (void);
-bool starch_magnitude_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_modeac_scan_u16_aligned_benchmark (void);
+bool starch_modeac_scan_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16q11_aligned_benchmark(void);
+void starch_modeac_scan_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_modeac_scan_u16_aligned( starch_modeac_scan_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -940,10 +3180,10 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_modeac_scan_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -961,7 +3201,7 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
         _loops *= 2;
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
@@ -975,7 +3215,7 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -1005,27 +3245,27 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "modeac_scan_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_modeac_scan_u16_aligned( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 )
 {
-    for (starch_magnitude_sc16q11_aligned_regentry *_entry = starch_magnitude_sc16q11_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16q11_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_modeac_scan_u16_aligned_regentry *_entry = starch_modeac_scan_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_modeac_scan_u16_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_uc8_benchmark (void);
-bool starch_magnitude_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_bitmap_u16_benchmark (void);
+bool starch_preamble_bitmap_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_uc8_benchmark(void);
+void starch_preamble_bitmap_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_bitmap_u16( starch_preamble_bitmap_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint64_t * arg2 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1055,7 +3295,7 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
         _entry->callable ( arg0, arg1, arg2 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_uc8_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_bitmap_u16_benchmark_verify ( arg0, arg1, arg2 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1117,27 +3357,27 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_bitmap_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_bitmap_u16( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 )
 {
-    for (starch_magnitude_uc8_regentry *_entry = starch_magnitude_uc8_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_uc8( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_bitmap_u16_regentry *_entry = starch_preamble_bitmap_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_bitmap_u16( _entry, arg0, arg1, arg2 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_uc8_aligned_benchmark (void);
-bool starch_magnitude_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_bitmap_u16_aligned_benchmark (void);
+bool starch_preamble_bitmap_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_uc8_aligned_benchmark(void);
+void starch_preamble_bitmap_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_bitmap_u16_aligned( starch_preamble_bitmap_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint64_t * arg2 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1167,7 +3407,7 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
         _entry->callable ( arg0, arg1, arg2 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_uc8_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_bitmap_u16_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1229,27 +3469,27 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_bitmap_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_bitmap_u16_aligned( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 )
 {
-    for (starch_magnitude_uc8_aligned_regentry *_entry = starch_magnitude_uc8_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_uc8_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_bitmap_u16_aligned_regentry *_entry = starch_preamble_bitmap_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_bitmap_u16_aligned( _entry, arg0, arg1, arg2 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_mean_power_u16_benchmark (void);
-bool starch_mean_power_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_u16_benchmark (void);
+bool starch_resample_u16_benchmark_verify ( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_mean_power_u16_benchmark(void);
+void starch_resample_u16_benchmark(void);
 
-static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_one_resample_u16( starch_resample_u16_regentry * _entry, const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1279,7 +3519,7 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
         _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_mean_power_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+    if (! starch_resample_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1341,27 +3581,27 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16";
+    starch_benchmark_results[starch_benchmark_result_count].name = "resample_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_mean_power_u16( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_run_resample_u16( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 )
 {
-    for (starch_mean_power_u16_regentry *_entry = starch_mean_power_u16_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_mean_power_u16( _entry, arg0, arg1, arg2, arg3 );
+    for (starch_resample_u16_regentry *_entry = starch_resample_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_resample_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_mean_power_u16_aligned_benchmark (void);
-bool starch_mean_power_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_u16_aligned_benchmark (void);
+bool starch_resample_u16_aligned_benchmark_verify ( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_mean_power_u16_aligned_benchmark(void);
+void starch_resample_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_one_resample_u16_aligned( starch_resample_u16_aligned_regentry * _entry, const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1391,7 +3631,7 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_mean_power_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+    if (! starch_resample_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1453,16 +3693,16 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "resample_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_run_resample_u16_aligned( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 )
 {
-    for (starch_mean_power_u16_aligned_regentry *_entry = starch_mean_power_u16_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_mean_power_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    for (starch_resample_u16_aligned_regentry *_entry = starch_resample_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_resample_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
@@ -1480,12 +3720,22 @@ static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0,
 #define STARCH_BENCHMARK_ALLOC(_count, _type) ((_type *) starch_benchmark_aligned_alloc(1, alignof(_type), (_count) * sizeof(_type)))
 #define STARCH_BENCHMARK_FREE(_ptr) starch_benchmark_aligned_free(_ptr)
 
+#include "../benchmark/block_max_u16_benchmark.c"
 #include "../benchmark/count_above_u16_benchmark.c"
+#include "../benchmark/histogram_log_u16_benchmark.c"
+#include "../benchmark/magnitude_dc_power_preamble_uc8_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16q11_benchmark.c"
+#include "../benchmark/magnitude_dc_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_preamble_uc8_benchmark.c"
 #include "../benchmark/magnitude_power_uc8_benchmark.c"
 #include "../benchmark/magnitude_sc16_benchmark.c"
 #include "../benchmark/magnitude_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_uc8_benchmark.c"
 #include "../benchmark/mean_power_u16_benchmark.c"
+#include "../benchmark/modeac_scan_u16_benchmark.c"
+#include "../benchmark/preamble_bitmap_u16_benchmark.c"
+#include "../benchmark/resample_u16_benchmark.c"
 
 #undef STARCH_ALIGNMENT
 #undef STARCH_ALIGNED
@@ -1509,13 +3759,33 @@ static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0,
 #define STARCH_BENCHMARK_ALLOC(_count, _type) ((_type *) starch_benchmark_aligned_alloc(STARCH_MIX_ALIGNMENT, alignof(_type), (_count) * sizeof(_type)))
 #define STARCH_BENCHMARK_FREE(_ptr) starch_benchmark_aligned_free(_ptr)
 
+#include "../benchmark/block_max_u16_benchmark.c"
 #include "../benchmark/count_above_u16_benchmark.c"
+#include "../benchmark/histogram_log_u16_benchmark.c"
+#include "../benchmark/magnitude_dc_power_preamble_uc8_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16q11_benchmark.c"
+#include "../benchmark/magnitude_dc_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_preamble_uc8_benchmark.c"
 #include "../benchmark/magnitude_power_uc8_benchmark.c"
 #include "../benchmark/magnitude_sc16_benchmark.c"
 #include "../benchmark/magnitude_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_uc8_benchmark.c"
 #include "../benchmark/mean_power_u16_benchmark.c"
+#include "../benchmark/modeac_scan_u16_benchmark.c"
+#include "../benchmark/preamble_bitmap_u16_benchmark.c"
+#include "../benchmark/resample_u16_benchmark.c"
 
+static void starch_benchmark_all_block_max_u16(void)
+{
+    fprintf(stderr, "==== block_max_u16 ===\n");
+    starch_block_max_u16_benchmark ();
+}
+static void starch_benchmark_all_block_max_u16_aligned(void)
+{
+    fprintf(stderr, "==== block_max_u16_aligned ===\n");
+    starch_block_max_u16_aligned_benchmark ();
+}
 static void starch_benchmark_all_count_above_u16(void)
 {
     fprintf(stderr, "==== count_above_u16 ===\n");
@@ -1526,6 +3796,66 @@ static void starch_benchmark_all_count_above_u16_aligned(void)
     fprintf(stderr, "==== count_above_u16_aligned ===\n");
     starch_count_above_u16_aligned_benchmark ();
 }
+static void starch_benchmark_all_histogram_log_u16(void)
+{
+    fprintf(stderr, "==== histogram_log_u16 ===\n");
+    starch_histogram_log_u16_benchmark ();
+}
+static void starch_benchmark_all_histogram_log_u16_aligned(void)
+{
+    fprintf(stderr, "==== histogram_log_u16_aligned ===\n");
+    starch_histogram_log_u16_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_power_preamble_uc8(void)
+{
+    fprintf(stderr, "==== magnitude_dc_power_preamble_uc8 ===\n");
+    starch_magnitude_dc_power_preamble_uc8_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_power_preamble_uc8_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_power_preamble_uc8_aligned ===\n");
+    starch_magnitude_dc_power_preamble_uc8_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16 ===\n");
+    starch_magnitude_dc_sc16_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16_aligned ===\n");
+    starch_magnitude_dc_sc16_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16q11(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16q11 ===\n");
+    starch_magnitude_dc_sc16q11_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16q11_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16q11_aligned ===\n");
+    starch_magnitude_dc_sc16q11_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_uc8(void)
+{
+    fprintf(stderr, "==== magnitude_dc_uc8 ===\n");
+    starch_magnitude_dc_uc8_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_uc8_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_uc8_aligned ===\n");
+    starch_magnitude_dc_uc8_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_preamble_uc8(void)
+{
+    fprintf(stderr, "==== magnitude_power_preamble_uc8 ===\n");
+    starch_magnitude_power_preamble_uc8_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_preamble_uc8_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_power_preamble_uc8_aligned ===\n");
+    starch_magnitude_power_preamble_uc8_aligned_benchmark ();
+}
 static void starch_benchmark_all_magnitude_power_uc8(void)
 {
     fprintf(stderr, "==== magnitude_power_uc8 ===\n");
@@ -1576,6 +3906,36 @@ static void starch_benchmark_all_mean_power_u16_aligned(void)
     fprintf(stderr, "==== mean_power_u16_aligned ===\n");
     starch_mean_power_u16_aligned_benchmark ();
 }
+static void starch_benchmark_all_modeac_scan_u16(void)
+{
+    fprintf(stderr, "==== modeac_scan_u16 ===\n");
+    starch_modeac_scan_u16_benchmark ();
+}
+static void starch_benchmark_all_modeac_scan_u16_aligned(void)
+{
+    fprintf(stderr, "==== modeac_scan_u16_aligned ===\n");
+    starch_modeac_scan_u16_aligned_benchmark ();
+}
+static void starch_benchmark_all_preamble_bitmap_u16(void)
+{
+    fprintf(stderr, "==== preamble_bitmap_u16 ===\n");
+    starch_preamble_bitmap_u16_benchmark ();
+}
+static void starch_benchmark_all_preamble_bitmap_u16_aligned(void)
+{
+    fprintf(stderr, "==== preamble_bitmap_u16_aligned ===\n");
+    starch_preamble_bitmap_u16_aligned_benchmark ();
+}
+static void starch_benchmark_all_resample_u16(void)
+{
+    fprintf(stderr, "==== resample_u16 ===\n");
+    starch_resample_u16_benchmark ();
+}
+static void starch_benchmark_all_resample_u16_aligned(void)
+{
+    fprintf(stderr, "==== resample_u16_aligned ===\n");
+    starch_resample_u16_aligned_benchmark ();
+}
 
 static int starch_benchmark_compare_result(const void *a, const void *b)
 {
@@ -1626,11 +3986,28 @@ static void starch_benchmark_usage(const char *argv0)
 #endif
 #ifdef STARCH_FLAVOR_X86_AVX2
           "x86_avx2 "
+#endif
+#ifdef STARCH_FLAVOR_X86_AVX512
+          "x86_avx512 "
 #endif
           "\n"
         "Supported functions: "
+          "block_max_u16 "
+          "block_max_u16_aligned "
           "count_above_u16 "
           "count_above_u16_aligned "
+          "histogram_log_u16 "
+          "histogram_log_u16_aligned "
+          "magnitude_dc_power_preamble_uc8 "
+          "magnitude_dc_power_preamble_uc8_aligned "
+          "magnitude_dc_sc16 "
+          "magnitude_dc_sc16_aligned "
+          "magnitude_dc_sc16q11 "
+          "magnitude_dc_sc16q11_aligned "
+          "magnitude_dc_uc8 "
+          "magnitude_dc_uc8_aligned "
+          "magnitude_power_preamble_uc8 "
+          "magnitude_power_preamble_uc8_aligned "
           "magnitude_power_uc8 "
           "magnitude_power_uc8_aligned "
           "magnitude_sc16 "
@@ -1641,6 +4018,12 @@ static void starch_benchmark_usage(const char *argv0)
           "magnitude_uc8_aligned "
           "mean_power_u16 "
           "mean_power_u16_aligned "
+          "modeac_scan_u16 "
+          "modeac_scan_u16_aligned "
+          "preamble_bitmap_u16 "
+          "preamble_bitmap_u16_aligned "
+          "resample_u16 "
+          "resample_u16_aligned "
           "\n", argv0);
 }
 
@@ -1726,6 +4109,16 @@ int main(int argc, char **argv)
     }
 
     for (int i = optind; i < argc; ++i) {
+        if (!strcmp(argv[i], "block_max_u16")) {
+            specific = 1;
+            starch_benchmark_all_block_max_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "block_max_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_block_max_u16_aligned();
+            continue;
+        }
         if (!strcmp(argv[i], "count_above_u16")) {
             specific = 1;
             starch_benchmark_all_count_above_u16();
@@ -1736,6 +4129,66 @@ int main(int argc, char **argv)
             starch_benchmark_all_count_above_u16_aligned();
             continue;
         }
+        if (!strcmp(argv[i], "histogram_log_u16")) {
+            specific = 1;
+            starch_benchmark_all_histogram_log_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "histogram_log_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_histogram_log_u16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_power_preamble_uc8")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_power_preamble_uc8();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_power_preamble_uc8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_power_preamble_uc8_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16q11")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16q11();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16q11_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16q11_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_uc8")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_uc8();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_uc8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_uc8_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_preamble_uc8")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_preamble_uc8();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_preamble_uc8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_preamble_uc8_aligned();
+            continue;
+        }
         if (!strcmp(argv[i], "magnitude_power_uc8")) {
             specific = 1;
             starch_benchmark_all_magnitude_power_uc8();
@@ -1786,14 +4239,58 @@ int main(int argc, char **argv)
             starch_benchmark_all_mean_power_u16_aligned();
             continue;
         }
+        if (!strcmp(argv[i], "modeac_scan_u16")) {
+            specific = 1;
+            starch_benchmark_all_modeac_scan_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "modeac_scan_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_modeac_scan_u16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_bitmap_u16")) {
+            specific = 1;
+            starch_benchmark_all_preamble_bitmap_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_bitmap_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_preamble_bitmap_u16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "resample_u16")) {
+            specific = 1;
+            starch_benchmark_all_resample_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "resample_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_resample_u16_aligned();
+            continue;
+        }
 
         fprintf(stderr, "%s: unrecognized function name: %s\n", argv[0], argv[i]);
         return 2;
     }
 
     if (!specific) {
+        starch_benchmark_all_block_max_u16();
+        starch_benchmark_all_block_max_u16_aligned();
         starch_benchmark_all_count_above_u16();
         starch_benchmark_all_count_above_u16_aligned();
+        starch_benchmark_all_histogram_log_u16();
+        starch_benchmark_all_histogram_log_u16_aligned();
+        starch_benchmark_all_magnitude_dc_power_preamble_uc8();
+        starch_benchmark_all_magnitude_dc_power_preamble_uc8_aligned();
+        starch_benchmark_all_magnitude_dc_sc16();
+        starch_benchmark_all_magnitude_dc_sc16_aligned();
+        starch_benchmark_all_magnitude_dc_sc16q11();
+        starch_benchmark_all_magnitude_dc_sc16q11_aligned();
+        starch_benchmark_all_magnitude_dc_uc8();
+        starch_benchmark_all_magnitude_dc_uc8_aligned();
+        starch_benchmark_all_magnitude_power_preamble_uc8();
+        starch_benchmark_all_magnitude_power_preamble_uc8_aligned();
         starch_benchmark_all_magnitude_power_uc8();
         starch_benchmark_all_magnitude_power_uc8_aligned();
         starch_benchmark_all_magnitude_sc16();
@@ -1804,6 +4301,12 @@ int main(int argc, char **argv)
         starch_benchmark_all_magnitude_uc8_aligned();
         starch_benchmark_all_mean_power_u16();
         starch_benchmark_all_mean_power_u16_aligned();
+        starch_benchmark_all_modeac_scan_u16();
+        starch_benchmark_all_modeac_scan_u16_aligned();
+        starch_benchmark_all_preamble_bitmap_u16();
+        starch_benchmark_all_preamble_bitmap_u16_aligned();
+        starch_benchmark_all_resample_u16();
+        starch_benchmark_all_resample_u16_aligned();
     }
 
     if (output_path) {
@@ -19,10 +19,10 @@ static int starch_regentry_rank_compare (const void *l, const void *r)
     return left->rank - right->rank;
 }
 
-/* dispatcher / registry for count_above_u16 */
+/* dispatcher / registry for block_max_u16 */
 
-starch_count_above_u16_regentry * starch_count_above_u16_select() {
-    for (starch_count_above_u16_regentry *entry = starch_count_above_u16_registry;
+starch_block_max_u16_regentry * starch_block_max_u16_select() {
+    for (starch_block_max_u16_regentry *entry = starch_block_max_u16_registry;
          entry->name;
          ++entry)
     {
@@ -33,22 +33,22 @@ starch_count_above_u16_regentry * starch_count_above_u16_select() {
     return NULL;
 }
 
-static void starch_count_above_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 ) {
-    starch_count_above_u16_regentry *entry = starch_count_above_u16_select();
+static void starch_block_max_u16_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 ) {
+    starch_block_max_u16_regentry *entry = starch_block_max_u16_select();
     if (!entry)
         abort();
 
-    starch_count_above_u16 = entry->callable;
-    starch_count_above_u16 ( arg0, arg1, arg2, arg3 );
+    starch_block_max_u16 = entry->callable;
+    starch_block_max_u16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_count_above_u16_ptr starch_count_above_u16 = starch_count_above_u16_dispatch;
+starch_block_max_u16_ptr starch_block_max_u16 = starch_block_max_u16_dispatch;
 
-void starch_count_above_u16_set_wisdom (const char * const * received_wisdom)
+void starch_block_max_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_count_above_u16_regentry *entry;
-    for (entry = starch_count_above_u16_registry; entry->name; ++entry) {
+    starch_block_max_u16_regentry *entry;
+    for (entry = starch_block_max_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -60,46 +60,47 @@ void starch_count_above_u16_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_count_above_u16_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_block_max_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_count_above_u16_registry, entry - starch_count_above_u16_registry, sizeof(starch_count_above_u16_regentry), starch_regentry_rank_compare);
+    qsort(starch_block_max_u16_registry, entry - starch_block_max_u16_registry, sizeof(starch_block_max_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_count_above_u16 = starch_count_above_u16_dispatch;
+    starch_block_max_u16 = starch_block_max_u16_dispatch;
 }
 
-starch_count_above_u16_regentry starch_count_above_u16_registry[] = {
+starch_block_max_u16_regentry starch_block_max_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "generic_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "neon_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 2, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_block_max_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_block_max_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
-    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_block_max_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_block_max_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 0, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
-    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 0, "generic_x86_avx512", "x86_avx512", starch_block_max_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 1, "generic_x86_avx2", "x86_avx2", starch_block_max_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for count_above_u16_aligned */
+/* dispatcher / registry for block_max_u16_aligned */
 
-starch_count_above_u16_aligned_regentry * starch_count_above_u16_aligned_select() {
-    for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry;
+starch_block_max_u16_aligned_regentry * starch_block_max_u16_aligned_select() {
+    for (starch_block_max_u16_aligned_regentry *entry = starch_block_max_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -110,22 +111,22 @@ starch_count_above_u16_aligned_regentry * starch_count_above_u16_aligned_select(
     return NULL;
 }
 
-static void starch_count_above_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 ) {
-    starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_select();
+static void starch_block_max_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint16_t * arg3 ) {
+    starch_block_max_u16_aligned_regentry *entry = starch_block_max_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_count_above_u16_aligned = entry->callable;
-    starch_count_above_u16_aligned ( arg0, arg1, arg2, arg3 );
+    starch_block_max_u16_aligned = entry->callable;
+    starch_block_max_u16_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_count_above_u16_aligned_ptr starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
+starch_block_max_u16_aligned_ptr starch_block_max_u16_aligned = starch_block_max_u16_aligned_dispatch;
 
-void starch_count_above_u16_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_block_max_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_count_above_u16_aligned_regentry *entry;
-    for (entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
+    starch_block_max_u16_aligned_regentry *entry;
+    for (entry = starch_block_max_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -137,51 +138,53 @@ void starch_count_above_u16_aligned_set_wisdom (const char * const * received_wi
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_count_above_u16_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_block_max_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_count_above_u16_aligned_registry, entry - starch_count_above_u16_aligned_registry, sizeof(starch_count_above_u16_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_block_max_u16_aligned_registry, entry - starch_block_max_u16_aligned_registry, sizeof(starch_block_max_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
+    starch_block_max_u16_aligned = starch_block_max_u16_aligned_dispatch;
 }
 
-starch_count_above_u16_aligned_regentry starch_count_above_u16_aligned_registry[] = {
+starch_block_max_u16_aligned_regentry starch_block_max_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_count_above_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_count_above_u16_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "neon_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 0, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_block_max_u16_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_block_max_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_armv8_neon_simd", "armv8_neon_simd", starch_block_max_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_armv8_neon_simd", "armv8_neon_simd", starch_block_max_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
-    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_count_above_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_count_above_u16_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 0, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_block_max_u16_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_block_max_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_block_max_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_block_max_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 0, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "generic_x86_avx2_aligned", "x86_avx2", starch_count_above_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
-    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
-    { 2, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 0, "generic_x86_avx512_aligned", "x86_avx512", starch_block_max_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 1, "generic_x86_avx2_aligned", "x86_avx2", starch_block_max_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_block_max_u16_generic_generic, NULL },
+    { 3, "generic_x86_avx512", "x86_avx512", starch_block_max_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx2", "x86_avx2", starch_block_max_u16_generic_x86_avx2, cpu_supports_avx2 },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_power_uc8 */
+/* dispatcher / registry for count_above_u16 */
 
-starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
-    for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry;
+starch_count_above_u16_regentry * starch_count_above_u16_select() {
+    for (starch_count_above_u16_regentry *entry = starch_count_above_u16_registry;
          entry->name;
          ++entry)
     {
@@ -192,22 +195,22 @@ starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
     return NULL;
 }
 
-static void starch_magnitude_power_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
-    starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_select();
+static void starch_count_above_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 ) {
+    starch_count_above_u16_regentry *entry = starch_count_above_u16_select();
     if (!entry)
         abort();
 
-    starch_magnitude_power_uc8 = entry->callable;
-    starch_magnitude_power_uc8 ( arg0, arg1, arg2, arg3, arg4 );
+    starch_count_above_u16 = entry->callable;
+    starch_count_above_u16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_power_uc8_ptr starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+starch_count_above_u16_ptr starch_count_above_u16 = starch_count_above_u16_dispatch;
 
-void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom)
+void starch_count_above_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_power_uc8_regentry *entry;
-    for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
+    starch_count_above_u16_regentry *entry;
+    for (entry = starch_count_above_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -219,60 +222,48 @@ void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_count_above_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_power_uc8_registry, entry - starch_magnitude_power_uc8_registry, sizeof(starch_magnitude_power_uc8_regentry), starch_regentry_rank_compare);
+    qsort(starch_count_above_u16_registry, entry - starch_count_above_u16_registry, sizeof(starch_count_above_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+    starch_count_above_u16 = starch_count_above_u16_dispatch;
 }
 
-starch_magnitude_power_uc8_regentry starch_magnitude_power_uc8_registry[] = {
+starch_count_above_u16_regentry starch_count_above_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
-    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 5, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "avx512_x86_avx512", "x86_avx512", starch_count_above_u16_avx512_x86_avx512, cpu_supports_avx512 },
+    { 1, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 3, "generic_x86_avx512", "x86_avx512", starch_count_above_u16_generic_x86_avx512, cpu_supports_avx512 },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_power_uc8_aligned */
+/* dispatcher / registry for count_above_u16_aligned */
 
-starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned_select() {
-    for (starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_registry;
+starch_count_above_u16_aligned_regentry * starch_count_above_u16_aligned_select() {
+    for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -283,22 +274,22 @@ starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned
     return NULL;
 }
 
-static void starch_magnitude_power_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
-    starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_select();
+static void starch_count_above_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 ) {
+    starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_power_uc8_aligned = entry->callable;
-    starch_magnitude_power_uc8_aligned ( arg0, arg1, arg2, arg3, arg4 );
+    starch_count_above_u16_aligned = entry->callable;
+    starch_count_above_u16_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_power_uc8_aligned_ptr starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+starch_count_above_u16_aligned_ptr starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
 
-void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_count_above_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_power_uc8_aligned_regentry *entry;
-    for (entry = starch_magnitude_power_uc8_aligned_registry; entry->name; ++entry) {
+    starch_count_above_u16_aligned_regentry *entry;
+    for (entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -310,71 +301,55 @@ void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * receive
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_count_above_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_power_uc8_aligned_registry, entry - starch_magnitude_power_uc8_aligned_registry, sizeof(starch_magnitude_power_uc8_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_count_above_u16_aligned_registry, entry - starch_count_above_u16_aligned_registry, sizeof(starch_count_above_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+    starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
 }
 
-starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_aligned_registry[] = {
+starch_count_above_u16_aligned_regentry starch_count_above_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_count_above_u16_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_count_above_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_armv8_neon_simd", "armv8_neon_simd", starch_count_above_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_count_above_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_count_above_u16_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_count_above_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
-    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 8, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "avx512_x86_avx512_aligned", "x86_avx512", starch_count_above_u16_aligned_avx512_x86_avx512, cpu_supports_avx512 },
+    { 1, "generic_x86_avx2_aligned", "x86_avx2", starch_count_above_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "generic_generic", "generic", starch_count_above_u16_generic_generic, NULL },
+    { 3, "generic_x86_avx512_aligned", "x86_avx512", starch_count_above_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx512", "x86_avx512", starch_count_above_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 5, "avx512_x86_avx512", "x86_avx512", starch_count_above_u16_avx512_x86_avx512, cpu_supports_avx512 },
+    { 6, "generic_x86_avx2", "x86_avx2", starch_count_above_u16_generic_x86_avx2, cpu_supports_avx2 },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16 */
+/* dispatcher / registry for histogram_log_u16 */
 
-starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
-    for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry;
+starch_histogram_log_u16_regentry * starch_histogram_log_u16_select() {
+    for (starch_histogram_log_u16_regentry *entry = starch_histogram_log_u16_registry;
          entry->name;
          ++entry)
     {
@@ -385,22 +360,22 @@ starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
     return NULL;
 }
 
-static void starch_magnitude_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_select();
+static void starch_histogram_log_u16_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 ) {
+    starch_histogram_log_u16_regentry *entry = starch_histogram_log_u16_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16 = entry->callable;
-    starch_magnitude_sc16 ( arg0, arg1, arg2 );
+    starch_histogram_log_u16 = entry->callable;
+    starch_histogram_log_u16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16_ptr starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+starch_histogram_log_u16_ptr starch_histogram_log_u16 = starch_histogram_log_u16_dispatch;
 
-void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
+void starch_histogram_log_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16_regentry *entry;
-    for (entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
+    starch_histogram_log_u16_regentry *entry;
+    for (entry = starch_histogram_log_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -412,53 +387,53 @@ void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_histogram_log_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16_registry, entry - starch_magnitude_sc16_registry, sizeof(starch_magnitude_sc16_regentry), starch_regentry_rank_compare);
+    qsort(starch_histogram_log_u16_registry, entry - starch_histogram_log_u16_registry, sizeof(starch_histogram_log_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+    starch_histogram_log_u16 = starch_histogram_log_u16_dispatch;
 }
 
-starch_magnitude_sc16_regentry starch_magnitude_sc16_registry[] = {
+starch_histogram_log_u16_regentry starch_histogram_log_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_armv8_neon_simd", "armv8_neon_simd", starch_histogram_log_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_histogram_log_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_histogram_log_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_histogram_log_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 1, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_x86_avx2", "x86_avx2", starch_histogram_log_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx512", "x86_avx512", starch_histogram_log_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 3, "blocked_x86_avx512", "x86_avx512", starch_histogram_log_u16_blocked_x86_avx512, cpu_supports_avx512 },
+    { 4, "blocked_x86_avx2", "x86_avx2", starch_histogram_log_u16_blocked_x86_avx2, cpu_supports_avx2 },
+    { 5, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16_aligned */
+/* dispatcher / registry for histogram_log_u16_aligned */
 
-starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select() {
-    for (starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_registry;
+starch_histogram_log_u16_aligned_regentry * starch_histogram_log_u16_aligned_select() {
+    for (starch_histogram_log_u16_aligned_regentry *entry = starch_histogram_log_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -469,22 +444,22 @@ starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select()
     return NULL;
 }
 
-static void starch_magnitude_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_select();
+static void starch_histogram_log_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3 ) {
+    starch_histogram_log_u16_aligned_regentry *entry = starch_histogram_log_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16_aligned = entry->callable;
-    starch_magnitude_sc16_aligned ( arg0, arg1, arg2 );
+    starch_histogram_log_u16_aligned = entry->callable;
+    starch_histogram_log_u16_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16_aligned_ptr starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+starch_histogram_log_u16_aligned_ptr starch_histogram_log_u16_aligned = starch_histogram_log_u16_aligned_dispatch;
 
-void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_histogram_log_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16_aligned_regentry *entry;
-    for (entry = starch_magnitude_sc16_aligned_registry; entry->name; ++entry) {
+    starch_histogram_log_u16_aligned_regentry *entry;
+    for (entry = starch_histogram_log_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -496,61 +471,61 @@ void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wis
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_histogram_log_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16_aligned_registry, entry - starch_magnitude_sc16_aligned_registry, sizeof(starch_magnitude_sc16_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_histogram_log_u16_aligned_registry, entry - starch_histogram_log_u16_aligned_registry, sizeof(starch_histogram_log_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+    starch_histogram_log_u16_aligned = starch_histogram_log_u16_aligned_dispatch;
 }
 
-starch_magnitude_sc16_aligned_regentry starch_magnitude_sc16_aligned_registry[] = {
+starch_histogram_log_u16_aligned_regentry starch_histogram_log_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_histogram_log_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "blocked_armv8_neon_simd_aligned", "armv8_neon_simd", starch_histogram_log_u16_aligned_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_armv8_neon_simd", "armv8_neon_simd", starch_histogram_log_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_histogram_log_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_histogram_log_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "blocked_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_histogram_log_u16_aligned_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_histogram_log_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_histogram_log_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 1, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "generic_x86_avx2_aligned", "x86_avx2", starch_histogram_log_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_generic", "generic", starch_histogram_log_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx512_aligned", "x86_avx512", starch_histogram_log_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 3, "blocked_x86_avx512_aligned", "x86_avx512", starch_histogram_log_u16_aligned_blocked_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx512", "x86_avx512", starch_histogram_log_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 5, "blocked_x86_avx512", "x86_avx512", starch_histogram_log_u16_blocked_x86_avx512, cpu_supports_avx512 },
+    { 6, "blocked_x86_avx2_aligned", "x86_avx2", starch_histogram_log_u16_aligned_blocked_x86_avx2, cpu_supports_avx2 },
+    { 7, "generic_x86_avx2", "x86_avx2", starch_histogram_log_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 8, "blocked_x86_avx2", "x86_avx2", starch_histogram_log_u16_blocked_x86_avx2, cpu_supports_avx2 },
+    { 9, "blocked_generic", "generic", starch_histogram_log_u16_blocked_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16q11 */
+/* dispatcher / registry for magnitude_dc_power_preamble_uc8 */
 
-starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
-    for (starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_registry;
+starch_magnitude_dc_power_preamble_uc8_regentry * starch_magnitude_dc_power_preamble_uc8_select() {
+    for (starch_magnitude_dc_power_preamble_uc8_regentry *entry = starch_magnitude_dc_power_preamble_uc8_registry;
          entry->name;
          ++entry)
     {
@@ -561,22 +536,22 @@ starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
     return NULL;
 }
 
-static void starch_magnitude_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_select();
+static void starch_magnitude_dc_power_preamble_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 ) {
+    starch_magnitude_dc_power_preamble_uc8_regentry *entry = starch_magnitude_dc_power_preamble_uc8_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16q11 = entry->callable;
-    starch_magnitude_sc16q11 ( arg0, arg1, arg2 );
+    starch_magnitude_dc_power_preamble_uc8 = entry->callable;
+    starch_magnitude_dc_power_preamble_uc8 ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
 }
 
-starch_magnitude_sc16q11_ptr starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+starch_magnitude_dc_power_preamble_uc8_ptr starch_magnitude_dc_power_preamble_uc8 = starch_magnitude_dc_power_preamble_uc8_dispatch;
 
-void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_power_preamble_uc8_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16q11_regentry *entry;
-    for (entry = starch_magnitude_sc16q11_registry; entry->name; ++entry) {
+    starch_magnitude_dc_power_preamble_uc8_regentry *entry;
+    for (entry = starch_magnitude_dc_power_preamble_uc8_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -588,33 +563,1240 @@ void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_power_preamble_uc8_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16q11_registry, entry - starch_magnitude_sc16q11_registry, sizeof(starch_magnitude_sc16q11_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_power_preamble_uc8_registry, entry - starch_magnitude_dc_power_preamble_uc8_registry, sizeof(starch_magnitude_dc_power_preamble_uc8_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+    starch_magnitude_dc_power_preamble_uc8 = starch_magnitude_dc_power_preamble_uc8_dispatch;
 }
 
-starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
+starch_magnitude_dc_power_preamble_uc8_regentry starch_magnitude_dc_power_preamble_uc8_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 2, "fused_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_fused_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 0, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 2, "fused_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_fused_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 1, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "fused_x86_avx512", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_fused_x86_avx512, cpu_supports_avx512 },
+    { 1, "twopass_x86_avx2", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_x86_avx512", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 4, "fused_x86_avx2", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_fused_x86_avx2, cpu_supports_avx2 },
+    { 5, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_power_preamble_uc8_aligned */
+
+starch_magnitude_dc_power_preamble_uc8_aligned_regentry * starch_magnitude_dc_power_preamble_uc8_aligned_select() {
+    for (starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_power_preamble_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3, double * arg4, double * arg5, uint64_t * arg6 ) {
+    starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_dc_power_preamble_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_power_preamble_uc8_aligned = entry->callable;
+    starch_magnitude_dc_power_preamble_uc8_aligned ( arg0, arg1, arg2, arg3, arg4, arg5, arg6 );
+}
+
+starch_magnitude_dc_power_preamble_uc8_aligned_ptr starch_magnitude_dc_power_preamble_uc8_aligned = starch_magnitude_dc_power_preamble_uc8_aligned_dispatch;
+
+void starch_magnitude_dc_power_preamble_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_power_preamble_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_power_preamble_uc8_aligned_registry, entry - starch_magnitude_dc_power_preamble_uc8_aligned_registry, sizeof(starch_magnitude_dc_power_preamble_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_power_preamble_uc8_aligned = starch_magnitude_dc_power_preamble_uc8_aligned_dispatch;
+}
+
+starch_magnitude_dc_power_preamble_uc8_aligned_regentry starch_magnitude_dc_power_preamble_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 2, "fused_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_aligned_fused_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "fused_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_power_preamble_uc8_fused_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 2, "fused_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_aligned_fused_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "fused_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_power_preamble_uc8_fused_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 1, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "fused_x86_avx512_aligned", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_aligned_fused_x86_avx512, cpu_supports_avx512 },
+    { 1, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_generic", "generic", starch_magnitude_dc_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_x86_avx512_aligned", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_aligned_twopass_x86_avx512, cpu_supports_avx512 },
+    { 4, "twopass_x86_avx512", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 5, "fused_x86_avx512", "x86_avx512", starch_magnitude_dc_power_preamble_uc8_fused_x86_avx512, cpu_supports_avx512 },
+    { 6, "fused_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_aligned_fused_x86_avx2, cpu_supports_avx2 },
+    { 7, "twopass_x86_avx2", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 8, "fused_x86_avx2", "x86_avx2", starch_magnitude_dc_power_preamble_uc8_fused_x86_avx2, cpu_supports_avx2 },
+    { 9, "fused_generic", "generic", starch_magnitude_dc_power_preamble_uc8_fused_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16 */
+
+starch_magnitude_dc_sc16_regentry * starch_magnitude_dc_sc16_select() {
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16 = entry->callable;
+    starch_magnitude_dc_sc16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_sc16_ptr starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+
+void starch_magnitude_dc_sc16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+}
+
+starch_magnitude_dc_sc16_regentry starch_magnitude_dc_sc16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_sc16_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16_aligned */
+
+starch_magnitude_dc_sc16_aligned_regentry * starch_magnitude_dc_sc16_aligned_select() {
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16_aligned = entry->callable;
+    starch_magnitude_dc_sc16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_sc16_aligned_ptr starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+
+void starch_magnitude_dc_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+}
+
+starch_magnitude_dc_sc16_aligned_regentry starch_magnitude_dc_sc16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512_aligned", "x86_avx512", starch_magnitude_dc_sc16_aligned_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16_float_generic, NULL },
+    { 3, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_sc16_float_x86_avx512, cpu_supports_avx512 },
+    { 4, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_float_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16q11 */
+
+starch_magnitude_dc_sc16q11_regentry * starch_magnitude_dc_sc16q11_select() {
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16q11 = entry->callable;
+    starch_magnitude_dc_sc16q11 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_sc16q11_ptr starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+
+void starch_magnitude_dc_sc16q11_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+}
+
+starch_magnitude_dc_sc16q11_regentry starch_magnitude_dc_sc16q11_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_sc16q11_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_sc16q11_aligned */
+
+starch_magnitude_dc_sc16q11_aligned_regentry * starch_magnitude_dc_sc16q11_aligned_select() {
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_sc16q11_aligned = entry->callable;
+    starch_magnitude_dc_sc16q11_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_sc16q11_aligned_ptr starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+
+void starch_magnitude_dc_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+}
+
+starch_magnitude_dc_sc16q11_aligned_regentry starch_magnitude_dc_sc16q11_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512_aligned", "x86_avx512", starch_magnitude_dc_sc16q11_aligned_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16q11_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_sc16q11_float_generic, NULL },
+    { 3, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_sc16q11_float_x86_avx512, cpu_supports_avx512 },
+    { 4, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_float_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_uc8 */
+
+starch_magnitude_dc_uc8_regentry * starch_magnitude_dc_uc8_select() {
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_uc8 = entry->callable;
+    starch_magnitude_dc_uc8 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_uc8_ptr starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+
+void starch_magnitude_dc_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_uc8_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+}
+
+starch_magnitude_dc_uc8_regentry starch_magnitude_dc_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_uc8_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_uc8_aligned */
+
+starch_magnitude_dc_uc8_aligned_regentry * starch_magnitude_dc_uc8_aligned_select() {
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_filter_t * arg3 ) {
+    starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_uc8_aligned = entry->callable;
+    starch_magnitude_dc_uc8_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_uc8_aligned_ptr starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+
+void starch_magnitude_dc_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+}
+
+starch_magnitude_dc_uc8_aligned_regentry starch_magnitude_dc_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_float_armv8_neon_simd, cpu_supports_armv8_simd },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "float_x86_avx512_aligned", "x86_avx512", starch_magnitude_dc_uc8_aligned_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_uc8_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "float_generic", "generic", starch_magnitude_dc_uc8_float_generic, NULL },
+    { 3, "float_x86_avx512", "x86_avx512", starch_magnitude_dc_uc8_float_x86_avx512, cpu_supports_avx512 },
+    { 4, "float_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_float_x86_avx2, cpu_supports_avx2 },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_preamble_uc8 */
+
+starch_magnitude_power_preamble_uc8_regentry * starch_magnitude_power_preamble_uc8_select() {
+    for (starch_magnitude_power_preamble_uc8_regentry *entry = starch_magnitude_power_preamble_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_preamble_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 ) {
+    starch_magnitude_power_preamble_uc8_regentry *entry = starch_magnitude_power_preamble_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_preamble_uc8 = entry->callable;
+    starch_magnitude_power_preamble_uc8 ( arg0, arg1, arg2, arg3, arg4, arg5 );
+}
+
+starch_magnitude_power_preamble_uc8_ptr starch_magnitude_power_preamble_uc8 = starch_magnitude_power_preamble_uc8_dispatch;
+
+void starch_magnitude_power_preamble_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_preamble_uc8_regentry *entry;
+    for (entry = starch_magnitude_power_preamble_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_preamble_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_preamble_uc8_registry, entry - starch_magnitude_power_preamble_uc8_registry, sizeof(starch_magnitude_power_preamble_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_preamble_uc8 = starch_magnitude_power_preamble_uc8_dispatch;
+}
+
+starch_magnitude_power_preamble_uc8_regentry starch_magnitude_power_preamble_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "chunked_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_chunked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "chunked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_chunked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 1, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_preamble_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "chunked_x86_avx2", "x86_avx2", starch_magnitude_power_preamble_uc8_chunked_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_x86_avx512", "x86_avx512", starch_magnitude_power_preamble_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 4, "chunked_x86_avx512", "x86_avx512", starch_magnitude_power_preamble_uc8_chunked_x86_avx512, cpu_supports_avx512 },
+    { 5, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_preamble_uc8_aligned */
+
+starch_magnitude_power_preamble_uc8_aligned_regentry * starch_magnitude_power_preamble_uc8_aligned_select() {
+    for (starch_magnitude_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_power_preamble_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_preamble_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4, uint64_t * arg5 ) {
+    starch_magnitude_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_power_preamble_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_preamble_uc8_aligned = entry->callable;
+    starch_magnitude_power_preamble_uc8_aligned ( arg0, arg1, arg2, arg3, arg4, arg5 );
+}
+
+starch_magnitude_power_preamble_uc8_aligned_ptr starch_magnitude_power_preamble_uc8_aligned = starch_magnitude_power_preamble_uc8_aligned_dispatch;
+
+void starch_magnitude_power_preamble_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_preamble_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_preamble_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_preamble_uc8_aligned_registry, entry - starch_magnitude_power_preamble_uc8_aligned_registry, sizeof(starch_magnitude_power_preamble_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_preamble_uc8_aligned = starch_magnitude_power_preamble_uc8_aligned_dispatch;
+}
+
+starch_magnitude_power_preamble_uc8_aligned_regentry starch_magnitude_power_preamble_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "chunked_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_aligned_chunked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "chunked_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_preamble_uc8_chunked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "chunked_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_aligned_chunked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "chunked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_preamble_uc8_chunked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 1, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_preamble_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "chunked_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_preamble_uc8_aligned_chunked_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_preamble_uc8_twopass_generic, NULL },
+    { 3, "twopass_x86_avx512_aligned", "x86_avx512", starch_magnitude_power_preamble_uc8_aligned_twopass_x86_avx512, cpu_supports_avx512 },
+    { 4, "chunked_x86_avx512_aligned", "x86_avx512", starch_magnitude_power_preamble_uc8_aligned_chunked_x86_avx512, cpu_supports_avx512 },
+    { 5, "twopass_x86_avx512", "x86_avx512", starch_magnitude_power_preamble_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 6, "chunked_x86_avx512", "x86_avx512", starch_magnitude_power_preamble_uc8_chunked_x86_avx512, cpu_supports_avx512 },
+    { 7, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_preamble_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 8, "chunked_x86_avx2", "x86_avx2", starch_magnitude_power_preamble_uc8_chunked_x86_avx2, cpu_supports_avx2 },
+    { 9, "chunked_generic", "generic", starch_magnitude_power_preamble_uc8_chunked_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8 */
+
+starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
+    for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8 = entry->callable;
+    starch_magnitude_power_uc8 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_ptr starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+
+void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_registry, entry - starch_magnitude_power_uc8_registry, sizeof(starch_magnitude_power_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+}
+
+starch_magnitude_power_uc8_regentry starch_magnitude_power_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 2, "twopass_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 3, "lookup_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_lookup_x86_avx512, cpu_supports_avx512 },
+    { 4, "lookup_unroll_4_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 8, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8_aligned */
+
+starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned_select() {
+    for (starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8_aligned = entry->callable;
+    starch_magnitude_power_uc8_aligned ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_aligned_ptr starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+
+void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_aligned_registry, entry - starch_magnitude_power_uc8_aligned_registry, sizeof(starch_magnitude_power_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+}
+
+starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 2, "twopass_x86_avx512_aligned", "x86_avx512", starch_magnitude_power_uc8_aligned_twopass_x86_avx512, cpu_supports_avx512 },
+    { 3, "lookup_x86_avx512_aligned", "x86_avx512", starch_magnitude_power_uc8_aligned_lookup_x86_avx512, cpu_supports_avx512 },
+    { 4, "lookup_unroll_4_x86_avx512_aligned", "x86_avx512", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 5, "twopass_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_twopass_x86_avx512, cpu_supports_avx512 },
+    { 6, "lookup_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_lookup_x86_avx512, cpu_supports_avx512 },
+    { 7, "lookup_unroll_4_x86_avx512", "x86_avx512", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 8, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
+    { 9, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 10, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 11, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 12, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 13, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 14, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16 */
+
+starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
+    for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16 = entry->callable;
+    starch_magnitude_sc16 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16_ptr starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+
+void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16_regentry *entry;
+    for (entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16_registry, entry - starch_magnitude_sc16_registry, sizeof(starch_magnitude_sc16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+}
+
+starch_magnitude_sc16_regentry starch_magnitude_sc16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx512_float_x86_avx512", "x86_avx512", starch_magnitude_sc16_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 3, "exact_u32_x86_avx512", "x86_avx512", starch_magnitude_sc16_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_float_x86_avx512", "x86_avx512", starch_magnitude_sc16_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16_aligned */
+
+starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select() {
+    for (starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16_aligned = entry->callable;
+    starch_magnitude_sc16_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16_aligned_ptr starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+
+void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_sc16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16_aligned_registry, entry - starch_magnitude_sc16_aligned_registry, sizeof(starch_magnitude_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+}
+
+starch_magnitude_sc16_aligned_regentry starch_magnitude_sc16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx512_float_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16_aligned_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 3, "exact_u32_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16_aligned_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_float_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16_aligned_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "exact_u32_x86_avx512", "x86_avx512", starch_magnitude_sc16_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 6, "exact_float_x86_avx512", "x86_avx512", starch_magnitude_sc16_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 7, "avx512_float_x86_avx512", "x86_avx512", starch_magnitude_sc16_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 8, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 9, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 10, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16q11 */
+
+starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
+    for (starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16q11 = entry->callable;
+    starch_magnitude_sc16q11 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16q11_ptr starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+
+void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_sc16q11_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16q11_registry, entry - starch_magnitude_sc16q11_registry, sizeof(starch_magnitude_sc16q11_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+}
+
+starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
     { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
     { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
     { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
@@ -626,29 +1808,647 @@ starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx512_float_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 3, "exact_u32_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_float_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "11bit_table_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_11bit_table_x86_avx512, cpu_supports_avx512 },
+    { 6, "12bit_table_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_12bit_table_x86_avx512, cpu_supports_avx512 },
+    { 7, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 8, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 9, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 10, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 11, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 12, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16q11_aligned */
+
+starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_select() {
+    for (starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16q11_aligned = entry->callable;
+    starch_magnitude_sc16q11_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16q11_aligned_ptr starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+
+void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_sc16q11_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16q11_aligned_registry, entry - starch_magnitude_sc16q11_aligned_registry, sizeof(starch_magnitude_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+}
+
+starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "12bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 10, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "11bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "12bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 10, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "avx512_float_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16q11_aligned_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 1, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 3, "exact_u32_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_float_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16q11_aligned_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "11bit_table_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx512, cpu_supports_avx512 },
+    { 6, "12bit_table_x86_avx512_aligned", "x86_avx512", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx512, cpu_supports_avx512 },
+    { 7, "exact_u32_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_exact_u32_x86_avx512, cpu_supports_avx512 },
+    { 8, "exact_float_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_exact_float_x86_avx512, cpu_supports_avx512 },
+    { 9, "11bit_table_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_11bit_table_x86_avx512, cpu_supports_avx512 },
+    { 10, "12bit_table_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_12bit_table_x86_avx512, cpu_supports_avx512 },
+    { 11, "avx512_float_x86_avx512", "x86_avx512", starch_magnitude_sc16q11_avx512_float_x86_avx512, cpu_supports_avx512 },
+    { 12, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 13, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 14, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 15, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 16, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 17, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 18, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 19, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 20, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 21, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_uc8 */
+
+starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
+    for (starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_uc8 = entry->callable;
+    starch_magnitude_uc8 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_uc8_ptr starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+
+void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_uc8_regentry *entry;
+    for (entry = starch_magnitude_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_uc8_registry, entry - starch_magnitude_uc8_registry, sizeof(starch_magnitude_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+}
+
+starch_magnitude_uc8_regentry starch_magnitude_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_x86_avx512", "x86_avx512", starch_magnitude_uc8_lookup_x86_avx512, cpu_supports_avx512 },
+    { 3, "lookup_unroll_4_x86_avx512", "x86_avx512", starch_magnitude_uc8_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_x86_avx512", "x86_avx512", starch_magnitude_uc8_exact_x86_avx512, cpu_supports_avx512 },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 7, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 8, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_uc8_aligned */
+
+starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
+    for (starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_uc8_aligned = entry->callable;
+    starch_magnitude_uc8_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_uc8_aligned_ptr starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+
+void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_uc8_aligned_registry, entry - starch_magnitude_uc8_aligned_registry, sizeof(starch_magnitude_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+}
+
+starch_magnitude_uc8_aligned_regentry starch_magnitude_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_x86_avx512_aligned", "x86_avx512", starch_magnitude_uc8_aligned_lookup_x86_avx512, cpu_supports_avx512 },
+    { 3, "lookup_unroll_4_x86_avx512_aligned", "x86_avx512", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 4, "exact_x86_avx512_aligned", "x86_avx512", starch_magnitude_uc8_aligned_exact_x86_avx512, cpu_supports_avx512 },
+    { 5, "lookup_x86_avx512", "x86_avx512", starch_magnitude_uc8_lookup_x86_avx512, cpu_supports_avx512 },
+    { 6, "lookup_unroll_4_x86_avx512", "x86_avx512", starch_magnitude_uc8_lookup_unroll_4_x86_avx512, cpu_supports_avx512 },
+    { 7, "exact_x86_avx512", "x86_avx512", starch_magnitude_uc8_exact_x86_avx512, cpu_supports_avx512 },
+    { 8, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
+    { 9, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 10, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
+    { 11, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 12, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 13, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 14, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for mean_power_u16 */
+
+starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
+    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_mean_power_u16_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
+    starch_mean_power_u16_regentry *entry = starch_mean_power_u16_select();
+    if (!entry)
+        abort();
+
+    starch_mean_power_u16 = entry->callable;
+    starch_mean_power_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_mean_power_u16_ptr starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+
+void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_mean_power_u16_regentry *entry;
+    for (entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_mean_power_u16_registry, entry - starch_mean_power_u16_registry, sizeof(starch_mean_power_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+}
+
+starch_mean_power_u16_regentry starch_mean_power_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "u32_x86_avx512", "x86_avx512", starch_mean_power_u16_u32_x86_avx512, cpu_supports_avx512 },
+    { 1, "avx512_x86_avx512", "x86_avx512", starch_mean_power_u16_avx512_x86_avx512, cpu_supports_avx512 },
+    { 2, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 4, "float_x86_avx512", "x86_avx512", starch_mean_power_u16_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "u64_x86_avx512", "x86_avx512", starch_mean_power_u16_u64_x86_avx512, cpu_supports_avx512 },
+    { 6, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
+    { 7, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 8, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 9, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for mean_power_u16_aligned */
+
+starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select() {
+    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_mean_power_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
+    starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_mean_power_u16_aligned = entry->callable;
+    starch_mean_power_u16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_mean_power_u16_aligned_ptr starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+
+void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_mean_power_u16_aligned_regentry *entry;
+    for (entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_mean_power_u16_aligned_registry, entry - starch_mean_power_u16_aligned_registry, sizeof(starch_mean_power_u16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+}
+
+starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "u64_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "u64_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "u32_x86_avx512_aligned", "x86_avx512", starch_mean_power_u16_aligned_u32_x86_avx512, cpu_supports_avx512 },
+    { 1, "avx512_x86_avx512_aligned", "x86_avx512", starch_mean_power_u16_aligned_avx512_x86_avx512, cpu_supports_avx512 },
+    { 2, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 4, "float_x86_avx512_aligned", "x86_avx512", starch_mean_power_u16_aligned_float_x86_avx512, cpu_supports_avx512 },
+    { 5, "u64_x86_avx512_aligned", "x86_avx512", starch_mean_power_u16_aligned_u64_x86_avx512, cpu_supports_avx512 },
+    { 6, "float_x86_avx512", "x86_avx512", starch_mean_power_u16_float_x86_avx512, cpu_supports_avx512 },
+    { 7, "u32_x86_avx512", "x86_avx512", starch_mean_power_u16_u32_x86_avx512, cpu_supports_avx512 },
+    { 8, "u64_x86_avx512", "x86_avx512", starch_mean_power_u16_u64_x86_avx512, cpu_supports_avx512 },
+    { 9, "avx512_x86_avx512", "x86_avx512", starch_mean_power_u16_avx512_x86_avx512, cpu_supports_avx512 },
+    { 10, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 11, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2 },
+    { 12, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
+    { 13, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
+    { 14, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 15, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 16, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for modeac_scan_u16 */
+
+starch_modeac_scan_u16_regentry * starch_modeac_scan_u16_select() {
+    for (starch_modeac_scan_u16_regentry *entry = starch_modeac_scan_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_modeac_scan_u16_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 ) {
+    starch_modeac_scan_u16_regentry *entry = starch_modeac_scan_u16_select();
+    if (!entry)
+        abort();
+
+    starch_modeac_scan_u16 = entry->callable;
+    starch_modeac_scan_u16 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_modeac_scan_u16_ptr starch_modeac_scan_u16 = starch_modeac_scan_u16_dispatch;
+
+void starch_modeac_scan_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_modeac_scan_u16_regentry *entry;
+    for (entry = starch_modeac_scan_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_modeac_scan_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_modeac_scan_u16_registry, entry - starch_modeac_scan_u16_registry, sizeof(starch_modeac_scan_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_modeac_scan_u16 = starch_modeac_scan_u16_dispatch;
+}
+
+starch_modeac_scan_u16_regentry starch_modeac_scan_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_modeac_scan_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_modeac_scan_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_modeac_scan_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_modeac_scan_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 1, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 6, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 7, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "blocked_x86_avx2", "x86_avx2", starch_modeac_scan_u16_blocked_x86_avx2, cpu_supports_avx2 },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_x86_avx512", "x86_avx512", starch_modeac_scan_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 3, "blocked_x86_avx512", "x86_avx512", starch_modeac_scan_u16_blocked_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx2", "x86_avx2", starch_modeac_scan_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 5, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16q11_aligned */
+/* dispatcher / registry for modeac_scan_u16_aligned */
 
-starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_select() {
-    for (starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_registry;
+starch_modeac_scan_u16_aligned_regentry * starch_modeac_scan_u16_aligned_select() {
+    for (starch_modeac_scan_u16_aligned_regentry *entry = starch_modeac_scan_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -659,22 +2459,22 @@ starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_sel
     return NULL;
 }
 
-static void starch_magnitude_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_select();
+static void starch_modeac_scan_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, unsigned * arg3, unsigned * arg4 ) {
+    starch_modeac_scan_u16_aligned_regentry *entry = starch_modeac_scan_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16q11_aligned = entry->callable;
-    starch_magnitude_sc16q11_aligned ( arg0, arg1, arg2 );
+    starch_modeac_scan_u16_aligned = entry->callable;
+    starch_modeac_scan_u16_aligned ( arg0, arg1, arg2, arg3, arg4 );
 }
 
-starch_magnitude_sc16q11_aligned_ptr starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+starch_modeac_scan_u16_aligned_ptr starch_modeac_scan_u16_aligned = starch_modeac_scan_u16_aligned_dispatch;
 
-void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_modeac_scan_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16q11_aligned_regentry *entry;
-    for (entry = starch_magnitude_sc16q11_aligned_registry; entry->name; ++entry) {
+    starch_modeac_scan_u16_aligned_regentry *entry;
+    for (entry = starch_modeac_scan_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -686,81 +2486,61 @@ void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_modeac_scan_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16q11_aligned_registry, entry - starch_magnitude_sc16q11_aligned_registry, sizeof(starch_magnitude_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_modeac_scan_u16_aligned_registry, entry - starch_modeac_scan_u16_aligned_registry, sizeof(starch_modeac_scan_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+    starch_modeac_scan_u16_aligned = starch_modeac_scan_u16_aligned_dispatch;
 }
 
-starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_registry[] = {
+starch_modeac_scan_u16_aligned_regentry starch_modeac_scan_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "11bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "12bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 10, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "blocked_armv8_neon_simd_aligned", "armv8_neon_simd", starch_modeac_scan_u16_aligned_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_modeac_scan_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_armv8_neon_simd", "armv8_neon_simd", starch_modeac_scan_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "blocked_armv8_neon_simd", "armv8_neon_simd", starch_modeac_scan_u16_blocked_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "11bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "12bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 10, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "blocked_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_modeac_scan_u16_aligned_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_modeac_scan_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_modeac_scan_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "blocked_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_modeac_scan_u16_blocked_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 1, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 7, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 8, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 9, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 10, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 11, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "blocked_x86_avx2_aligned", "x86_avx2", starch_modeac_scan_u16_aligned_blocked_x86_avx2, cpu_supports_avx2 },
+    { 1, "blocked_generic", "generic", starch_modeac_scan_u16_blocked_generic, NULL },
+    { 2, "generic_x86_avx512_aligned", "x86_avx512", starch_modeac_scan_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 3, "blocked_x86_avx512_aligned", "x86_avx512", starch_modeac_scan_u16_aligned_blocked_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx512", "x86_avx512", starch_modeac_scan_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 5, "blocked_x86_avx512", "x86_avx512", starch_modeac_scan_u16_blocked_x86_avx512, cpu_supports_avx512 },
+    { 6, "generic_x86_avx2_aligned", "x86_avx2", starch_modeac_scan_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 7, "generic_x86_avx2", "x86_avx2", starch_modeac_scan_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 8, "blocked_x86_avx2", "x86_avx2", starch_modeac_scan_u16_blocked_x86_avx2, cpu_supports_avx2 },
+    { 9, "generic_generic", "generic", starch_modeac_scan_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_uc8 */
+/* dispatcher / registry for preamble_bitmap_u16 */
 
-starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
-    for (starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_registry;
+starch_preamble_bitmap_u16_regentry * starch_preamble_bitmap_u16_select() {
+    for (starch_preamble_bitmap_u16_regentry *entry = starch_preamble_bitmap_u16_registry;
          entry->name;
          ++entry)
     {
@@ -771,22 +2551,22 @@ starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
     return NULL;
 }
 
-static void starch_magnitude_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_select();
+static void starch_preamble_bitmap_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 ) {
+    starch_preamble_bitmap_u16_regentry *entry = starch_preamble_bitmap_u16_select();
     if (!entry)
         abort();
 
-    starch_magnitude_uc8 = entry->callable;
-    starch_magnitude_uc8 ( arg0, arg1, arg2 );
+    starch_preamble_bitmap_u16 = entry->callable;
+    starch_preamble_bitmap_u16 ( arg0, arg1, arg2 );
 }
 
-starch_magnitude_uc8_ptr starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+starch_preamble_bitmap_u16_ptr starch_preamble_bitmap_u16 = starch_preamble_bitmap_u16_dispatch;
 
-void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
+void starch_preamble_bitmap_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_uc8_regentry *entry;
-    for (entry = starch_magnitude_uc8_registry; entry->name; ++entry) {
+    starch_preamble_bitmap_u16_regentry *entry;
+    for (entry = starch_preamble_bitmap_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -798,60 +2578,45 @@ void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_bitmap_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_uc8_registry, entry - starch_magnitude_uc8_registry, sizeof(starch_magnitude_uc8_regentry), starch_regentry_rank_compare);
+    qsort(starch_preamble_bitmap_u16_registry, entry - starch_preamble_bitmap_u16_registry, sizeof(starch_preamble_bitmap_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+    starch_preamble_bitmap_u16 = starch_preamble_bitmap_u16_dispatch;
 }
 
-starch_magnitude_uc8_regentry starch_magnitude_uc8_registry[] = {
+starch_preamble_bitmap_u16_regentry starch_preamble_bitmap_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_armv8_neon_simd", "armv8_neon_simd", starch_preamble_bitmap_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_bitmap_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
-    { 4, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 5, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_x86_avx2", "x86_avx2", starch_preamble_bitmap_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx512", "x86_avx512", starch_preamble_bitmap_u16_generic_x86_avx512, cpu_supports_avx512 },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_uc8_aligned */
+/* dispatcher / registry for preamble_bitmap_u16_aligned */
 
-starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
-    for (starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_registry;
+starch_preamble_bitmap_u16_aligned_regentry * starch_preamble_bitmap_u16_aligned_select() {
+    for (starch_preamble_bitmap_u16_aligned_regentry *entry = starch_preamble_bitmap_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -862,22 +2627,22 @@ starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
     return NULL;
 }
 
-static void starch_magnitude_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_select();
+static void starch_preamble_bitmap_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint64_t * arg2 ) {
+    starch_preamble_bitmap_u16_aligned_regentry *entry = starch_preamble_bitmap_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_uc8_aligned = entry->callable;
-    starch_magnitude_uc8_aligned ( arg0, arg1, arg2 );
+    starch_preamble_bitmap_u16_aligned = entry->callable;
+    starch_preamble_bitmap_u16_aligned ( arg0, arg1, arg2 );
 }
 
-starch_magnitude_uc8_aligned_ptr starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+starch_preamble_bitmap_u16_aligned_ptr starch_preamble_bitmap_u16_aligned = starch_preamble_bitmap_u16_aligned_dispatch;
 
-void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_preamble_bitmap_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_uc8_aligned_regentry *entry;
-    for (entry = starch_magnitude_uc8_aligned_registry; entry->name; ++entry) {
+    starch_preamble_bitmap_u16_aligned_regentry *entry;
+    for (entry = starch_preamble_bitmap_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -889,71 +2654,49 @@ void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisd
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_bitmap_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_uc8_aligned_registry, entry - starch_magnitude_uc8_aligned_registry, sizeof(starch_magnitude_uc8_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_preamble_bitmap_u16_aligned_registry, entry - starch_preamble_bitmap_u16_aligned_registry, sizeof(starch_preamble_bitmap_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+    starch_preamble_bitmap_u16_aligned = starch_preamble_bitmap_u16_aligned_dispatch;
 }
 
-starch_magnitude_uc8_aligned_regentry starch_magnitude_uc8_aligned_registry[] = {
+starch_preamble_bitmap_u16_aligned_regentry starch_preamble_bitmap_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_bitmap_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_preamble_bitmap_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_bitmap_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_bitmap_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
-    { 7, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 8, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "generic_x86_avx2_aligned", "x86_avx2", starch_preamble_bitmap_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_generic", "generic", starch_preamble_bitmap_u16_generic_generic, NULL },
+    { 2, "generic_x86_avx512_aligned", "x86_avx512", starch_preamble_bitmap_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 3, "generic_x86_avx512", "x86_avx512", starch_preamble_bitmap_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx2", "x86_avx2", starch_preamble_bitmap_u16_generic_x86_avx2, cpu_supports_avx2 },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for mean_power_u16 */
+/* dispatcher / registry for resample_u16 */
 
-starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
-    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry;
+starch_resample_u16_regentry * starch_resample_u16_select() {
+    for (starch_resample_u16_regentry *entry = starch_resample_u16_registry;
          entry->name;
          ++entry)
     {
@@ -964,22 +2707,22 @@ starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
     return NULL;
 }
 
-static void starch_mean_power_u16_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
-    starch_mean_power_u16_regentry *entry = starch_mean_power_u16_select();
+static void starch_resample_u16_dispatch ( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 ) {
+    starch_resample_u16_regentry *entry = starch_resample_u16_select();
     if (!entry)
         abort();
 
-    starch_mean_power_u16 = entry->callable;
-    starch_mean_power_u16 ( arg0, arg1, arg2, arg3 );
+    starch_resample_u16 = entry->callable;
+    starch_resample_u16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_mean_power_u16_ptr starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+starch_resample_u16_ptr starch_resample_u16 = starch_resample_u16_dispatch;
 
-void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
+void starch_resample_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_mean_power_u16_regentry *entry;
-    for (entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+    starch_resample_u16_regentry *entry;
+    for (entry = starch_resample_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -991,60 +2734,53 @@ void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_resample_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_mean_power_u16_registry, entry - starch_mean_power_u16_registry, sizeof(starch_mean_power_u16_regentry), starch_regentry_rank_compare);
+    qsort(starch_resample_u16_registry, entry - starch_resample_u16_registry, sizeof(starch_resample_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+    starch_resample_u16 = starch_resample_u16_dispatch;
 }
 
-starch_mean_power_u16_regentry starch_mean_power_u16_registry[] = {
+starch_resample_u16_regentry starch_resample_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "phase_major_armv8_neon_simd", "armv8_neon_simd", starch_resample_u16_phase_major_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_resample_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "phase_major_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_u16_phase_major_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 1, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
-    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
-    { 4, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 5, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 1, "generic_x86_avx2", "x86_avx2", starch_resample_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "phase_major_x86_avx512", "x86_avx512", starch_resample_u16_phase_major_x86_avx512, cpu_supports_avx512 },
+    { 3, "generic_x86_avx512", "x86_avx512", starch_resample_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 4, "phase_major_x86_avx2", "x86_avx2", starch_resample_u16_phase_major_x86_avx2, cpu_supports_avx2 },
+    { 5, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for mean_power_u16_aligned */
+/* dispatcher / registry for resample_u16_aligned */
 
-starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select() {
-    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry;
+starch_resample_u16_aligned_regentry * starch_resample_u16_aligned_select() {
+    for (starch_resample_u16_aligned_regentry *entry = starch_resample_u16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -1055,22 +2791,22 @@ starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select()
     return NULL;
 }
 
-static void starch_mean_power_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
-    starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_select();
+static void starch_resample_u16_aligned_dispatch ( const uint16_t * arg0, uint16_t * arg1, unsigned arg2, const resampler_t * arg3 ) {
+    starch_resample_u16_aligned_regentry *entry = starch_resample_u16_aligned_select();
     if (!entry)
         abort();
 
-    starch_mean_power_u16_aligned = entry->callable;
-    starch_mean_power_u16_aligned ( arg0, arg1, arg2, arg3 );
+    starch_resample_u16_aligned = entry->callable;
+    starch_resample_u16_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_mean_power_u16_aligned_ptr starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+starch_resample_u16_aligned_ptr starch_resample_u16_aligned = starch_resample_u16_aligned_dispatch;
 
-void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_resample_u16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_mean_power_u16_aligned_regentry *entry;
-    for (entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+    starch_resample_u16_aligned_regentry *entry;
+    for (entry = starch_resample_u16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -1082,63 +2818,53 @@ void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wis
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_resample_u16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_mean_power_u16_aligned_registry, entry - starch_mean_power_u16_aligned_registry, sizeof(starch_mean_power_u16_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_resample_u16_aligned_registry, entry - starch_resample_u16_aligned_registry, sizeof(starch_resample_u16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+    starch_resample_u16_aligned = starch_resample_u16_aligned_dispatch;
 }
 
-starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[] = {
+starch_resample_u16_aligned_regentry starch_resample_u16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "u64_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "phase_major_armv8_neon_simd_aligned", "armv8_neon_simd", starch_resample_u16_aligned_phase_major_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd_aligned", "armv8_neon_simd", starch_resample_u16_aligned_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "generic_armv8_neon_simd", "armv8_neon_simd", starch_resample_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "phase_major_armv8_neon_simd", "armv8_neon_simd", starch_resample_u16_phase_major_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "u64_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "neon_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "phase_major_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_resample_u16_aligned_phase_major_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_resample_u16_aligned_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "phase_major_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_u16_phase_major_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 1, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2 },
-    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2 },
-    { 4, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 5, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
-    { 7, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 8, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_generic", "generic", starch_resample_u16_generic_generic, NULL },
+    { 1, "generic_x86_avx2_aligned", "x86_avx2", starch_resample_u16_aligned_generic_x86_avx2, cpu_supports_avx2 },
+    { 2, "phase_major_x86_avx512_aligned", "x86_avx512", starch_resample_u16_aligned_phase_major_x86_avx512, cpu_supports_avx512 },
+    { 3, "generic_x86_avx512_aligned", "x86_avx512", starch_resample_u16_aligned_generic_x86_avx512, cpu_supports_avx512 },
+    { 4, "generic_x86_avx512", "x86_avx512", starch_resample_u16_generic_x86_avx512, cpu_supports_avx512 },
+    { 5, "phase_major_x86_avx512", "x86_avx512", starch_resample_u16_phase_major_x86_avx512, cpu_supports_avx512 },
+    { 6, "phase_major_x86_avx2_aligned", "x86_avx2", starch_resample_u16_aligned_phase_major_x86_avx2, cpu_supports_avx2 },
+    { 7, "generic_x86_avx2", "x86_avx2", starch_resample_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 8, "phase_major_x86_avx2", "x86_avx2", starch_resample_u16_phase_major_x86_avx2, cpu_supports_avx2 },
+    { 9, "phase_major_generic", "generic", starch_resample_u16_phase_major_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
@@ -1151,12 +2877,68 @@ int starch_read_wisdom (const char * path)
         return -1;
 
     /* reset all ranks to identify entries not listed in the wisdom file; we'll assign ranks at the end to produce a stable sort */
+    int rank_block_max_u16 = 0;
+    for (starch_block_max_u16_regentry *entry = starch_block_max_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_block_max_u16_aligned = 0;
+    for (starch_block_max_u16_aligned_regentry *entry = starch_block_max_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
     int rank_count_above_u16 = 0;
     for (starch_count_above_u16_regentry *entry = starch_count_above_u16_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
-    int rank_count_above_u16_aligned = 0;
-    for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
+    int rank_count_above_u16_aligned = 0;
+    for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_histogram_log_u16 = 0;
+    for (starch_histogram_log_u16_regentry *entry = starch_histogram_log_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_histogram_log_u16_aligned = 0;
+    for (starch_histogram_log_u16_aligned_regentry *entry = starch_histogram_log_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_power_preamble_uc8 = 0;
+    for (starch_magnitude_dc_power_preamble_uc8_regentry *entry = starch_magnitude_dc_power_preamble_uc8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_power_preamble_uc8_aligned = 0;
+    for (starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16 = 0;
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16_aligned = 0;
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11 = 0;
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11_aligned = 0;
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8 = 0;
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8_aligned = 0;
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_preamble_uc8 = 0;
+    for (starch_magnitude_power_preamble_uc8_regentry *entry = starch_magnitude_power_preamble_uc8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_preamble_uc8_aligned = 0;
+    for (starch_magnitude_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
     int rank_magnitude_power_uc8 = 0;
@@ -1199,6 +2981,30 @@ int starch_read_wisdom (const char * path)
     for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_modeac_scan_u16 = 0;
+    for (starch_modeac_scan_u16_regentry *entry = starch_modeac_scan_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_modeac_scan_u16_aligned = 0;
+    for (starch_modeac_scan_u16_aligned_regentry *entry = starch_modeac_scan_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_bitmap_u16 = 0;
+    for (starch_preamble_bitmap_u16_regentry *entry = starch_preamble_bitmap_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_bitmap_u16_aligned = 0;
+    for (starch_preamble_bitmap_u16_aligned_regentry *entry = starch_preamble_bitmap_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_resample_u16 = 0;
+    for (starch_resample_u16_regentry *entry = starch_resample_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_resample_u16_aligned = 0;
+    for (starch_resample_u16_aligned_regentry *entry = starch_resample_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
 
     char linebuf[512];
     while (fgets(linebuf, sizeof(linebuf), fp)) {
@@ -1232,6 +3038,24 @@ int starch_read_wisdom (const char * path)
         *end = 0;
 
         /* try to find a matching registry entry */
+        if (!strcmp(name, "block_max_u16")) {
+            for (starch_block_max_u16_regentry *entry = starch_block_max_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_block_max_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "block_max_u16_aligned")) {
+            for (starch_block_max_u16_aligned_regentry *entry = starch_block_max_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_block_max_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "count_above_u16")) {
             for (starch_count_above_u16_regentry *entry = starch_count_above_u16_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1250,6 +3074,114 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "histogram_log_u16")) {
+            for (starch_histogram_log_u16_regentry *entry = starch_histogram_log_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_histogram_log_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "histogram_log_u16_aligned")) {
+            for (starch_histogram_log_u16_aligned_regentry *entry = starch_histogram_log_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_histogram_log_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_power_preamble_uc8")) {
+            for (starch_magnitude_dc_power_preamble_uc8_regentry *entry = starch_magnitude_dc_power_preamble_uc8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_power_preamble_uc8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_power_preamble_uc8_aligned")) {
+            for (starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_power_preamble_uc8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16")) {
+            for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16_aligned")) {
+            for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11")) {
+            for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11_aligned")) {
+            for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8")) {
+            for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8_aligned")) {
+            for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_preamble_uc8")) {
+            for (starch_magnitude_power_preamble_uc8_regentry *entry = starch_magnitude_power_preamble_uc8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_preamble_uc8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_preamble_uc8_aligned")) {
+            for (starch_magnitude_power_preamble_uc8_aligned_regentry *entry = starch_magnitude_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_preamble_uc8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "magnitude_power_uc8")) {
             for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1340,6 +3272,60 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "modeac_scan_u16")) {
+            for (starch_modeac_scan_u16_regentry *entry = starch_modeac_scan_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_modeac_scan_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "modeac_scan_u16_aligned")) {
+            for (starch_modeac_scan_u16_aligned_regentry *entry = starch_modeac_scan_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_modeac_scan_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_bitmap_u16")) {
+            for (starch_preamble_bitmap_u16_regentry *entry = starch_preamble_bitmap_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_bitmap_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_bitmap_u16_aligned")) {
+            for (starch_preamble_bitmap_u16_aligned_regentry *entry = starch_preamble_bitmap_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_bitmap_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "resample_u16")) {
+            for (starch_resample_u16_regentry *entry = starch_resample_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_resample_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "resample_u16_aligned")) {
+            for (starch_resample_u16_aligned_regentry *entry = starch_resample_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_resample_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
     }
 
     if (ferror(fp)) {
@@ -1350,6 +3336,28 @@ int starch_read_wisdom (const char * path)
     fclose(fp);
 
     /* assign ranks to unmatched items to (stable) sort them last; re-sort everything */
+    {
+        starch_block_max_u16_regentry *entry;
+        for (entry = starch_block_max_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_block_max_u16;
+        }
+        qsort(starch_block_max_u16_registry, entry - starch_block_max_u16_registry, sizeof(starch_block_max_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_block_max_u16 = starch_block_max_u16_dispatch;
+    }
+    {
+        starch_block_max_u16_aligned_regentry *entry;
+        for (entry = starch_block_max_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_block_max_u16_aligned;
+        }
+        qsort(starch_block_max_u16_aligned_registry, entry - starch_block_max_u16_aligned_registry, sizeof(starch_block_max_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_block_max_u16_aligned = starch_block_max_u16_aligned_dispatch;
+    }
     {
         starch_count_above_u16_regentry *entry;
         for (entry = starch_count_above_u16_registry; entry->name; ++entry) {
@@ -1372,6 +3380,138 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
     }
+    {
+        starch_histogram_log_u16_regentry *entry;
+        for (entry = starch_histogram_log_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_histogram_log_u16;
+        }
+        qsort(starch_histogram_log_u16_registry, entry - starch_histogram_log_u16_registry, sizeof(starch_histogram_log_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_histogram_log_u16 = starch_histogram_log_u16_dispatch;
+    }
+    {
+        starch_histogram_log_u16_aligned_regentry *entry;
+        for (entry = starch_histogram_log_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_histogram_log_u16_aligned;
+        }
+        qsort(starch_histogram_log_u16_aligned_registry, entry - starch_histogram_log_u16_aligned_registry, sizeof(starch_histogram_log_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_histogram_log_u16_aligned = starch_histogram_log_u16_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_power_preamble_uc8_regentry *entry;
+        for (entry = starch_magnitude_dc_power_preamble_uc8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_power_preamble_uc8;
+        }
+        qsort(starch_magnitude_dc_power_preamble_uc8_registry, entry - starch_magnitude_dc_power_preamble_uc8_registry, sizeof(starch_magnitude_dc_power_preamble_uc8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_power_preamble_uc8 = starch_magnitude_dc_power_preamble_uc8_dispatch;
+    }
+    {
+        starch_magnitude_dc_power_preamble_uc8_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_power_preamble_uc8_aligned;
+        }
+        qsort(starch_magnitude_dc_power_preamble_uc8_aligned_registry, entry - starch_magnitude_dc_power_preamble_uc8_aligned_registry, sizeof(starch_magnitude_dc_power_preamble_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_power_preamble_uc8_aligned = starch_magnitude_dc_power_preamble_uc8_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16;
+        }
+        qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11;
+        }
+        qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8;
+        }
+        qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8_aligned;
+        }
+        qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+    }
+    {
+        starch_magnitude_power_preamble_uc8_regentry *entry;
+        for (entry = starch_magnitude_power_preamble_uc8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_preamble_uc8;
+        }
+        qsort(starch_magnitude_power_preamble_uc8_registry, entry - starch_magnitude_power_preamble_uc8_registry, sizeof(starch_magnitude_power_preamble_uc8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_preamble_uc8 = starch_magnitude_power_preamble_uc8_dispatch;
+    }
+    {
+        starch_magnitude_power_preamble_uc8_aligned_regentry *entry;
+        for (entry = starch_magnitude_power_preamble_uc8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_preamble_uc8_aligned;
+        }
+        qsort(starch_magnitude_power_preamble_uc8_aligned_registry, entry - starch_magnitude_power_preamble_uc8_aligned_registry, sizeof(starch_magnitude_power_preamble_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_preamble_uc8_aligned = starch_magnitude_power_preamble_uc8_aligned_dispatch;
+    }
     {
         starch_magnitude_power_uc8_regentry *entry;
         for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
@@ -1482,6 +3622,72 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
     }
+    {
+        starch_modeac_scan_u16_regentry *entry;
+        for (entry = starch_modeac_scan_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_modeac_scan_u16;
+        }
+        qsort(starch_modeac_scan_u16_registry, entry - starch_modeac_scan_u16_registry, sizeof(starch_modeac_scan_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_modeac_scan_u16 = starch_modeac_scan_u16_dispatch;
+    }
+    {
+        starch_modeac_scan_u16_aligned_regentry *entry;
+        for (entry = starch_modeac_scan_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_modeac_scan_u16_aligned;
+        }
+        qsort(starch_modeac_scan_u16_aligned_registry, entry - starch_modeac_scan_u16_aligned_registry, sizeof(starch_modeac_scan_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_modeac_scan_u16_aligned = starch_modeac_scan_u16_aligned_dispatch;
+    }
+    {
+        starch_preamble_bitmap_u16_regentry *entry;
+        for (entry = starch_preamble_bitmap_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_bitmap_u16;
+        }
+        qsort(starch_preamble_bitmap_u16_registry, entry - starch_preamble_bitmap_u16_registry, sizeof(starch_preamble_bitmap_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_bitmap_u16 = starch_preamble_bitmap_u16_dispatch;
+    }
+    {
+        starch_preamble_bitmap_u16_aligned_regentry *entry;
+        for (entry = starch_preamble_bitmap_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_bitmap_u16_aligned;
+        }
+        qsort(starch_preamble_bitmap_u16_aligned_registry, entry - starch_preamble_bitmap_u16_aligned_registry, sizeof(starch_preamble_bitmap_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_bitmap_u16_aligned = starch_preamble_bitmap_u16_aligned_dispatch;
+    }
+    {
+        starch_resample_u16_regentry *entry;
+        for (entry = starch_resample_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_resample_u16;
+        }
+        qsort(starch_resample_u16_registry, entry - starch_resample_u16_registry, sizeof(starch_resample_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_resample_u16 = starch_resample_u16_dispatch;
+    }
+    {
+        starch_resample_u16_aligned_regentry *entry;
+        for (entry = starch_resample_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_resample_u16_aligned;
+        }
+        qsort(starch_resample_u16_aligned_registry, entry - starch_resample_u16_aligned_registry, sizeof(starch_resample_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_resample_u16_aligned = starch_resample_u16_aligned_dispatch;
+    }
 
     return 0;
 }
@@ -14,12 +14,22 @@
 #define STARCH_IMPL(_function,_impl) starch_ ## _function ## _ ## _impl ## _ ## armv7a_neon_vfpv4
 #define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
 
+#include "../impl/block_max_u16.c"
 #include "../impl/count_above_u16.c"
+#include "../impl/histogram_log_u16.c"
+#include "../impl/magnitude_dc_power_preamble_uc8.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_preamble_uc8.c"
 #include "../impl/magnitude_power_uc8.c"
 #include "../impl/magnitude_sc16.c"
 #include "../impl/magnitude_sc16q11.c"
 #include "../impl/magnitude_uc8.c"
 #include "../impl/mean_power_u16.c"
+#include "../impl/modeac_scan_u16.c"
+#include "../impl/preamble_bitmap_u16.c"
+#include "../impl/resample_u16.c"
 
 
 #undef STARCH_ALIGNMENT
@@ -34,10 +44,20 @@
 #define STARCH_IMPL(_function,_impl) starch_ ## _function ## _aligned_ ## _impl ## _ ## armv7a_neon_vfpv4
 #define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
 
+#include "../impl/block_max_u16.c"
 #include "../impl/count_above_u16.c"
+#include "../impl/histogram_log_u16.c"
+#include "../impl/magnitude_dc_power_preamble_uc8.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_preamble_uc8.c"
 #include "../impl/magnitude_power_uc8.c"
 #include "../impl/magnitude_sc16.c"
 #include "../impl/magnitude_sc16q11.c"
 #include "../impl/magnitude_uc8.c"
 #include "../impl/mean_power_u16.c"
+#include "../impl/modeac_scan_u16.c"
+#include "../impl/preamble_bitmap_u16.c"
+#include "../impl/resample_u16.c"
 
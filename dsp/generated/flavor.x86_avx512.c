@@ -0,0 +1,63 @@
+
+/* starch generated code. Do not edit. */
+
+#define STARCH_FLAVOR_X86_AVX512
+#define STARCH_FEATURE_AVX512
+
+#include "starch.h"
+
+#undef STARCH_ALIGNMENT
+
+#define STARCH_ALIGNMENT 1
+#define STARCH_ALIGNED(_ptr) (_ptr)
+#define STARCH_SYMBOL(_name) starch_ ## _name ## _ ## x86_avx512
+#define STARCH_IMPL(_function,_impl) starch_ ## _function ## _ ## _impl ## _ ## x86_avx512
+#define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
+
+#include "../impl/block_max_u16.c"
+#include "../impl/count_above_u16.c"
+#include "../impl/histogram_log_u16.c"
+#include "../impl/magnitude_dc_power_preamble_uc8.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_preamble_uc8.c"
+#include "../impl/magnitude_power_uc8.c"
+#include "../impl/magnitude_sc16.c"
+#include "../impl/magnitude_sc16q11.c"
+#include "../impl/magnitude_uc8.c"
+#include "../impl/mean_power_u16.c"
+#include "../impl/modeac_scan_u16.c"
+#include "../impl/preamble_bitmap_u16.c"
+#include "../impl/resample_u16.c"
+
+
+#undef STARCH_ALIGNMENT
+#undef STARCH_ALIGNED
+#undef STARCH_SYMBOL
+#undef STARCH_IMPL
+#undef STARCH_IMPL_REQUIRES
+
+#define STARCH_ALIGNMENT STARCH_MIX_ALIGNMENT
+#define STARCH_ALIGNED(_ptr) (__builtin_assume_aligned((_ptr), STARCH_MIX_ALIGNMENT))
+#define STARCH_SYMBOL(_name) starch_ ## _name ## _aligned_ ## x86_avx512
+#define STARCH_IMPL(_function,_impl) starch_ ## _function ## _aligned_ ## _impl ## _ ## x86_avx512
+#define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
+
+#include "../impl/block_max_u16.c"
+#include "../impl/count_above_u16.c"
+#include "../impl/histogram_log_u16.c"
+#include "../impl/magnitude_dc_power_preamble_uc8.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_preamble_uc8.c"
+#include "../impl/magnitude_power_uc8.c"
+#include "../impl/magnitude_sc16.c"
+#include "../impl/magnitude_sc16q11.c"
+#include "../impl/magnitude_uc8.c"
+#include "../impl/mean_power_u16.c"
+#include "../impl/modeac_scan_u16.c"
+#include "../impl/preamble_bitmap_u16.c"
+#include "../impl/resample_u16.c"
+
@@ -0,0 +1,30 @@
+#ifndef DSP_DC_FILTER_H
+#define DSP_DC_FILTER_H
+
+#include <math.h>
+
+#include "dsp-types.h"
+
+// A first-order IIR DC-blocking filter, applied to blocks of samples.
+//
+// The per-sample filter (dc += (x - dc) * rate) has a loop-carried
+// dependency that stops it vectorizing. With a cutoff of a few Hz at MHz
+// sample rates the DC estimate barely moves over a few hundred samples, so
+// instead it is held constant over a block of DC_FILTER_BLOCK samples (and
+// subtracted from each of them), then advanced by the whole block at once
+// using the block mean. The inner loop is then a straightforward map plus
+// an integer sum, which vectorizes.
+
+#define DC_FILTER_BLOCK 256
+
+// Advance the filter over a block of n samples whose raw I/Q values sum
+// to sum_I / sum_Q
+static inline void dc_filter_update(dc_filter_t *state, float sum_I, float sum_Q, unsigned n)
+{
+    // 1 - decay over n samples, computed without cancellation
+    float k = -expm1f(-state->rate * n);
+    state->dc_I += (sum_I / n - state->dc_I) * k;
+    state->dc_Q += (sum_Q / n - state->dc_Q) * k;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef DSP_LOG_HISTOGRAM_H
+#define DSP_LOG_HISTOGRAM_H
+
+#include <inttypes.h>
+#include <string.h>
+
+// A log-scale histogram of uint16_t magnitudes, used for percentile estimates.
+//
+// Values below 256 have a bucket each. Above that, each power-of-two range
+// [2^e, 2^(e+1)) is split into 128 buckets, so a bucket is at most 1/128 of
+// its value wide (about 0.07dB). That gives 1280 buckets in all, small
+// enough to stay in L1 cache, where a bucket for every uint16_t value
+// (256kB of counters) does not.
+
+#define LOG_HISTOGRAM_BUCKETS 1280
+
+// The bucket for a value
+static inline unsigned log_histogram_bucket(uint16_t value)
+{
+    // The number of low bits dropped when bucketing: (floor(log2(value)) - 7),
+    // or 0 for values below 256. The exponent of the value converted to float
+    // gives floor(log2(value)) without a loop or branches, and vectorizes.
+    float f = value;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    int shift = (int) (bits >> 23) - 127 - 7;
+    if (shift < 0)
+        shift = 0;
+    return ((unsigned) shift << 7) + (value >> shift);
+}
+
+// The smallest value that falls into a bucket
+static inline unsigned log_histogram_bucket_low(unsigned bucket)
+{
+    if (bucket < 256)
+        return bucket;
+    unsigned shift = (bucket >> 7) - 1;
+    return (bucket - (shift << 7)) << shift;
+}
+
+// The number of values that fall into a bucket
+static inline unsigned log_histogram_bucket_width(unsigned bucket)
+{
+    if (bucket < 256)
+        return 1;
+    return 1U << ((bucket >> 7) - 1);
+}
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef DSP_PREAMBLE_BITMAP_H
+#define DSP_PREAMBLE_BITMAP_H
+
+#include <inttypes.h>
+#include <string.h>
+
+// Preamble candidate bitmaps for the 2.4MHz demodulator.
+//
+// Bit k of the bitmap (bit k%64 of word k/64) is set if a Mode S preamble
+// might start at sample k. The test is a superset of the checks that
+// demodulate2400 makes before trying to demodulate at that sample: it
+// needs a rising edge 0->1 and a falling edge 12->13, and it needs the
+// first pulse, the third pulse, and the rising edge of the fourth pulse
+// to fall somewhere where one of the five preamble phases expects them.
+//
+// The test at sample k looks at samples k .. k+PREAMBLE_BITMAP_LOOKAHEAD.
+
+#define PREAMBLE_BITMAP_LOOKAHEAD 13
+
+// The number of bitmap words needed to cover 'samples' samples
+#define PREAMBLE_BITMAP_WORDS(samples) (((samples) + 63) / 64)
+
+static inline uint64_t preamble_bitmap_test(const uint16_t *p)
+{
+    return (p[0] < p[1]) & (p[12] > p[13]) &
+        ((p[1] > p[2]) | (p[2] > p[3])) &
+        ((p[8] < p[9]) | (p[9] < p[10])) &
+        ((p[10] < p[11]) | (p[11] < p[12]));
+}
+
+// Fill in 'words' complete bitmap words for samples starting at m[0];
+// m[0] .. m[words * 64 + PREAMBLE_BITMAP_LOOKAHEAD - 1] must be valid.
+//
+// This is done in two steps so that the compiler can vectorize the first:
+// compute a byte flag per sample, then pack each group of eight flags into
+// eight bits with a multiply (byte i of the group lands in bit 56+i).
+static inline void preamble_bitmap_words(const uint16_t *m, unsigned words, uint64_t *bitmap)
+{
+    uint8_t flags[256];
+
+    while (words > 0) {
+        unsigned n = (words > 4 ? 4 : words);
+
+        for (unsigned k = 0; k < n * 64; ++k) {
+            const uint16_t *p = m + k;
+            flags[k] = (p[0] < p[1]) & (p[12] > p[13]) &
+                ((p[1] > p[2]) | (p[2] > p[3])) &
+                ((p[8] < p[9]) | (p[9] < p[10])) &
+                ((p[10] < p[11]) | (p[11] < p[12]));
+        }
+
+        for (unsigned w = 0; w < n; ++w) {
+            uint64_t word = 0;
+            for (unsigned g = 0; g < 8; ++g) {
+                uint64_t group;
+                memcpy(&group, &flags[w * 64 + g * 8], sizeof(group));
+                word |= ((group * UINT64_C(0x0102040810204080)) >> 56) << (g * 8);
+            }
+            bitmap[w] = word;
+        }
+
+        m += n * 64;
+        bitmap += n;
+        words -= n;
+    }
+}
+
+// Fill in the final bitmap words for samples m[0] .. m[len-1]; samples
+// that don't have enough following samples for the test get a zero bit
+static inline void preamble_bitmap_tail(const uint16_t *m, unsigned len, uint64_t *bitmap)
+{
+    for (unsigned w = 0; w < PREAMBLE_BITMAP_WORDS(len); ++w) {
+        uint64_t word = 0;
+        for (unsigned b = 0; b < 64; ++b) {
+            unsigned k = w * 64 + b;
+            if (k + PREAMBLE_BITMAP_LOOKAHEAD < len)
+                word |= preamble_bitmap_test(m + k) << b;
+        }
+        bitmap[w] = word;
+    }
+}
+
+// Fill in the bitmap for samples m[0] .. m[len-1]
+static inline void preamble_bitmap_fill(const uint16_t *m, unsigned len, uint64_t *bitmap)
+{
+    unsigned full_words = (len >= PREAMBLE_BITMAP_LOOKAHEAD ? (len - PREAMBLE_BITMAP_LOOKAHEAD) / 64 : 0);
+    preamble_bitmap_words(m, full_words, bitmap);
+    preamble_bitmap_tail(m + full_words * 64, len - full_words * 64, bitmap + full_words);
+}
+
+// Return the index of the first set bit at or after 'from' and before
+// 'limit', or 'limit' if there is none
+static inline unsigned preamble_bitmap_next(const uint64_t *bitmap, unsigned from, unsigned limit)
+{
+    unsigned w = from / 64;
+    uint64_t word = bitmap[w] & (~UINT64_C(0) << (from % 64));
+
+    while (w * 64 < limit) {
+        if (word) {
+#ifdef __GNUC__
+            unsigned k = w * 64 + (unsigned) __builtin_ctzll(word);
+#else
+            unsigned k = w * 64;
+            while (!(word & 1)) {
+                word >>= 1;
+                ++k;
+            }
+#endif
+            return (k < limit ? k : limit);
+        }
+
+        if (++w * 64 >= limit)
+            break;
+        word = bitmap[w];
+    }
+
+    return limit;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef DSP_RESAMPLER_H
+#define DSP_RESAMPLER_H
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "dsp-types.h"
+
+// Build a resampler_t that reduces the sample rate by a factor of down/up
+// (down >= up), for resample_u16.
+//
+// Each output sample is the mean of the input over the output sample's
+// period (a box filter, i.e. integrate-and-dump): input samples that
+// partly overlap the period are weighted by the fraction that overlaps.
+// For Mode S, where everything of interest is a 0.5us pulse, this is about
+// the same as the filtering a 2.4MHz SDR's own anti-aliasing filter does,
+// and it averages down the extra noise bandwidth of the faster input.
+//
+// All of the overlaps are multiples of 1/up input samples, so the weights
+// are exact rationals; they are rounded to Q16 with each phase's weights
+// summing to exactly 65536, so the output can't overflow.
+
+static inline bool resampler_build(resampler_t *r, unsigned up, unsigned down)
+{
+    if (up < 1 || up > RESAMPLER_MAX_UP || down < up)
+        return false;
+
+    memset(r, 0, sizeof(*r));
+    r->up = up;
+    r->down = down;
+
+    // in units of 1/up input samples, output p covers [p * down, (p + 1) * down)
+    for (unsigned p = 0; p < up; ++p) {
+        unsigned start = p * down;
+        unsigned end = (p + 1) * down;
+        unsigned offset = start / up;
+        unsigned taps = (end + up - 1) / up - offset;
+        if (taps > RESAMPLER_MAX_TAPS)
+            return false;
+
+        r->offsets[p] = offset;
+        if (taps > r->taps)
+            r->taps = taps;
+
+        uint32_t *w = &r->weights[p * RESAMPLER_MAX_TAPS];
+        uint32_t total = 0;
+        unsigned largest = 0;
+        for (unsigned j = 0; j < taps; ++j) {
+            unsigned lo = (offset + j) * up;
+            unsigned hi = lo + up;
+            if (lo < start)
+                lo = start;
+            if (hi > end)
+                hi = end;
+
+            w[j] = (uint32_t) (((uint64_t) (hi - lo) * 65536 + down / 2) / down);
+            total += w[j];
+            if (w[j] > w[largest])
+                largest = j;
+        }
+
+        // fix up rounding so the weights sum to exactly 1.0
+        w[largest] = w[largest] + 65536 - total;
+    }
+
+    // every phase reads r->taps samples (the unused weights are zero)
+    for (unsigned p = 0; p < up; ++p) {
+        if (r->offsets[p] + r->taps > r->span)
+            r->span = r->offsets[p] + r->taps;
+    }
+
+    return true;
+}
+
+// Find up/down for resampling from in_rate to out_rate, if the ratio is
+// (very close to) a fraction with a small enough denominator
+static inline bool resampler_ratio(double in_rate, double out_rate, unsigned *up, unsigned *down)
+{
+    double ratio = in_rate / out_rate;
+    if (ratio < 1.0)
+        return false;
+
+    for (unsigned u = 1; u <= RESAMPLER_MAX_UP; ++u) {
+        double d = ratio * u;
+        unsigned rounded = (unsigned) (d + 0.5);
+        if (rounded >= u && (d - rounded < 1e-6 * d) && (rounded - d < 1e-6 * d)) {
+            *up = u;
+            *down = rounded;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Split a buffer of uint16_t magnitude values into blocks of `block`
+ * samples and store the largest value in each block in out_max. The final
+ * block may be short. out_max must have room for (len + block - 1) / block
+ * entries.
+ */
+
+void STARCH_IMPL(block_max_u16, generic) (const uint16_t *in, unsigned len, unsigned block, uint16_t *out_max)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    for (unsigned base = 0; base < len; base += block) {
+        unsigned n = len - base;
+        if (n > block)
+            n = block;
+
+        const uint16_t * restrict p = in_align + base;
+        uint16_t peak = 0;
+        for (unsigned k = 0; k < n; ++k) {
+            peak = (p[k] > peak ? p[k] : peak);
+        }
+
+        *out_max++ = peak;
+    }
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(block_max_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned len, unsigned block, uint16_t *out_max)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    for (unsigned base = 0; base < len; base += block) {
+        unsigned n = len - base;
+        if (n > block)
+            n = block;
+
+        const uint16_t * restrict p = in_align + base;
+        uint16x8_t peak_x8 = vdupq_n_u16(0);
+
+        unsigned n8 = n >> 3;
+        while (n8--) {
+            peak_x8 = vmaxq_u16(peak_x8, vld1q_u16(p));
+            p += 8;
+        }
+
+        // reduce across lanes
+        uint16x4_t peak_x4 = vmax_u16(vget_low_u16(peak_x8), vget_high_u16(peak_x8));
+        peak_x4 = vpmax_u16(peak_x4, peak_x4);
+        peak_x4 = vpmax_u16(peak_x4, peak_x4);
+        uint16_t peak = vget_lane_u16(peak_x4, 0);
+
+        unsigned n1 = n & 7;
+        while (n1--) {
+            peak = (p[0] > peak ? p[0] : peak);
+            ++p;
+        }
+
+        *out_max++ = peak;
+    }
+}
+
+#endif
@@ -56,3 +56,29 @@ void STARCH_IMPL_REQUIRES(count_above_u16, neon, STARCH_FEATURE_NEON) (const uin
 }
 
 #endif
+
+#ifdef STARCH_FEATURE_AVX512
+
+#include <immintrin.h>
+
+void STARCH_IMPL_REQUIRES(count_above_u16, avx512, STARCH_FEATURE_AVX512) (const uint16_t *in, unsigned len, uint16_t threshold, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    const __m512i threshold_x32 = _mm512_set1_epi16((short) threshold);
+
+    // 32 samples per iteration; the final partial block uses a masked load and compare
+    unsigned count = 0;
+    while (len > 0) {
+        unsigned n = (len < 32 ? len : 32);
+        __mmask32 mask = (__mmask32) (0xFFFFFFFFU >> (32 - n));
+        __m512i mag = _mm512_maskz_loadu_epi16(mask, in_align);
+        count += (unsigned) __builtin_popcount(_mm512_mask_cmpge_epu16_mask(mask, mag, threshold_x32));
+
+        in_align += n;
+        len -= n;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_AVX512 */
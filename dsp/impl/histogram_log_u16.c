@@ -0,0 +1,45 @@
+#include "dsp/helpers/log_histogram.h"
+
+/*
+ * Add every stride'th sample of a uint16_t buffer, starting with the first,
+ * to a log-scale histogram (see dsp/helpers/log_histogram.h). The histogram
+ * has LOG_HISTOGRAM_BUCKETS counters, which are incremented, not reset.
+ */
+
+void STARCH_IMPL(histogram_log_u16, generic) (const uint16_t *in, unsigned len, unsigned stride, unsigned *histogram)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    for (unsigned i = 0; i < len; i += stride) {
+        ++histogram[log_histogram_bucket(in_align[i])];
+    }
+}
+
+/*
+ * Compute the bucket indexes a block at a time, which the compiler can
+ * vectorize, then do the (inherently serial) counter updates.
+ */
+
+#ifndef HISTOGRAM_LOG_BLOCK
+#define HISTOGRAM_LOG_BLOCK 256
+#endif
+
+void STARCH_IMPL(histogram_log_u16, blocked) (const uint16_t *in, unsigned len, unsigned stride, unsigned *histogram)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t buckets[HISTOGRAM_LOG_BLOCK];
+
+    unsigned remaining = (len + stride - 1) / stride;
+    while (remaining > 0) {
+        unsigned n = (remaining > HISTOGRAM_LOG_BLOCK ? HISTOGRAM_LOG_BLOCK : remaining);
+
+        for (unsigned i = 0; i < n; ++i)
+            buckets[i] = log_histogram_bucket(in_align[i * stride]);
+
+        for (unsigned i = 0; i < n; ++i)
+            ++histogram[buckets[i]];
+
+        in_align += n * stride;
+        remaining -= n;
+    }
+}
@@ -0,0 +1,94 @@
+#include <math.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/dc_filter.h"
+#include "dsp/helpers/preamble_bitmap.h"
+
+/*
+ * Convert UC8 values to unsigned 16-bit magnitudes removing the DC offset
+ * (as magnitude_dc_uc8), measure mean level and power (as mean_power_u16),
+ * and build a preamble candidate bitmap (as preamble_bitmap_u16) for the
+ * output.
+ */
+
+/* Separate passes, for comparison */
+void STARCH_IMPL(magnitude_dc_power_preamble_uc8, twopass) (const uc8_t *in, uint16_t *out, unsigned len, dc_filter_t *state, double *out_level, double *out_power, uint64_t *bitmap)
+{
+#if STARCH_ALIGNMENT > 1
+    starch_magnitude_dc_uc8_aligned(in, out, len, state);
+    starch_mean_power_u16_aligned(out, len, out_level, out_power);
+    starch_preamble_bitmap_u16_aligned(out, len, bitmap);
+#else
+    starch_magnitude_dc_uc8(in, out, len, state);
+    starch_mean_power_u16(out, len, out_level, out_power);
+    starch_preamble_bitmap_u16(out, len, bitmap);
+#endif
+}
+
+/*
+ * Fused: accumulate level and power in the magnitude loop of each filter
+ * block, then build the bitmap for as much of the output as has enough
+ * lookahead, while the block is still in L1 cache.
+ */
+void STARCH_IMPL(magnitude_dc_power_preamble_uc8, fused) (const uc8_t *in, uint16_t *out, unsigned len, dc_filter_t *state, double *out_level, double *out_power, uint64_t *bitmap)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    double sum_level = 0;
+    double sum_power = 0;
+
+    unsigned converted = 0;     // samples converted so far
+    unsigned mapped = 0;        // samples covered by the bitmap so far (a multiple of 64)
+
+    while (converted < len) {
+        unsigned n = len - converted;
+        if (n > DC_FILTER_BLOCK)
+            n = DC_FILTER_BLOCK;
+
+        const float dc_I = state->dc_I;
+        const float dc_Q = state->dc_Q;
+        const uc8_t * restrict block_in = in_align + converted;
+        uint16_t * restrict block_out = out_align + converted;
+
+        // a block is short enough that none of these sums can overflow
+        unsigned sum_I = 0, sum_Q = 0;
+        uint32_t level32 = 0, power32 = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            unsigned rawI = block_in[i].I;
+            unsigned rawQ = block_in[i].Q;
+            sum_I += rawI;
+            sum_Q += rawQ;
+
+            float I = rawI - dc_I;
+            float Q = rawQ - dc_Q;
+            float mag = sqrtf(I * I + Q * Q) * 512.0f;
+            if (mag > 65535.0f)
+                mag = 65535.0f;
+
+            uint16_t mag16 = (uint16_t) mag;
+            block_out[i] = mag16;
+            level32 += mag16;
+            power32 += ((uint32_t) mag16 * mag16) >> 16;
+        }
+
+        dc_filter_update(state, sum_I, sum_Q, n);
+
+        sum_level += level32;
+        sum_power += power32;
+        converted += n;
+
+        unsigned ready = converted - mapped;
+        if (ready > PREAMBLE_BITMAP_LOOKAHEAD) {
+            unsigned words = (ready - PREAMBLE_BITMAP_LOOKAHEAD) / 64;
+            preamble_bitmap_words(out_align + mapped, words, bitmap + mapped / 64);
+            mapped += words * 64;
+        }
+    }
+
+    preamble_bitmap_tail(out_align + mapped, len - mapped, bitmap + mapped / 64);
+
+    *out_level = sum_level / len / 65536.0;
+    *out_power = sum_power / len / 65536.0;
+}
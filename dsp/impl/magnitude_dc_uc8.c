@@ -0,0 +1,43 @@
+#include <math.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/dc_filter.h"
+
+/* Convert UC8 values to unsigned 16-bit magnitudes,
+ * removing the DC offset tracked in *state (see dsp/helpers/dc_filter.h)
+ * and updating it
+ */
+
+void STARCH_IMPL(magnitude_dc_uc8, float) (const uc8_t *in, uint16_t *out, unsigned len, dc_filter_t *state)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    while (len > 0) {
+        unsigned n = (len < DC_FILTER_BLOCK ? len : DC_FILTER_BLOCK);
+        const float dc_I = state->dc_I;
+        const float dc_Q = state->dc_Q;
+
+        unsigned sum_I = 0, sum_Q = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            unsigned rawI = in_align[i].I;
+            unsigned rawQ = in_align[i].Q;
+            sum_I += rawI;
+            sum_Q += rawQ;
+
+            float I = rawI - dc_I;
+            float Q = rawQ - dc_Q;
+            float mag = sqrtf(I * I + Q * Q) * 512.0f;
+            if (mag > 65535.0f)
+                mag = 65535.0f;
+            out_align[i] = (uint16_t) mag;
+        }
+
+        dc_filter_update(state, sum_I, sum_Q, n);
+
+        in_align += n;
+        out_align += n;
+        len -= n;
+    }
+}
@@ -0,0 +1,74 @@
+#include <inttypes.h>
+
+#include "dsp/helpers/preamble_bitmap.h"
+
+/*
+ * Convert UC8 values to unsigned 16-bit magnitudes, measure mean level and
+ * power (as magnitude_power_uc8), and build a preamble candidate bitmap
+ * (as preamble_bitmap_u16) for the output.
+ */
+
+/* Separate passes, for comparison */
+void STARCH_IMPL(magnitude_power_preamble_uc8, twopass) (const uc8_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power, uint64_t *bitmap)
+{
+#if STARCH_ALIGNMENT > 1
+    starch_magnitude_power_uc8_aligned(in, out, len, out_level, out_power);
+    starch_preamble_bitmap_u16_aligned(out, len, bitmap);
+#else
+    starch_magnitude_power_uc8(in, out, len, out_level, out_power);
+    starch_preamble_bitmap_u16(out, len, bitmap);
+#endif
+}
+
+/*
+ * Fused: convert a chunk of samples, measure it, then build the bitmap for
+ * as much of the output as has enough lookahead, while the chunk is still
+ * in L1 cache.
+ */
+
+#ifndef MAGNITUDE_POWER_PREAMBLE_CHUNK
+#define MAGNITUDE_POWER_PREAMBLE_CHUNK 2048
+#endif
+
+void STARCH_IMPL(magnitude_power_preamble_uc8, chunked) (const uc8_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power, uint64_t *bitmap)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    double sum_level = 0;
+    double sum_power = 0;
+
+    unsigned converted = 0;     // samples converted so far
+    unsigned mapped = 0;        // samples covered by the bitmap so far (a multiple of 64)
+
+    while (converted < len) {
+        unsigned n = len - converted;
+        if (n > MAGNITUDE_POWER_PREAMBLE_CHUNK)
+            n = MAGNITUDE_POWER_PREAMBLE_CHUNK;
+
+        // chunks are a multiple of the alignment, so alignment is preserved
+        double level, power;
+#if STARCH_ALIGNMENT > 1
+        starch_magnitude_uc8_aligned(in_align + converted, out_align + converted, n);
+        starch_mean_power_u16_aligned(out_align + converted, n, &level, &power);
+#else
+        starch_magnitude_uc8(in_align + converted, out_align + converted, n);
+        starch_mean_power_u16(out_align + converted, n, &level, &power);
+#endif
+        sum_level += level * n;
+        sum_power += power * n;
+        converted += n;
+
+        unsigned ready = converted - mapped;
+        if (ready > PREAMBLE_BITMAP_LOOKAHEAD) {
+            unsigned words = (ready - PREAMBLE_BITMAP_LOOKAHEAD) / 64;
+            preamble_bitmap_words(out_align + mapped, words, bitmap + mapped / 64);
+            mapped += words * 64;
+        }
+    }
+
+    preamble_bitmap_tail(out_align + mapped, len - mapped, bitmap + mapped / 64);
+
+    *out_level = sum_level / len;
+    *out_power = sum_power / len;
+}
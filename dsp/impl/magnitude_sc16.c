@@ -99,3 +99,37 @@ void STARCH_IMPL_REQUIRES(magnitude_sc16, neon_vrsqrte, STARCH_FEATURE_NEON) (co
 }
 
 #endif /* STARCH_FEATURE_NEON */
+
+#ifdef STARCH_FEATURE_AVX512
+
+#include <immintrin.h>
+
+void STARCH_IMPL_REQUIRES(magnitude_sc16, avx512_float, STARCH_FEATURE_AVX512) (const sc16_t *in, uint16_t *out, unsigned len)
+{
+    const sc16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const __m512 scale = _mm512_set1_ps(2.0f);
+    const __m512 limit = _mm512_set1_ps(65535.0f);
+
+    // 16 samples per iteration; the final partial block uses masked loads/stores
+    while (len > 0) {
+        unsigned n = (len < 16 ? len : 16);
+        __mmask16 mask = (__mmask16) (0xFFFFU >> (16 - n));
+
+        // I*I + Q*Q via a multiply-add of adjacent 16-bit lanes. The result
+        // is at most 2^31, which fits as an unsigned 32-bit value.
+        __m512i iq = _mm512_maskz_loadu_epi32(mask, in_align);
+        __m512i magsq = _mm512_madd_epi16(iq, iq);
+
+        __m512 mag = _mm512_sqrt_ps(_mm512_cvtepu32_ps(magsq));
+        mag = _mm512_min_ps(_mm512_mul_ps(mag, scale), limit);
+        _mm512_mask_cvtusepi32_storeu_epi16(out_align, mask, _mm512_cvttps_epu32(mag));
+
+        in_align += n;
+        out_align += n;
+        len -= n;
+    }
+}
+
+#endif /* STARCH_FEATURE_AVX512 */
@@ -120,3 +120,52 @@ void STARCH_IMPL_REQUIRES(mean_power_u16, neon_float, STARCH_FEATURE_NEON) (cons
 }
 
 #endif /* STARCH_FEATURE_NEON */
+
+#ifdef STARCH_FEATURE_AVX512
+
+#include <immintrin.h>
+
+// Same results as the u32 implementation: per-lane 32-bit sums over blocks
+// of at most 65536 samples, so no lane can overflow.
+void STARCH_IMPL_REQUIRES(mean_power_u16, avx512, STARCH_FEATURE_AVX512) (const uint16_t *in, unsigned len, double *out_mean_mag, double *out_mean_magsq)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    uint64_t sum = 0, sumsq = 0;
+
+    unsigned remaining = len;
+    while (remaining > 0) {
+        __m512i sum32 = _mm512_setzero_si512();
+        __m512i sumsq32 = _mm512_setzero_si512();
+        unsigned blocklen = (remaining > 65536 ? 65536 : remaining);
+        remaining -= blocklen;
+
+        // 32 samples per iteration; masked-off lanes load as zero
+        while (blocklen > 0) {
+            unsigned n = (blocklen < 32 ? blocklen : 32);
+            __mmask32 mask = (__mmask32) (0xFFFFFFFFU >> (32 - n));
+            __m512i mag16 = _mm512_maskz_loadu_epi16(mask, in_align);
+
+            __m512i mag_0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(mag16));
+            __m512i mag_1 = _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(mag16, 1));
+
+            sum32 = _mm512_add_epi32(sum32, _mm512_add_epi32(mag_0, mag_1));
+            sumsq32 = _mm512_add_epi32(sumsq32, _mm512_srli_epi32(_mm512_mullo_epi32(mag_0, mag_0), 16));
+            sumsq32 = _mm512_add_epi32(sumsq32, _mm512_srli_epi32(_mm512_mullo_epi32(mag_1, mag_1), 16));
+
+            in_align += n;
+            blocklen -= n;
+        }
+
+        // the lane total can exceed 32 bits, so widen before reducing
+        sum += _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepu32_epi64(_mm512_castsi512_si256(sum32)),
+                                                        _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(sum32, 1))));
+        sumsq += _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepu32_epi64(_mm512_castsi512_si256(sumsq32)),
+                                                          _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(sumsq32, 1))));
+    }
+
+    *out_mean_mag = (double)sum / len / 65536.0;
+    *out_mean_magsq = (double)sumsq / len / 65536.0;
+}
+
+#endif /* STARCH_FEATURE_AVX512 */
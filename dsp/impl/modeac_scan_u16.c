@@ -0,0 +1,99 @@
+/*
+ * Scan a buffer of uint16_t magnitude values for possible Mode A/C messages:
+ * offsets where a F1 framing pulse and the following F2 framing pulse both
+ * pass the quick checks made by demodulate2400AC.
+ *
+ * A framing pulse starting at sample i passes if:
+ *
+ *   in[i-1] < in[i]                            rising edge
+ *   in[i+2] <= in[i] && in[i+2] <= in[i+1]     quiet part of the bit is quiet
+ *   in[i] + in[i+1] >= threshold               strong enough
+ *
+ * F2 starts 20.3us after F1, which is 48 or 49 samples later depending on
+ * the clock phase of F1; either is accepted here, and the demodulator makes
+ * the exact check. So the output is a superset of the offsets that
+ * demodulate2400AC would accept as framing pulse pairs.
+ *
+ * Offsets 1..len (inclusive) are tested, so in[0] .. in[len+51] must be
+ * readable. The offsets that pass are written in ascending order to
+ * out_offsets, which must have room for len entries, and the number of
+ * offsets written is stored in out_count.
+ */
+
+#include <string.h>
+
+#ifndef MODEAC_SCAN_PULSE
+#define MODEAC_SCAN_PULSE(_p, _threshold) \
+    ((_p)[-1] < (_p)[0] && (_p)[2] <= (_p)[0] && (_p)[2] <= (_p)[1] && (unsigned) (_p)[0] + (_p)[1] >= (_threshold))
+#endif
+
+void STARCH_IMPL(modeac_scan_u16, generic) (const uint16_t *in, unsigned len, unsigned threshold, unsigned *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    unsigned count = 0;
+    for (unsigned i = 1; i <= len; ++i) {
+        const uint16_t *f1 = &in_align[i];
+        if (!MODEAC_SCAN_PULSE(f1, threshold))
+            continue;
+
+        if (MODEAC_SCAN_PULSE(f1 + 48, threshold) || MODEAC_SCAN_PULSE(f1 + 49, threshold))
+            out_offsets[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+/*
+ * Branch-free version: first compute a pulse flag for every sample in a
+ * block (which the compiler can vectorize), then combine the F1 and F2 flags,
+ * then skip quickly over the (usually long) runs with no candidates.
+ */
+#ifndef MODEAC_SCAN_BLOCK
+#define MODEAC_SCAN_BLOCK 256
+#endif
+
+void STARCH_IMPL(modeac_scan_u16, blocked) (const uint16_t *in, unsigned len, unsigned threshold, unsigned *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    uint8_t pulse[MODEAC_SCAN_BLOCK + 49];
+    uint8_t candidate[MODEAC_SCAN_BLOCK];
+
+    unsigned count = 0;
+    for (unsigned base = 1; base <= len; base += MODEAC_SCAN_BLOCK) {
+        unsigned n = len + 1 - base;
+        if (n > MODEAC_SCAN_BLOCK)
+            n = MODEAC_SCAN_BLOCK;
+
+        // pulse[k] is the pulse flag for offset base + k, p[k] is the sample before it
+        const uint16_t * restrict p = in_align + base - 1;
+        for (unsigned k = 0; k < n + 49; ++k) {
+            unsigned rising = (p[k] < p[k + 1]);
+            unsigned quiet = (p[k + 3] <= p[k + 1]) & (p[k + 3] <= p[k + 2]);
+            unsigned strong = ((unsigned) p[k + 1] + p[k + 2] >= threshold);
+            pulse[k] = rising & quiet & strong;
+        }
+
+        for (unsigned k = 0; k < n; ++k) {
+            candidate[k] = pulse[k] & (pulse[k + 48] | pulse[k + 49]);
+        }
+        for (unsigned k = n; k & 7; ++k) {
+            candidate[k] = 0;
+        }
+
+        for (unsigned k = 0; k < n; k += 8) {
+            uint64_t word;
+            memcpy(&word, &candidate[k], sizeof(word));
+            if (!word)
+                continue;
+
+            for (unsigned j = k; j < k + 8 && j < n; ++j) {
+                out_offsets[count] = base + j;
+                count += candidate[j];
+            }
+        }
+    }
+
+    *out_count = count;
+}
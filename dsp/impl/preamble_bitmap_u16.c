@@ -0,0 +1,13 @@
+#include "dsp/helpers/preamble_bitmap.h"
+
+/*
+ * Build a preamble candidate bitmap (see dsp/helpers/preamble_bitmap.h)
+ * for a buffer of uint16_t magnitudes. The bitmap must have room for
+ * PREAMBLE_BITMAP_WORDS(len) words.
+ */
+
+void STARCH_IMPL(preamble_bitmap_u16, generic) (const uint16_t *in, unsigned len, uint64_t *bitmap)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    preamble_bitmap_fill(in_align, len, bitmap);
+}
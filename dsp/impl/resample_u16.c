@@ -0,0 +1,76 @@
+/*
+ * Reduce the sample rate of a buffer of uint16_t magnitude values using a
+ * polyphase filter (see resampler_t in dsp-types.h). `groups` groups of
+ * r->up output samples are written to `out`, consuming groups * r->down
+ * input samples; (groups - 1) * r->down + r->span input samples are read.
+ */
+
+void STARCH_IMPL(resample_u16, generic) (const uint16_t *in, uint16_t *out, unsigned groups, const resampler_t *r)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const unsigned up = r->up;
+    const unsigned down = r->down;
+    const unsigned taps = r->taps;
+
+    for (unsigned g = 0; g < groups; ++g) {
+        for (unsigned p = 0; p < up; ++p) {
+            const uint16_t *src = in_align + r->offsets[p];
+            const uint32_t *w = &r->weights[p * RESAMPLER_MAX_TAPS];
+
+            uint32_t sum = 32768;
+            for (unsigned j = 0; j < taps; ++j)
+                sum += src[j] * w[j];
+            out_align[p] = sum >> 16;
+        }
+
+        in_align += down;
+        out_align += up;
+    }
+}
+
+/*
+ * Phase-major version: for each output phase, run down a block of groups
+ * with fixed weights, so the inner loop is a strided multiply-accumulate
+ * that can use vector gathers where they are available.
+ */
+#ifndef RESAMPLE_U16_BLOCK
+#define RESAMPLE_U16_BLOCK 256
+#endif
+
+void STARCH_IMPL(resample_u16, phase_major) (const uint16_t *in, uint16_t *out, unsigned groups, const resampler_t *r)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const unsigned up = r->up;
+    const unsigned down = r->down;
+    const unsigned taps = r->taps;
+
+    uint32_t sum[RESAMPLE_U16_BLOCK];
+
+    for (unsigned g0 = 0; g0 < groups; g0 += RESAMPLE_U16_BLOCK) {
+        unsigned n = groups - g0;
+        if (n > RESAMPLE_U16_BLOCK)
+            n = RESAMPLE_U16_BLOCK;
+
+        const uint16_t * restrict block_in = in_align + g0 * down;
+        uint16_t * restrict block_out = out_align + g0 * up;
+
+        for (unsigned p = 0; p < up; ++p) {
+            for (unsigned g = 0; g < n; ++g)
+                sum[g] = 32768;
+
+            for (unsigned j = 0; j < taps; ++j) {
+                const uint16_t * restrict src = block_in + r->offsets[p] + j;
+                const uint32_t w = r->weights[p * RESAMPLER_MAX_TAPS + j];
+                for (unsigned g = 0; g < n; ++g)
+                    sum[g] += src[g * down] * w;
+            }
+
+            for (unsigned g = 0; g < n; ++g)
+                block_out[g * up + p] = sum[g] >> 16;
+        }
+    }
+}
@@ -17,12 +17,23 @@ gen.add_include('"cpu.h"')
 
 gen.add_function(name = 'magnitude_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'magnitude_power_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_power_preamble_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'double *', 'double *', 'uint64_t *'], aligned = True)
 gen.add_function(name = 'magnitude_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'magnitude_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
+gen.add_function(name = 'magnitude_dc_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'dc_filter_t *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_power_preamble_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'dc_filter_t *', 'double *', 'double *', 'uint64_t *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'dc_filter_t *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'dc_filter_t *'], aligned = True)
+gen.add_function(name = 'resample_u16', argtypes = ['const uint16_t *', 'uint16_t *', 'unsigned', 'const resampler_t *'], aligned = True)
 gen.add_function(name = 'mean_power_u16', argtypes = ['const uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'count_above_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint16_t', 'unsigned *'], aligned = True)
+gen.add_function(name = 'preamble_bitmap_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint64_t *'], aligned = True)
+gen.add_function(name = 'histogram_log_u16', argtypes = ['const uint16_t *', 'unsigned', 'unsigned', 'unsigned *'], aligned = True)
+gen.add_function(name = 'modeac_scan_u16', argtypes = ['const uint16_t *', 'unsigned', 'unsigned', 'unsigned *', 'unsigned *'], aligned = True)
+gen.add_function(name = 'block_max_u16', argtypes = ['const uint16_t *', 'unsigned', 'unsigned', 'uint16_t *'], aligned = True)
 
 gen.add_feature(name='neon', description='ARM NEON')
+gen.add_feature(name='avx512', description='x86 AVX-512 (F, BW)')
 
 gen.add_flavor(name = 'generic',
                description = 'Generic build, default compiler options',
@@ -44,6 +55,12 @@ gen.add_flavor(name = 'x86_avx2',
                compile_flags = ['-mavx2', '-ffast-math'],
                test_function = 'cpu_supports_avx2',
                alignment = 32)
+gen.add_flavor(name = 'x86_avx512',
+               description = 'x86 with AVX-512 (F, BW)',
+               compile_flags = ['-mavx512f', '-mavx512bw', '-mpopcnt', '-ffast-math'],
+               features = ['avx512'],
+               test_function = 'cpu_supports_avx512',
+               alignment = 32)
 
 gen.add_mix(name = 'generic',
             description = 'Generic build, compiler defaults only',
@@ -62,7 +79,7 @@ gen.add_mix(name = 'aarch64',
 
 gen.add_mix(name = 'x86',
             description = 'x64',
-            flavors = ['x86_avx2', 'generic'],
+            flavors = ['x86_avx512', 'x86_avx2', 'generic'],
             wisdom_file = 'wisdom.x86')
 
 for pattern in ['dsp/impl/*.c', 'dsp/benchmark/*.c']:
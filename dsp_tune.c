@@ -0,0 +1,639 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// dsp_tune.c: in-process DSP implementation selection
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// we want dl_iterate_phdr if available
+#define _GNU_SOURCE
+
+#include "dump1090.h"
+#include "dsp_tune.h"
+#include "dsp/helpers/log_histogram.h"
+#include "dsp/helpers/preamble_bitmap.h"
+#include "dsp/helpers/resampler.h"
+
+#ifdef __ELF__
+#include <link.h>
+#endif
+
+//
+// This is a cut-down version of what starch-benchmark does: time each
+// runtime-supported implementation of each starch function on a buffer of
+// synthetic data, then rank the implementations by time per call. The
+// result is written to a wisdom file (in the same format as
+// starch-benchmark's output) named for the CPU model and the build, so
+// that later runs on the same hardware with the same binary can just load
+// it.
+//
+
+#define DSP_TUNE_SAMPLES 65536      // samples per call
+#define DSP_TUNE_PAD 64             // extra readable samples past the end (modeac_scan_u16 reads ahead)
+#define DSP_TUNE_ALIGNMENT 64       // at least as large as any STARCH_MIX_ALIGNMENT
+
+static const uint64_t dsp_tune_batch_ns = 2000000;  // each timed batch runs for at least this long
+static const unsigned dsp_tune_batches = 5;         // use the best of this many batches
+static const unsigned dsp_tune_warmup_calls = 2;    // untimed calls before the first batch
+
+// measured results
+struct dsp_tune_result {
+    char *function;
+    char *impl;
+    uint64_t ns;
+};
+
+static struct dsp_tune_result *dsp_tune_results;
+static unsigned dsp_tune_result_count;
+static unsigned dsp_tune_result_size;
+
+// inputs and outputs for the benchmark calls; unaligned calls use
+// pointers that are one element past the aligned buffers
+struct dsp_tune_args {
+    const uc8_t *uc8;
+    const sc16_t *sc16;
+    const uint16_t *mag;
+    uint16_t *out;
+};
+
+static struct {
+    uc8_t *uc8;
+    sc16_t *sc16;
+    uint16_t *mag;
+    uint16_t *out;
+    uint64_t *bitmap;
+    unsigned *histogram;
+    unsigned *offsets;
+    uint16_t *peaks;
+    double level;
+    double power;
+    unsigned count;
+    dc_filter_t dc_filter;
+    resampler_t resampler;
+    unsigned resample_groups;
+} dsp_tune_data;
+
+// background tuning state
+static pthread_t dsp_tune_thread;
+static bool dsp_tune_thread_running;
+static atomic_bool dsp_tune_stopping;
+static char *dsp_tune_cache_path;
+
+static uint64_t dsp_tune_elapsed(const struct timespec *start, const struct timespec *end)
+{
+    return ((uint64_t) end->tv_sec - (uint64_t) start->tv_sec) * 1000000000U + (uint64_t) end->tv_nsec - (uint64_t) start->tv_nsec;
+}
+
+static void dsp_tune_record(const char *function, const char *impl, uint64_t ns)
+{
+    if (dsp_tune_result_count >= dsp_tune_result_size) {
+        unsigned newsize = (dsp_tune_result_size ? dsp_tune_result_size * 2 : 64);
+        struct dsp_tune_result *newresults = realloc(dsp_tune_results, newsize * sizeof(*newresults));
+        if (!newresults) {
+            fprintf(stderr, "dsp_tune: out of memory\n");
+            return;
+        }
+        dsp_tune_results = newresults;
+        dsp_tune_result_size = newsize;
+    }
+
+    struct dsp_tune_result *result = &dsp_tune_results[dsp_tune_result_count];
+    if (!(result->function = strdup(function)) || !(result->impl = strdup(impl))) {
+        free(result->function);
+        fprintf(stderr, "dsp_tune: out of memory\n");
+        return;
+    }
+    result->ns = ns;
+    ++dsp_tune_result_count;
+}
+
+static void dsp_tune_clear_results(void)
+{
+    for (unsigned i = 0; i < dsp_tune_result_count; ++i) {
+        free(dsp_tune_results[i].function);
+        free(dsp_tune_results[i].impl);
+    }
+    dsp_tune_result_count = 0;
+}
+
+uint64_t dsp_tune_ns(const char *function, const char *impl)
+{
+    for (unsigned i = 0; i < dsp_tune_result_count; ++i) {
+        if (!strcmp(dsp_tune_results[i].function, function) && !strcmp(dsp_tune_results[i].impl, impl))
+            return dsp_tune_results[i].ns;
+    }
+    return 0;
+}
+
+// Time one call, as the best time per call over several batches
+#define DSP_TUNE_TIME(_ns, _call) do {                                  \
+        for (unsigned _i = 0; _i < dsp_tune_warmup_calls; ++_i)         \
+            _call;                                                      \
+        (_ns) = UINT64_MAX;                                             \
+        for (unsigned _batch = 0; _batch < dsp_tune_batches; ++_batch) { \
+            struct timespec _start, _end;                               \
+            uint64_t _calls = 0, _elapsed;                              \
+            start_cpu_timing(&_start);                                  \
+            do {                                                        \
+                _call;                                                  \
+                ++_calls;                                               \
+                start_cpu_timing(&_end);                                \
+                _elapsed = dsp_tune_elapsed(&_start, &_end);            \
+            } while (_elapsed < dsp_tune_batch_ns);                     \
+            if (_elapsed / _calls < (_ns))                              \
+                (_ns) = _elapsed / _calls;                              \
+        }                                                               \
+    } while (0)
+
+// Define the tuning function for one starch function
+#define DSP_TUNE_FUNCTION(_name, ...)                                   \
+    static void dsp_tune_ ## _name (const struct dsp_tune_args *args)   \
+    {                                                                   \
+        for (starch_ ## _name ## _regentry *entry = starch_ ## _name ## _registry; entry->name; ++entry) { \
+            if (atomic_load(&dsp_tune_stopping))                        \
+                return;                                                 \
+            if (entry->flavor_supported && !entry->flavor_supported())  \
+                continue;                                               \
+            uint64_t ns;                                                \
+            DSP_TUNE_TIME(ns, entry->callable(__VA_ARGS__));            \
+            dsp_tune_record(#_name, entry->name, ns);                   \
+        }                                                               \
+    }
+
+// FNV-1a
+static uint64_t dsp_tune_hash(uint64_t hash, const char *s)
+{
+    for (; *s; ++s) {
+        hash ^= (unsigned char) *s;
+        hash *= UINT64_C(0x100000001b3);
+    }
+    // and the terminating NUL, so that "ab","c" and "a","bc" hash differently
+    hash *= UINT64_C(0x100000001b3);
+    return hash;
+}
+
+#define DSP_TUNE_FUNCTION_PAIR(_name, ...)                              \
+    DSP_TUNE_FUNCTION(_name, __VA_ARGS__)                               \
+    DSP_TUNE_FUNCTION(_name ## _aligned, __VA_ARGS__)
+
+DSP_TUNE_FUNCTION_PAIR(magnitude_uc8, args->uc8, args->out, DSP_TUNE_SAMPLES)
+DSP_TUNE_FUNCTION_PAIR(magnitude_power_uc8, args->uc8, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.level, &dsp_tune_data.power)
+DSP_TUNE_FUNCTION_PAIR(magnitude_power_preamble_uc8, args->uc8, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.level, &dsp_tune_data.power, dsp_tune_data.bitmap)
+DSP_TUNE_FUNCTION_PAIR(magnitude_sc16, args->sc16, args->out, DSP_TUNE_SAMPLES)
+DSP_TUNE_FUNCTION_PAIR(magnitude_sc16q11, args->sc16, args->out, DSP_TUNE_SAMPLES)
+DSP_TUNE_FUNCTION_PAIR(magnitude_dc_uc8, args->uc8, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.dc_filter)
+DSP_TUNE_FUNCTION_PAIR(magnitude_dc_power_preamble_uc8, args->uc8, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.dc_filter, &dsp_tune_data.level, &dsp_tune_data.power, dsp_tune_data.bitmap)
+DSP_TUNE_FUNCTION_PAIR(magnitude_dc_sc16, args->sc16, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.dc_filter)
+DSP_TUNE_FUNCTION_PAIR(magnitude_dc_sc16q11, args->sc16, args->out, DSP_TUNE_SAMPLES, &dsp_tune_data.dc_filter)
+DSP_TUNE_FUNCTION_PAIR(resample_u16, args->mag, args->out, dsp_tune_data.resample_groups, &dsp_tune_data.resampler)
+DSP_TUNE_FUNCTION_PAIR(mean_power_u16, args->mag, DSP_TUNE_SAMPLES, &dsp_tune_data.level, &dsp_tune_data.power)
+DSP_TUNE_FUNCTION_PAIR(count_above_u16, args->mag, DSP_TUNE_SAMPLES, 10000, &dsp_tune_data.count)
+DSP_TUNE_FUNCTION_PAIR(preamble_bitmap_u16, args->mag, DSP_TUNE_SAMPLES, dsp_tune_data.bitmap)
+DSP_TUNE_FUNCTION_PAIR(histogram_log_u16, args->mag, DSP_TUNE_SAMPLES, 4, dsp_tune_data.histogram)
+DSP_TUNE_FUNCTION_PAIR(modeac_scan_u16, args->mag, DSP_TUNE_SAMPLES, 4000, dsp_tune_data.offsets, &dsp_tune_data.count)
+DSP_TUNE_FUNCTION_PAIR(block_max_u16, args->mag, DSP_TUNE_SAMPLES, BURST_SQUELCH_BLOCK, dsp_tune_data.peaks)
+
+static const struct {
+    const char *name;
+    bool aligned;
+    void (*tune)(const struct dsp_tune_args *args);
+    void (*set_wisdom)(const char * const *wisdom);
+} dsp_tune_functions[] = {
+#define DSP_TUNE_ENTRY(_name)                                           \
+    { #_name, false, dsp_tune_ ## _name, starch_ ## _name ## _set_wisdom }, \
+    { #_name "_aligned", true, dsp_tune_ ## _name ## _aligned, starch_ ## _name ## _aligned_set_wisdom }
+
+    DSP_TUNE_ENTRY(magnitude_uc8),
+    DSP_TUNE_ENTRY(magnitude_power_uc8),
+    DSP_TUNE_ENTRY(magnitude_power_preamble_uc8),
+    DSP_TUNE_ENTRY(magnitude_sc16),
+    DSP_TUNE_ENTRY(magnitude_sc16q11),
+    DSP_TUNE_ENTRY(magnitude_dc_uc8),
+    DSP_TUNE_ENTRY(magnitude_dc_power_preamble_uc8),
+    DSP_TUNE_ENTRY(magnitude_dc_sc16),
+    DSP_TUNE_ENTRY(magnitude_dc_sc16q11),
+    DSP_TUNE_ENTRY(resample_u16),
+    DSP_TUNE_ENTRY(mean_power_u16),
+    DSP_TUNE_ENTRY(count_above_u16),
+    DSP_TUNE_ENTRY(preamble_bitmap_u16),
+    DSP_TUNE_ENTRY(histogram_log_u16),
+    DSP_TUNE_ENTRY(modeac_scan_u16),
+    DSP_TUNE_ENTRY(block_max_u16),
+
+#undef DSP_TUNE_ENTRY
+    { NULL, false, NULL, NULL }
+};
+
+#ifdef __ELF__
+
+#ifndef NT_GNU_BUILD_ID
+#define NT_GNU_BUILD_ID 3
+#endif
+
+// dl_iterate_phdr callback: format the GNU build-id note of the main
+// program (always the first object reported) as hex into data
+static int dsp_tune_find_build_id(struct dl_phdr_info *info, size_t size, void *data)
+{
+    char *out = data;
+    MODES_NOTUSED(size);
+
+    for (unsigned i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_NOTE)
+            continue;
+
+        const unsigned char *p = (const unsigned char *) (info->dlpi_addr + phdr->p_vaddr);
+        const unsigned char *end = p + phdr->p_memsz;
+        while (p + sizeof(ElfW(Nhdr)) <= end) {
+            const ElfW(Nhdr) *note = (const ElfW(Nhdr) *) p;
+            const unsigned char *name = p + sizeof(*note);
+            const unsigned char *desc = name + ((note->n_namesz + 3) & ~3U);
+            p = desc + ((note->n_descsz + 3) & ~3U);
+            if (p > end)
+                break;
+
+            if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && !memcmp(name, "GNU", 4) &&
+                note->n_descsz > 0 && note->n_descsz <= 32) {
+                char *q = out + sprintf(out, "build-id ");
+                for (unsigned j = 0; j < note->n_descsz; ++j)
+                    q += sprintf(q, "%02x", desc[j]);
+                return 1;
+            }
+        }
+    }
+
+    return 1;   // only look at the main program
+}
+
+#endif /* __ELF__ */
+
+// FNV-1a hash of the running executable, for binaries without a build-id
+static bool dsp_tune_hash_exe(char *out)
+{
+    int fd = open("/proc/self/exe", O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    unsigned char buf[65536];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        for (ssize_t i = 0; i < n; ++i) {
+            hash ^= buf[i];
+            hash *= UINT64_C(0x100000001b3);
+        }
+    }
+    close(fd);
+
+    if (n < 0)
+        return false;
+    sprintf(out, "exe %016" PRIx64, hash);
+    return true;
+}
+
+// The build ID identifies this exact binary: the ELF build-id if the linker
+// added one, otherwise a hash of the executable itself. Any rebuild gets a
+// new ID, so wisdom measured for one binary is never reused by another.
+// Returns NULL if the binary can't be identified; results aren't cached then.
+static const char *dsp_tune_build_id(void)
+{
+    static char build_id[128];
+    static bool looked;
+
+    if (!looked) {
+        looked = true;
+#ifdef __ELF__
+        dl_iterate_phdr(dsp_tune_find_build_id, build_id);
+#endif
+        if (!build_id[0])
+            dsp_tune_hash_exe(build_id);
+    }
+    return build_id[0] ? build_id : NULL;
+}
+
+static char *dsp_tune_cache_file(const char *cache_dir)
+{
+    const char *build_id = dsp_tune_build_id();
+    if (!build_id) {
+        fprintf(stderr, "dsp_tune: can't identify this binary, not caching DSP measurements\n");
+        return NULL;
+    }
+
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    hash = dsp_tune_hash(hash, cpu_model());
+    hash = dsp_tune_hash(hash, build_id);
+
+    size_t len = strlen(cache_dir) + 32;
+    char *path = malloc(len);
+    if (path)
+        snprintf(path, len, "%s/wisdom.%016" PRIx64, cache_dir, hash);
+    return path;
+}
+
+static void *dsp_tune_aligned_alloc(size_t count, size_t size)
+{
+    size_t bytes = (count * size + DSP_TUNE_ALIGNMENT - 1) / DSP_TUNE_ALIGNMENT * DSP_TUNE_ALIGNMENT;
+    void *p = aligned_alloc(DSP_TUNE_ALIGNMENT, bytes);
+    if (p)
+        memset(p, 0, bytes);
+    return p;
+}
+
+static void dsp_tune_free_data(void)
+{
+    free(dsp_tune_data.uc8);
+    free(dsp_tune_data.sc16);
+    free(dsp_tune_data.mag);
+    free(dsp_tune_data.out);
+    free(dsp_tune_data.bitmap);
+    free(dsp_tune_data.histogram);
+    free(dsp_tune_data.offsets);
+    free(dsp_tune_data.peaks);
+    memset(&dsp_tune_data, 0, sizeof(dsp_tune_data));
+}
+
+// Fill the input buffers with noise and occasional strong pulses
+static bool dsp_tune_prepare_data(void)
+{
+    const unsigned n = DSP_TUNE_SAMPLES + DSP_TUNE_PAD + 1;
+
+    dsp_tune_data.uc8 = dsp_tune_aligned_alloc(n, sizeof(uc8_t));
+    dsp_tune_data.sc16 = dsp_tune_aligned_alloc(n, sizeof(sc16_t));
+    dsp_tune_data.mag = dsp_tune_aligned_alloc(n, sizeof(uint16_t));
+    dsp_tune_data.out = dsp_tune_aligned_alloc(n, sizeof(uint16_t));
+    dsp_tune_data.bitmap = dsp_tune_aligned_alloc(PREAMBLE_BITMAP_WORDS(DSP_TUNE_SAMPLES), sizeof(uint64_t));
+    dsp_tune_data.histogram = dsp_tune_aligned_alloc(LOG_HISTOGRAM_BUCKETS, sizeof(unsigned));
+    dsp_tune_data.offsets = dsp_tune_aligned_alloc(DSP_TUNE_SAMPLES, sizeof(unsigned));
+    dsp_tune_data.peaks = dsp_tune_aligned_alloc(DSP_TUNE_SAMPLES / BURST_SQUELCH_BLOCK + 1, sizeof(uint16_t));
+
+    if (!dsp_tune_data.uc8 || !dsp_tune_data.sc16 || !dsp_tune_data.mag || !dsp_tune_data.out ||
+        !dsp_tune_data.bitmap || !dsp_tune_data.histogram || !dsp_tune_data.offsets ||
+        !dsp_tune_data.peaks) {
+        fprintf(stderr, "dsp_tune: out of memory\n");
+        dsp_tune_free_data();
+        return false;
+    }
+
+    uint32_t state = 1;
+    for (unsigned i = 0; i < n; ++i) {
+        // xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        int amplitude = ((state >> 24) % 256 < 4 ? 100 : 8);
+        int I = (int) (state & 0xFF) % (2 * amplitude + 1) - amplitude;
+        int Q = (int) ((state >> 8) & 0xFF) % (2 * amplitude + 1) - amplitude;
+
+        dsp_tune_data.uc8[i].I = (uint8_t) (127 + I);
+        dsp_tune_data.uc8[i].Q = (uint8_t) (127 + Q);
+        dsp_tune_data.sc16[i].I = (int16_t) (I * 256);
+        dsp_tune_data.sc16[i].Q = (int16_t) (Q * 256);
+        dsp_tune_data.mag[i] = (uint16_t) (sqrt(I * I + Q * Q) * 65535.0 / 182.0);
+    }
+
+    // 1Hz cutoff at 2.4MHz; the estimate wanders between the UC8 and SC16
+    // centers while timing, which doesn't matter for speed
+    dsp_tune_data.dc_filter.dc_I = dsp_tune_data.dc_filter.dc_Q = 127.4f;
+    dsp_tune_data.dc_filter.rate = 2 * M_PI * 1.0 / 2400000;
+
+    // 8MHz to 2.4MHz
+    if (!resampler_build(&dsp_tune_data.resampler, 3, 10)) {
+        fprintf(stderr, "dsp_tune: can't build resampler\n");
+        dsp_tune_free_data();
+        return false;
+    }
+    dsp_tune_data.resample_groups = (DSP_TUNE_SAMPLES - dsp_tune_data.resampler.span) / dsp_tune_data.resampler.down + 1;
+
+    return true;
+}
+
+// Benchmark everything, recording the results
+static bool dsp_tune_run(void)
+{
+    if (!dsp_tune_prepare_data())
+        return false;
+
+    struct dsp_tune_args aligned = {
+        .uc8 = dsp_tune_data.uc8,
+        .sc16 = dsp_tune_data.sc16,
+        .mag = dsp_tune_data.mag,
+        .out = dsp_tune_data.out
+    };
+
+    struct dsp_tune_args unaligned = {
+        .uc8 = dsp_tune_data.uc8 + 1,
+        .sc16 = dsp_tune_data.sc16 + 1,
+        .mag = dsp_tune_data.mag + 1,
+        .out = dsp_tune_data.out + 1
+    };
+
+    dsp_tune_clear_results();
+    for (unsigned i = 0; dsp_tune_functions[i].name && !atomic_load(&dsp_tune_stopping); ++i)
+        dsp_tune_functions[i].tune(dsp_tune_functions[i].aligned ? &aligned : &unaligned);
+
+    dsp_tune_free_data();
+    return !atomic_load(&dsp_tune_stopping);
+}
+
+static int dsp_tune_compare_result(const void *l, const void *r)
+{
+    const struct dsp_tune_result *left = l, *right = r;
+
+    int name_cmp = strcmp(left->function, right->function);
+    if (name_cmp)
+        return name_cmp;
+
+    if (left->ns < right->ns)
+        return -1;
+    if (left->ns > right->ns)
+        return 1;
+    return 0;
+}
+
+// Re-rank the starch registries based on the recorded results
+static void dsp_tune_apply(void)
+{
+    qsort(dsp_tune_results, dsp_tune_result_count, sizeof(*dsp_tune_results), dsp_tune_compare_result);
+
+    for (unsigned i = 0; dsp_tune_functions[i].name; ++i) {
+        const char *wisdom[dsp_tune_result_count + 1];
+        unsigned n = 0;
+
+        for (unsigned j = 0; j < dsp_tune_result_count; ++j) {
+            if (!strcmp(dsp_tune_results[j].function, dsp_tune_functions[i].name))
+                wisdom[n++] = dsp_tune_results[j].impl;
+        }
+        wisdom[n] = NULL;
+
+        if (n)
+            dsp_tune_functions[i].set_wisdom(wisdom);
+    }
+}
+
+// Write the recorded results as a wisdom file; the ns/call comments
+// are read back by dsp_tune_read_cache
+static bool dsp_tune_write_cache(const char *path)
+{
+    size_t len = strlen(path) + 5;
+    char *tmppath = malloc(len);
+    if (!tmppath)
+        return false;
+    snprintf(tmppath, len, "%s.tmp", path);
+
+    FILE *fp = fopen(tmppath, "w");
+    if (!fp) {
+        fprintf(stderr, "dsp_tune: can't write %s: %s\n", tmppath, strerror(errno));
+        free(tmppath);
+        return false;
+    }
+
+    qsort(dsp_tune_results, dsp_tune_result_count, sizeof(*dsp_tune_results), dsp_tune_compare_result);
+
+    fprintf(fp, "# generated by %s %s\n", MODES_DUMP1090_VARIANT, MODES_DUMP1090_VERSION);
+    fprintf(fp, "# cpu: %s\n", cpu_model());
+    fprintf(fp, "# build: %s\n", dsp_tune_build_id());
+
+    const char *last_function = NULL;
+    for (unsigned i = 0; i < dsp_tune_result_count; ++i) {
+        struct dsp_tune_result *result = &dsp_tune_results[i];
+        if (!last_function || strcmp(last_function, result->function))
+            fprintf(fp, "\n");
+        last_function = result->function;
+        fprintf(fp, "%-40s %-41s # %" PRIu64 " ns/call\n", result->function, result->impl, result->ns);
+    }
+
+    if (fclose(fp) != 0 || rename(tmppath, path) < 0) {
+        fprintf(stderr, "dsp_tune: can't write %s: %s\n", path, strerror(errno));
+        unlink(tmppath);
+        free(tmppath);
+        return false;
+    }
+
+    free(tmppath);
+    return true;
+}
+
+// Read a cache file written by dsp_tune_write_cache, checking that it
+// matches this CPU and build; record the ns/call values and load the wisdom
+static bool dsp_tune_read_cache(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return false;
+
+    bool cpu_ok = false, build_ok = false;
+    char line[512];
+
+    dsp_tune_clear_results();
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        if (!strncmp(line, "# cpu: ", 7)) {
+            cpu_ok = !strcmp(line + 7, cpu_model());
+            continue;
+        }
+        if (!strncmp(line, "# build: ", 9)) {
+            build_ok = !strcmp(line + 9, dsp_tune_build_id());
+            continue;
+        }
+
+        char function[128], impl[128];
+        uint64_t ns;
+        if (sscanf(line, "%127s %127s # %" SCNu64 " ns/call", function, impl, &ns) == 3)
+            dsp_tune_record(function, impl, ns);
+    }
+
+    fclose(fp);
+
+    if (!cpu_ok || !build_ok || !dsp_tune_result_count) {
+        // stale or damaged, ignore it
+        dsp_tune_clear_results();
+        return false;
+    }
+
+    if (starch_read_wisdom(path) < 0) {
+        dsp_tune_clear_results();
+        return false;
+    }
+
+    return true;
+}
+
+static void *dsp_tune_thread_entry(void *arg)
+{
+    MODES_NOTUSED(arg);
+
+    set_thread_name("dump1090-tune");
+
+    if (dsp_tune_run()) {
+        if (dsp_tune_write_cache(dsp_tune_cache_path))
+            fprintf(stderr, "dsp_tune: background DSP tuning done, results will be used from the next start\n");
+    }
+
+    return NULL;
+}
+
+bool dsp_tune_init(dsp_tune_mode_t mode, const char *cache_dir)
+{
+    if (cache_dir) {
+        dsp_tune_cache_path = dsp_tune_cache_file(cache_dir);
+        if (dsp_tune_cache_path && dsp_tune_read_cache(dsp_tune_cache_path))
+            return true;
+    }
+
+    switch (mode) {
+    case DSP_TUNE_NONE:
+        return false;
+
+    case DSP_TUNE_BACKGROUND:
+        if (dsp_tune_cache_path) {
+            atomic_store(&dsp_tune_stopping, false);
+            if (pthread_create(&dsp_tune_thread, NULL, dsp_tune_thread_entry, NULL) == 0) {
+                dsp_tune_thread_running = true;
+                return false;
+            }
+            fprintf(stderr, "dsp_tune: can't start background thread, tuning now instead\n");
+        } else {
+            fprintf(stderr, "dsp_tune: background tuning needs a cache directory (--dsp-cache-dir), tuning now instead\n");
+        }
+        // fall through
+
+    case DSP_TUNE_STARTUP:
+    default:
+        fprintf(stderr, "dsp_tune: measuring DSP implementations, this will take a few seconds..\n");
+        if (!dsp_tune_run())
+            return false;
+        dsp_tune_apply();
+        if (dsp_tune_cache_path)
+            dsp_tune_write_cache(dsp_tune_cache_path);
+        return true;
+    }
+}
+
+void dsp_tune_cleanup(void)
+{
+    if (dsp_tune_thread_running) {
+        atomic_store(&dsp_tune_stopping, true);
+        pthread_join(dsp_tune_thread, NULL);
+        dsp_tune_thread_running = false;
+    }
+
+    dsp_tune_clear_results();
+    free(dsp_tune_results);
+    dsp_tune_results = NULL;
+    dsp_tune_result_size = 0;
+
+    free(dsp_tune_cache_path);
+    dsp_tune_cache_path = NULL;
+}
@@ -0,0 +1,43 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// dsp_tune.h: in-process DSP implementation selection
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DSP_TUNE_H
+#define DSP_TUNE_H
+
+#include <stdbool.h>
+#include <inttypes.h>
+
+typedef enum {
+    DSP_TUNE_NONE = 0,         // use compiled-in or --wisdom ordering only
+    DSP_TUNE_STARTUP,          // benchmark before starting, if there is no cached result
+    DSP_TUNE_BACKGROUND        // benchmark in a background thread, if there is no cached result;
+                               // the result is cached for the next start
+} dsp_tune_mode_t;
+
+// Load cached wisdom for this CPU and build from cache_dir (may be NULL), or
+// benchmark the DSP implementations according to mode. Returns true if
+// wisdom was loaded from the cache or measured.
+bool dsp_tune_init(dsp_tune_mode_t mode, const char *cache_dir);
+
+// Stop any background tuning and wait for it to finish
+void dsp_tune_cleanup(void);
+
+// Return the measured time per call in ns for the given function and
+// implementation, or 0 if it has not been measured
+uint64_t dsp_tune_ns(const char *function, const char *impl);
+
+#endif
@@ -112,6 +112,7 @@ static void modesInitConfig(void) {
     // Now initialise things that should not be 0/NULL to their defaults
     Modes.gain                    = MODES_DEFAULT_GAIN;
     Modes.freq                    = MODES_DEFAULT_FREQ;
+    Modes.input_sample_rate       = 2400000.0;
     Modes.fix_df                  = 1;
     Modes.interactive_display_ttl = MODES_INTERACTIVE_DISPLAY_TTL;
     Modes.json_interval           = 1000;
@@ -119,6 +120,9 @@ static void modesInitConfig(void) {
     Modes.json_location_accuracy  = 1;
     Modes.maxRange                = 1852 * 300; // 300NM default max range
     Modes.mode_ac_auto            = 1;
+    Modes.track_state_interval    = TRACK_STATE_DEFAULT_INTERVAL;
+    Modes.burst_record_squelch    = BURST_DEFAULT_SQUELCH;
+    Modes.burst_record_margin     = BURST_DEFAULT_MARGIN;
 
     Modes.net_heartbeat_interval = MODES_NET_HEARTBEAT_INTERVAL;
     Modes.net_output_flush_size = 1300;
@@ -164,7 +168,9 @@ static void modesInit(void) {
         exit(1);
     }
 
-    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
+    // Each input gets its own share of buffers
+    Modes.num_inputs = sdrInputCount();
+    if (!fifo_create(Modes.num_inputs, MODES_MAG_BUFFERS * Modes.num_inputs, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
         fprintf(stderr, "Out of memory allocating FIFO\n");
         exit(1);
     }
@@ -203,7 +209,7 @@ static void modesInit(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(Modes.nfix_crc);
+    modesChecksumInit(Modes.nfix_crc, Modes.crc_cache_dir);
     icaoFilterInit();
     modeACInit();
 
@@ -295,24 +301,49 @@ static void showDSP()
         printf("AVX ");
     if (cpu_supports_avx2())
         printf("AVX2 ");
+    if (cpu_supports_avx512())
+        printf("AVX512 ");
     if (cpu_supports_armv7_neon_vfpv4())
         printf("ARMv7+NEON+VFPv4 ");
+    if (cpu_supports_armv8_simd())
+        printf("ARMv8+SIMD ");
+    if (cpu_supports_armv8_sve())
+        printf("ARMv8+SVE ");
     printf("\n");
 
     printf("  selected DSP implementations: \n");
+#define SHOW_ONE(x) do {                                                \
+        const char *impl = starch_ ## x ## _select()->name;             \
+        uint64_t ns = dsp_tune_ns(#x, impl);                            \
+        if (ns)                                                         \
+            printf("    %-40s %-40s %8" PRIu64 " ns/call\n", #x, impl, ns); \
+        else                                                            \
+            printf("    %-40s %s\n", #x, impl);                         \
+    } while(0)
 #define SHOW(x) do {                                                    \
-        printf("    %-40s %s\n", #x , starch_ ## x ## _select()->name);  \
-        printf("    %-40s %s\n", #x "_aligned", starch_ ## x ## _aligned_select()->name); \
+        SHOW_ONE(x);                                                    \
+        SHOW_ONE(x ## _aligned);                                        \
     } while(0)
 
     SHOW(magnitude_uc8);
     SHOW(magnitude_power_uc8);
+    SHOW(magnitude_power_preamble_uc8);
     SHOW(magnitude_sc16);
     SHOW(magnitude_sc16q11);
+    SHOW(magnitude_dc_uc8);
+    SHOW(magnitude_dc_power_preamble_uc8);
+    SHOW(magnitude_dc_sc16);
+    SHOW(magnitude_dc_sc16q11);
+    SHOW(resample_u16);
     SHOW(mean_power_u16);
     SHOW(count_above_u16);
+    SHOW(preamble_bitmap_u16);
+    SHOW(histogram_log_u16);
+    SHOW(modeac_scan_u16);
+    SHOW(block_max_u16);
 
 #undef SHOW
+#undef SHOW_ONE
 
     printf("\n");
 }
@@ -336,22 +367,37 @@ static void showHelp(void)
 "--quiet                  Disable output to stdout. Use for daemon applications\n"
 "--show-only <addr>       Show only messages from the given ICAO on stdout\n"
 "--snip <level>           Strip IQ file removing samples < level\n"
+"--record-bursts <file>   Record the raw samples around each burst of signal\n"
+"                          to <file>, for replay with --ifile\n"
+"--record-squelch <db>    Burst recording threshold, in dB above the noise\n"
+"                          floor (default 3)\n"
+"--record-margin <us>     Samples kept either side of a burst, in microseconds\n"
+"                          (default 50)\n"
 "\n"
 "      Decoder settings\n"
 "\n"
 // ------ 80 char limit ----------------------------------------------------------|
 "--gain <db>              Set gain in dB (default: varies by SDR type)\n"
 "--freq <hz>              Set frequency (default: 1090 Mhz)\n"
+"--dcfilter               Remove the DC offset from IQ samples\n"
+"--sample-rate <hz>       Set SDR / ifile sample rate (default: 2400000); higher\n"
+"                          rates such as 6, 8 or 10MHz are resampled to 2.4MHz\n"
 "--fix                    Enable single-bit error correction using CRC\n"
 "--fix-2bit               Enable two-bit error correction using CRC\n"
 "                          (use with caution!)\n"
 "--no-fix                 Disable error correction using CRC\n"
 "--no-fix-df              Disable error correction of the DF message field\n"
 "                          (reduces CPU requirements)\n"
+"--crc-cache-dir <dir>    Cache the --fix-2bit error correction tables in <dir>\n"
+"                          so later starts don't have to rebuild them\n"
 "--enable-df24            Enable decoding of DF24 Comm-D ELM messages\n"
 "--lat <latitude>         Reference/receiver latitude for surface positions\n"
 "--lon <longitude>        Reference/receiver longitude for surface positions\n"
 "--max-range <distance>   Absolute maximum range for position decoding (in NM)\n"
+"--track-state <file>     Save aircraft state to <file> on exit and restore it\n"
+"                          at startup, so decoding resumes immediately\n"
+"--track-state-every <t>  Also save aircraft state every t seconds\n"
+"                          (default 60; 0 = only on exit)\n"
 "\n"
 // ------ 80 char limit ----------------------------------------------------------|
 "      Adaptive gain\n"
@@ -393,8 +439,12 @@ static void showHelp(void)
 "--net-sbs-port <ports>   TCP BaseStation output listen ports (default: 30003)\n"
 "--net-bi-port <ports>    TCP Beast input listen ports  (default: 30004,30104)\n"
 "--net-bo-port <ports>    TCP Beast output listen ports (default: 30005)\n"
+"--net-zbi-port <ports>   TCP compressed Beast input listen ports, for data sent\n"
+"                           by a deflate --net-connector (default: disabled)\n"
 "--net-stratux-port <ports>  TCP Stratux output listen ports (default: disabled)\n"
 "--net-wiffle-port <ports> TCP Wiffle output listen ports (default: disabled)\n"
+"--net-metrics-port <ports> HTTP OpenMetrics (Prometheus) stats listen ports\n"
+"                           (default: disabled)\n"
 "--net-ro-size <size>     TCP output minimum size (default: 0)\n"
 "--net-ro-interval <rate> TCP output memory flush rate in seconds (default: 0)\n"
 "--net-heartbeat <rate>   TCP heartbeat rate in seconds\n"
@@ -403,6 +453,18 @@ static void showHelp(void)
 "--net-verbatim           Make output connections default to verbatim mode\n"
 "                           (forward all messages without correction)\n"
 "--forward-mlat           Allow forwarding of received mlat results\n"
+"--net-shm-ring <name>    Publish messages to a shared memory ring for local\n"
+"                           consumers (faup1090/view1090 --shm-ring <name>)\n"
+"--net-connector <host>,<port>,<format>[,deflate][,batch=<ms>][,buffer=<kB>]\n"
+"                         Send output to a remote host, reconnecting as needed.\n"
+"                           format: beast, beast_verbatim, beast_local, raw,\n"
+"                           sbs, stratux or wiffle. May be given more than once.\n"
+"--net-udp <address>,<port>,<format>[,ttl=<n>][,mtu=<bytes>][,iface=<if>]\n"
+"                         Send output as UDP datagrams to a multicast group or\n"
+"                           broadcast address; format as for --net-connector.\n"
+"--net-dedup <ms>         Drop Mode S messages from Beast/raw inputs that repeat\n"
+"                           one received within <ms> (default: 0, disabled)\n"
+"--net-dedup-observe      With --net-dedup, count duplicates but don't drop them\n"
 "\n"
 // ------ 80 char limit ----------------------------------------------------------|
 "      Stats and json output\n"
@@ -431,6 +493,14 @@ static void showHelp(void)
 "      Misc\n"
 "\n"
 "--wisdom <path>          Read DSP wisdom from given path\n"
+"--dsp-tune               Measure DSP implementations at startup and use the\n"
+"                          fastest (unless cached results are available)\n"
+"--dsp-tune-background    Measure DSP implementations in the background and\n"
+"                          cache the results for the next start\n"
+"--dsp-cache-dir <dir>    Cache measured DSP wisdom in <dir>, keyed by CPU\n"
+"                          model and binary\n"
+"--show-dsp               Show selected DSP implementations (with measured\n"
+"                          ns/call, if known) and exit\n"
 "--version                Show version, build and DSP options\n"
 "--help                   Show this help\n"
     );
@@ -478,6 +548,7 @@ static void backgroundTasks(void) {
         modesNetPeriodicWork();
     }
 
+    trackStatePeriodicUpdate(now);
 
     // Refresh screen when in interactive mode
     if (Modes.interactive) {
@@ -597,6 +668,8 @@ static void applyNetDefaults()
 
 int main(int argc, char **argv) {
     int j;
+    bool wisdom_given = false;
+    bool show_dsp = false;
 
     // Set sane defaults
     modesInitConfig();
@@ -616,11 +689,9 @@ int main(int argc, char **argv) {
         } else if (!strcmp(argv[j],"--gain") && more) {
             Modes.gain = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--dcfilter")) {
-#if 0
             Modes.dc_filter = 1;
-#else
-            fprintf(stderr, "--dcfilter option ignored (please raise an issue on github if you have a usecase that needs this)\n");
-#endif
+        } else if (!strcmp(argv[j],"--sample-rate") && more) {
+            Modes.input_sample_rate = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--measure-noise")) {
             // Ignored
         } else if (!strcmp(argv[j],"--fix")) {
@@ -632,6 +703,9 @@ int main(int argc, char **argv) {
             Modes.enable_df24 = 1;
         } else if (!strcmp(argv[j],"--no-fix")) {
             Modes.nfix_crc = 0;
+        } else if (!strcmp(argv[j], "--crc-cache-dir") && more) {
+            free(Modes.crc_cache_dir);
+            Modes.crc_cache_dir = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--no-fix-df")) {
             Modes.fix_df = 0;
         } else if (!strcmp(argv[j],"--no-crc-check")) {
@@ -678,6 +752,14 @@ int main(int argc, char **argv) {
             Modes.net = 1;
             free(Modes.net_input_beast_ports);
             Modes.net_input_beast_ports = strdup(argv[++j]);
+        } else if (!strcmp(argv[j],"--net-zbi-port") && more) {
+#ifndef ENABLE_ZLIB
+            fprintf(stderr, "--net-zbi-port is not supported in this build (no zlib)\n");
+            exit(1);
+#endif
+            Modes.net = 1;
+            free(Modes.net_input_zbeast_ports);
+            Modes.net_input_zbeast_ports = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--net-bind-address") && more) {
             free(Modes.net_bind_address);
             Modes.net_bind_address = strdup(argv[++j]);
@@ -697,12 +779,38 @@ int main(int argc, char **argv) {
             Modes.net = 1;
             free(Modes.net_output_wiffle_ports);
             Modes.net_output_wiffle_ports = strdup(argv[++j]);
+        } else if (!strcmp(argv[j],"--net-metrics-port") && more) {
+            Modes.net = 1;
+            free(Modes.net_metrics_ports);
+            Modes.net_metrics_ports = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--net-buffer") && more) {
             Modes.net_sndbuf_size = atoi(argv[++j]);
         } else if (!strcmp(argv[j],"--net-verbatim")) {
             Modes.net_verbatim = 1;
         } else if (!strcmp(argv[j],"--forward-mlat")) {
             Modes.forward_mlat = 1;
+        } else if (!strcmp(argv[j],"--net-shm-ring") && more) {
+            Modes.net = 1;
+            free(Modes.net_shm_ring);
+            Modes.net_shm_ring = strdup(argv[++j]);
+        } else if (!strcmp(argv[j],"--net-connector") && more) {
+            Modes.net = 1;
+            if (!netConnectorAdd(argv[++j]))
+                exit(1);
+        } else if (!strcmp(argv[j],"--net-udp") && more) {
+            Modes.net = 1;
+            if (!netUdpAdd(argv[++j]))
+                exit(1);
+        } else if (!strcmp(argv[j],"--net-dedup") && more) {
+            char *end;
+            unsigned long window = strtoul(argv[++j], &end, 10);
+            if (end == argv[j] || *end || window > 60000) {
+                fprintf(stderr, "--net-dedup: bad window '%s' (0..60000 ms)\n", argv[j]);
+                exit(1);
+            }
+            Modes.net_dedup_window = window;
+        } else if (!strcmp(argv[j],"--net-dedup-observe")) {
+            Modes.net_dedup_observe = 1;
         } else if (!strcmp(argv[j],"--onlyaddr")) {
             Modes.onlyaddr = 1;
         } else if (!strcmp(argv[j],"--metric")) {
@@ -766,6 +874,28 @@ int main(int argc, char **argv) {
             // Ignored
         } else if (!strcmp(argv[j], "--wiffle-stdout")) {
            Modes.wiffle_stdout = 1;
+        } else if (!strcmp(argv[j], "--record-bursts") && more) {
+            Modes.burst_record_file = strdup(argv[++j]);
+        } else if (!strcmp(argv[j], "--record-squelch") && more) {
+            Modes.burst_record_squelch = atof(argv[++j]);
+        } else if (!strcmp(argv[j], "--record-margin") && more) {
+            char *end;
+            double margin = strtod(argv[++j], &end);
+            if (end == argv[j] || *end || margin < 0 || margin > 100000) {
+                fprintf(stderr, "--record-margin: bad margin '%s'\n", argv[j]);
+                exit(1);
+            }
+            Modes.burst_record_margin = margin;
+        } else if (!strcmp(argv[j], "--track-state") && more) {
+            Modes.track_state_file = strdup(argv[++j]);
+        } else if (!strcmp(argv[j], "--track-state-every") && more) {
+            char *end;
+            double interval = strtod(argv[++j], &end);
+            if (end == argv[j] || *end || interval < 0) {
+                fprintf(stderr, "--track-state-every: bad interval '%s'\n", argv[j]);
+                exit(1);
+            }
+            Modes.track_state_interval = (uint64_t) (interval * 1000);
         } else if (!strcmp(argv[j], "--write-json") && more) {
             Modes.json_dir = strdup(argv[++j]);
         } else if (!strcmp(argv[j], "--write-json-every") && more) {
@@ -780,6 +910,16 @@ int main(int argc, char **argv) {
                         "Failed to read wisdom file %s: %s\n", argv[j], strerror(errno));
                 exit(1);
             }
+            wisdom_given = true;
+        } else if (!strcmp(argv[j], "--dsp-tune")) {
+            Modes.dsp_tune = DSP_TUNE_STARTUP;
+        } else if (!strcmp(argv[j], "--dsp-tune-background")) {
+            Modes.dsp_tune = DSP_TUNE_BACKGROUND;
+        } else if (!strcmp(argv[j], "--dsp-cache-dir") && more) {
+            free(Modes.dsp_cache_dir);
+            Modes.dsp_cache_dir = strdup(argv[++j]);
+        } else if (!strcmp(argv[j], "--show-dsp")) {
+            show_dsp = true;
         } else if (!strcmp(argv[j], "--adaptive-min-gain") && more) {
             Modes.adaptive_min_gain_db = atof(argv[++j]);
         } else if (!strcmp(argv[j], "--adaptive-max-gain") && more) {
@@ -825,6 +965,16 @@ int main(int argc, char **argv) {
         }
     }
 
+    // An explicit --wisdom file takes precedence over cached or measured wisdom
+    if (!wisdom_given)
+        dsp_tune_init(show_dsp && Modes.dsp_tune == DSP_TUNE_BACKGROUND ? DSP_TUNE_STARTUP : Modes.dsp_tune, Modes.dsp_cache_dir);
+
+    if (show_dsp) {
+        showDSP();
+        dsp_tune_cleanup();
+        exit(0);
+    }
+
     if (Modes.sdr_type == SDR_NONE && !Modes.net) {
         fprintf(stderr,
                 "No SDR available and network mode not enabled; nothing to do!\n"
@@ -849,6 +999,8 @@ int main(int argc, char **argv) {
         modesInitNet();
     }
 
+    trackStateLoad();
+
     // init stats:
     reset_stats(&Modes.stats_current);
     reset_stats(&Modes.stats_alltime);
@@ -905,6 +1057,7 @@ int main(int argc, char **argv) {
 
             if (buf) {
                 // Process one buffer
+                stats_add_latency(&Modes.stats_current, LATENCY_FIFO, buf->dequeueTime - buf->enqueueTime);
 
                 start_cpu_timing(&start_time);
                 demodulate2400(buf);
@@ -913,6 +1066,7 @@ int main(int argc, char **argv) {
                 }
 
                 Modes.stats_current.samples_processed += buf->validLength - buf->overlap;
+                Modes.stats_current.input_samples_processed[buf->input] += buf->validLength - buf->overlap;
                 Modes.stats_current.samples_dropped += buf->dropped;
                 end_cpu_timing(&start_time, &Modes.stats_current.demod_cpu);
 
@@ -947,6 +1101,8 @@ int main(int argc, char **argv) {
 
     interactiveCleanup();
 
+    trackStateSave();
+
     // Write final stats
     flush_stats(0);
     writeJsonToFile("stats.json", generateStatsJson);
@@ -954,8 +1110,14 @@ int main(int argc, char **argv) {
         display_stats(&Modes.stats_alltime);
     }
 
+    burstRecordStop();
     sdrClose();
     fifo_destroy();
+    dsp_tune_cleanup();
+    shmRingDestroy();
+    netConnectorCleanup();
+    netUdpCleanup();
+    dedupCleanup();
 
     if (Modes.exit == 1) {
         log_with_timestamp("Normal exit.");
@@ -93,6 +93,7 @@
 #define MODES_RTL_BUF_SIZE         (16*16384)                 // 256k
 #define MODES_MAG_BUF_SAMPLES      (MODES_RTL_BUF_SIZE / 2)   // Each sample is 2 bytes
 #define MODES_MAG_BUFFERS          12                         // Number of magnitude buffers (should be smaller than RTL_BUFFERS for flowcontrol to work)
+#define MODES_MAX_INPUTS           8                          // Maximum number of simultaneous SDR/file inputs
 #define MODES_LEGACY_AUTO_GAIN     -10                        // old gain value for "use automatic gain"
 #define MODES_DEFAULT_GAIN         999999                     // Use default SDR gain
 #define MODES_MSG_SQUELCH_DB       4.0                        // Minimum SNR, in dB
@@ -291,10 +292,19 @@ typedef enum {
 #include "stats.h"
 #include "cpr.h"
 #include "icao_filter.h"
+#include "output_filter.h"
+#include "shm_ring.h"
+#include "net_connector.h"
+#include "net_udp.h"
+#include "dedup.h"
+#include "track_state.h"
 #include "convert.h"
+#include "burst.h"
+#include "decompress.h"
 #include "sdr.h"
 #include "fifo.h"
 #include "adaptive.h"
+#include "dsp_tune.h"
 
 //======================== structure declarations =========================
 
@@ -310,8 +320,10 @@ struct _Modes {                             // Internal state
     struct timespec reader_cpu_accumulator;               // accumulated CPU time used by the reader thread
     struct timespec reader_cpu_start;                     // start time for the last reader thread CPU measurement
 
+    unsigned        num_inputs;                           // number of SDR/file inputs feeding the FIFO
     unsigned        trailing_samples;                     // extra trailing samples in magnitude buffers
     double          sample_rate;                          // actual sample rate in use (in hz)
+    double          input_sample_rate;                    // SDR / ifile sample rate (in hz), resampled to sample_rate
 
     uint16_t       *log10lut;        // Magnitude -> log10 lookup table
     atomic_int      exit;            // Exit from the main loop when true (2 = unclean exit)
@@ -349,6 +361,10 @@ struct _Modes {                             // Internal state
     // Configuration
     sdr_type_t sdr_type;             // where are we getting data from?
     int   nfix_crc;                  // Number of crc bit error(s) to correct
+    char *crc_cache_dir;             // Directory for cached error correction tables, or NULL not to cache
+    char *burst_record_file;         // Record bursts of raw samples to this file, or NULL
+    double burst_record_squelch;     // Burst recording threshold, dB above the noise floor
+    double burst_record_margin;      // Samples kept either side of a recorded burst, in microseconds
     int   check_crc;                 // Only display messages with good CRC
     int   fix_df;                    // Try to correct damage to the DF field, as well as the main message body
     int   enable_df24;               // Enable decoding of DF24..DF31 (Comm-D ELM)
@@ -365,12 +381,17 @@ struct _Modes {                             // Internal state
     char *net_output_sbs_ports;      // List of SBS output TCP ports
     char *net_output_stratux_ports;  // List of Stratux output TCP ports
     char *net_input_beast_ports;     // List of Beast input TCP ports
+    char *net_input_zbeast_ports;    // List of compressed Beast input TCP ports
     char *net_output_beast_ports;    // List of Beast output TCP ports
     char* net_output_wiffle_ports;   // List of Wiffle output TCP ports
     char *net_bind_address;          // Bind address
     int   net_sndbuf_size;           // TCP output buffer size (64Kb * 2^n)
     int   net_verbatim;              // if true, Beast output connections default to verbatim mode
     int   forward_mlat;              // allow forwarding of mlat messages to output ports
+    char *net_shm_ring;              // Name of the shared memory ring to publish messages to, or NULL
+    char *net_metrics_ports;         // List of OpenMetrics HTTP listen ports
+    uint64_t net_dedup_window;       // Drop network duplicates received within this many ms, or 0
+    int   net_dedup_observe;         // Count network duplicates but don't drop them
     int   quiet;                     // Suppress stdout
     uint32_t show_only;              // Only show messages from this ICAO
     int   interactive;               // Interactive mode
@@ -407,6 +428,8 @@ struct _Modes {                             // Internal state
 
     // State tracking
     struct aircraft *aircrafts;
+    char *track_state_file;          // Save and restore aircraft state in this file, or NULL
+    uint64_t track_state_interval;   // Interval between periodic saves of aircraft state, in milliseconds, or 0
 
     // Statistics
     struct stats stats_current;     // Currently accumulating stats, this is where all stats are initially collected
@@ -439,6 +462,10 @@ struct _Modes {                             // Internal state
     unsigned adaptive_range_change_delay;
     unsigned adaptive_range_scan_delay;
     unsigned adaptive_range_rescan_delay;
+
+    // DSP implementation selection
+    dsp_tune_mode_t dsp_tune;        // Benchmark DSP implementations in-process?
+    char *dsp_cache_dir;             // Directory for cached per-CPU DSP wisdom, or NULL not to cache
 };
 
 extern struct _Modes Modes;
@@ -456,7 +483,10 @@ struct modesMessage {
     addrtype_t    addrtype;                       // address format / source
     uint64_t      timestampMsg;                   // Timestamp of the message (12MHz clock)
     uint64_t      sysTimestampMsg;                // Timestamp of the message (system time)
+    uint64_t      dequeueTime;                    // monotonic_us() when the sample buffer was dequeued, 0 if not from a local receiver
+    uint64_t      decodeTime;                     // monotonic_us() when the message was decoded
     int           remote;                         // If set this message is from a remote station
+    unsigned      input;                          // Index of the local input that received this message
     double        signalLevel;                    // RSSI, in the range [0..1], as a fraction of full-scale power
     int           score;                          // Scoring from scoreModesMessage, if used
     int           reliable;                       // is this a "reliable" message (uncorrected DF11/DF17/DF18)?
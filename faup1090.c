@@ -104,7 +104,7 @@ static void faupInit(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(1);
+    modesChecksumInit(1, NULL);
     icaoFilterInit();
     modeACInit();
 }
@@ -119,6 +119,9 @@ static void showHelp(void) {
 "-----------------------------------------------------------------------------\n"
 "--net-bo-ipaddr <addr>   IP address to connect to for Beast data (default: 127.0.0.1)\n"
 "--net-bo-port <port>     Port to connect for Beast data (default: 30005)\n"
+"--shm-ring <name>        Read messages from dump1090's shared memory ring\n"
+"                         (dump1090 --net-shm-ring), falling back to Beast\n"
+"                         over TCP if it is not available\n"
 "--lat <latitude>         Reference/receiver latitude for surface posn (opt)\n"
 "--lon <longitude>        Reference/receiver longitude for surface posn (opt)\n"
 "--stdout                 REQUIRED. Write results to stdout.\n"
@@ -149,6 +152,8 @@ int main(int argc, char **argv) {
     int stdout_option = 0;
     char *bo_connect_ipaddr = "127.0.0.1";
     int bo_connect_port = 30005;
+    char *shm_ring_name = NULL;
+    struct shm_ring_reader *ring = NULL;
     struct client *c;
     struct net_service *beast_input, *fatsv_output, *fa_cmd_input;
 
@@ -163,6 +168,8 @@ int main(int argc, char **argv) {
             bo_connect_port = atoi(argv[++j]);
         } else if (!strcmp(argv[j],"--net-bo-ipaddr") && more) {
             bo_connect_ipaddr = argv[++j];
+        } else if (!strcmp(argv[j],"--shm-ring") && more) {
+            shm_ring_name = argv[++j];
         } else if (!strcmp(argv[j],"--lat") && more) {
             Modes.fUserLat = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--lon") && more) {
@@ -192,17 +199,24 @@ int main(int argc, char **argv) {
     faupInit();
     modesInitNet();
 
-    // Set up input connection
+    // Set up input: the shared memory ring if there is one, else a Beast connection
     beast_input = makeBeastInputService();
-    c = serviceConnect(beast_input, bo_connect_ipaddr, bo_connect_port);
-    if (!c) {
-        fprintf (stderr,
-                 "faup1090: failed to connect to %s:%d (is dump1090 running?): %s\n",
-                 bo_connect_ipaddr, bo_connect_port, Modes.aneterr);
-        exit (1);
+    if (shm_ring_name && !(ring = shmRingAttach(shm_ring_name))) {
+        fprintf(stderr, "faup1090: shared memory ring %s is not available, using %s:%d instead\n",
+                shm_ring_name, bo_connect_ipaddr, bo_connect_port);
     }
 
-    sendBeastSettings(c, "CdfjV"); // Beast binary, no filters, CRC checks on, no mode A/C, verbatim mode on
+    if (!ring) {
+        c = serviceConnect(beast_input, bo_connect_ipaddr, bo_connect_port);
+        if (!c) {
+            fprintf (stderr,
+                     "faup1090: failed to connect to %s:%d (is dump1090 running?): %s\n",
+                     bo_connect_ipaddr, bo_connect_port, Modes.aneterr);
+            exit (1);
+        }
+
+        sendBeastSettings(c, "CdfjV"); // Beast binary, no filters, CRC checks on, no mode A/C, verbatim mode on
+    }
 
     // Set up output connection on stdout
     fatsv_output = makeFatsvOutputService();
@@ -212,12 +226,36 @@ int main(int argc, char **argv) {
     createGenericClient(fa_cmd_input, STDIN_FILENO);
 
     // Run it until we've lost either connection
-    while (!Modes.exit && beast_input->connections && fatsv_output->connections) {
-        struct timespec r = { 0, 100 * 1000 * 1000};
-        backgroundTasks();
-        nanosleep(&r, NULL);
+    uint64_t next_background = 0;
+    while (!Modes.exit && (ring || beast_input->connections) && fatsv_output->connections) {
+        if (!ring) {
+            struct timespec r = { 0, 100 * 1000 * 1000};
+            backgroundTasks();
+            nanosleep(&r, NULL);
+            continue;
+        }
+
+        // Messages are handled as soon as they are seen in the ring;
+        // the periodic work keeps its usual 100ms schedule
+        int count = modesReadShmRing(ring);
+        if (count < 0) {
+            fprintf(stderr, "faup1090: lost shared memory ring %s\n", shm_ring_name);
+            break;
+        }
+
+        uint64_t now = mstime();
+        if (now >= next_background) {
+            backgroundTasks();
+            next_background = now + 100;
+        }
+
+        if (count == 0) {
+            struct timespec r = { 0, SHM_RING_POLL_INTERVAL * 1000 * 1000 };
+            nanosleep(&r, NULL);
+        }
     }
 
+    shmRingDetach(ring);
     return 0;
 }
 //
@@ -19,6 +19,7 @@
 
 #include "fifo.h"
 #include "util.h"
+#include "dsp/helpers/preamble_bitmap.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -35,16 +36,19 @@ static struct mag_buf *fifo_head;          // head of queued buffers awaiting de
 static struct mag_buf *fifo_tail;          // tail of queued buffers awaiting demodulation
 static struct mag_buf *fifo_freelist;      // freelist of preallocated buffers
 static bool fifo_halted;                   // true if queue has been halted
+static unsigned fifo_buffer_count;         // number of buffers allocated
 
-static unsigned overlap_length;     // desired overlap size in samples (size of overlap_buffer)
-static uint16_t *overlap_buffer;    // buffer used to save overlapping data
+static unsigned fifo_inputs;        // number of inputs feeding the FIFO
+static unsigned overlap_length;     // desired overlap size in samples
+static uint16_t *overlap_buffer;    // buffer used to save overlapping data, overlap_length samples per input
 
 // Create the queue structures. Not threadsafe.
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
+bool fifo_create(unsigned inputs, unsigned buffer_count, unsigned buffer_size, unsigned overlap)
 {
-    if (!(overlap_buffer = calloc(overlap, sizeof(overlap_buffer[0]))))
+    if (!(overlap_buffer = calloc((size_t) inputs * overlap, sizeof(overlap_buffer[0]))))
         goto nomem;
 
+    fifo_inputs = inputs;
     overlap_length = overlap;
 
     for (unsigned i = 0; i < buffer_count; ++i) {
@@ -58,9 +62,16 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
             goto nomem;
         }
 
+        if (!(newbuf->preamble_bitmap = calloc(PREAMBLE_BITMAP_WORDS(buffer_size), sizeof(newbuf->preamble_bitmap[0])))) {
+            free(newbuf->data);
+            free(newbuf);
+            goto nomem;
+        }
+
         newbuf->totalLength = buffer_size;
         newbuf->next = fifo_freelist;
         fifo_freelist = newbuf;
+        ++fifo_buffer_count;
     }
 
     return true;
@@ -75,6 +86,7 @@ static void free_buffer_list(struct mag_buf *head)
     while (head) {
         struct mag_buf *next = head->next;
         free(head->data);
+        free(head->preamble_bitmap);
         free(head);
         head = next;
     }
@@ -87,9 +99,25 @@ void fifo_destroy()
 
     free_buffer_list(fifo_freelist);
     fifo_freelist = NULL;
+    fifo_buffer_count = 0;
 
     free(overlap_buffer);
     overlap_buffer = NULL;
+    fifo_inputs = 0;
+}
+
+void fifo_depth(unsigned *queued, unsigned *total)
+{
+    pthread_mutex_lock(&fifo_mutex);
+
+    unsigned n = 0;
+    for (struct mag_buf *buf = fifo_head; buf; buf = buf->next)
+        ++n;
+
+    *queued = n;
+    *total = fifo_buffer_count;
+
+    pthread_mutex_unlock(&fifo_mutex);
 }
 
 void fifo_drain()
@@ -158,10 +186,13 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms)
         result->validLength = result->overlap;
         result->sampleTimestamp = 0;
         result->sysTimestamp = 0;
+        result->enqueueTime = 0;
+        result->dequeueTime = 0;
         result->flags = 0;
         result->mean_level = 0;
         result->mean_power = 0;
         result->dropped = 0;
+        result->input = 0;
         result->next = NULL;
     }
 
@@ -174,6 +205,7 @@ void fifo_enqueue(struct mag_buf *buf)
 {
     assert(buf->validLength <= buf->totalLength);
     assert(buf->validLength >= overlap_length);
+    assert(buf->input < fifo_inputs);
 
     pthread_mutex_lock(&fifo_mutex);
 
@@ -185,17 +217,19 @@ void fifo_enqueue(struct mag_buf *buf)
     }
 
     // Populate the overlap region
+    uint16_t *overlap = &overlap_buffer[buf->input * overlap_length];
     if (buf->flags & MAGBUF_DISCONTINUOUS) {
         // This buffer is discontinuous to the previous, so the overlap region is not valid; zero it out
         memset(buf->data, 0, overlap_length * sizeof(buf->data[0]));
     } else {
-        memcpy(buf->data, overlap_buffer, overlap_length * sizeof(buf->data[0]));
+        memcpy(buf->data, overlap, overlap_length * sizeof(buf->data[0]));
     }
 
     // Save the tail of the buffer for next time
-    memcpy(overlap_buffer, &buf->data[buf->validLength - overlap_length], overlap_length * sizeof(overlap_buffer[0]));
+    memcpy(overlap, &buf->data[buf->validLength - overlap_length], overlap_length * sizeof(overlap[0]));
 
     // enqueue and tell the main thread
+    buf->enqueueTime = monotonic_us();
     buf->next = NULL;
     if (!fifo_head) {
         fifo_head = fifo_tail = buf;
@@ -239,6 +273,7 @@ struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
         result = fifo_head;
         fifo_head = result->next;
         result->next = NULL;
+        result->dequeueTime = monotonic_us();
         if (!fifo_head) {
             fifo_tail = NULL;
             pthread_cond_broadcast(&fifo_empty_cond);
@@ -26,6 +26,7 @@
 // Values for mag_buf.flags
 typedef enum {
     MAGBUF_DISCONTINUOUS = 1, // this buffer is discontinuous to the previous buffer
+    MAGBUF_PREAMBLE_BITMAP = 2, // preamble_bitmap is valid for the new sample data
 } mag_buf_flags;
 
 // Structure representing one magnitude buffer
@@ -60,26 +61,36 @@ struct mag_buf {
 
     uint64_t        sampleTimestamp; // Clock timestamp of the start of this block, 12MHz clock
     uint64_t        sysTimestamp;    // Estimated system time at start of block
+    uint64_t        enqueueTime;     // monotonic_us() when the buffer was put on the FIFO
+    uint64_t        dequeueTime;     // monotonic_us() when the buffer was taken off the FIFO
 
     mag_buf_flags   flags;           // bitwise flags for this buffer
     double          mean_level;      // Mean of normalized (0..1) signal level
     double          mean_power;      // Mean of normalized (0..1) power level
     unsigned        dropped;         // (approx) number of dropped samples, if flag MAGBUF_DISCONTINUOUS is set; zero if not discontinuous
+    uint64_t       *preamble_bitmap; // Preamble candidate bitmap for the new sample data, i.e. bit 0 is data[overlap];
+                                     // only valid if flag MAGBUF_PREAMBLE_BITMAP is set
+    unsigned        input;           // Index of the input that produced this buffer (0 if there is only one)
 
     struct mag_buf *next;            // linked list forward link
 };
 
 // Create the queue structures. Not threadsafe. Returns true on success.
 //
+//   inputs       - the number of inputs feeding the FIFO; buffers from each input
+//                  (mag_buf.input) form a separate continuous stream
 //   buffer_count - the number of buffers to preallocate
 //   buffer_size  - the size of each magnitude buffer, in samples, including overlap
 //   overlap      - the number of samples to overlap between adjacent buffers
-bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap);
+bool fifo_create(unsigned inputs, unsigned buffer_count, unsigned buffer_size, unsigned overlap);
 
 // Destroy the fifo structures allocated in magbuf_fifo_create. Not threadsafe; ensure all FIFO users
 // are done before calling.
 void fifo_destroy();
 
+// Report the number of buffers waiting for the demodulator, and the total number of buffers.
+void fifo_depth(unsigned *queued, unsigned *total);
+
 // Block until the FIFO is empty.
 void fifo_drain();
 
@@ -96,7 +107,9 @@ void fifo_halt();
 struct mag_buf *fifo_acquire(uint32_t timeout_ms);
 
 // Put a filled buffer (previously obtained from fifo_acquire) onto the head of the FIFO.
+// The overlap region is filled from the previous buffer from the same input.
 // The caller should have filled:
+//   buf->input      (if there is more than one input)
 //   buf->validLength
 //   buf->data[buf->overlap .. buf->validLength-1]
 //   buf->sampleTimestamp
@@ -0,0 +1,187 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// filtertests.c - tests for output filter parsing and matching
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+// normally defined in track.c
+uint64_t _messageNow;
+
+// Parse spec, check its canonical form, then parse the canonical form and
+// check that it is unchanged and shares the same filter
+static int testRoundTrip(const char *spec, const char *expected)
+{
+    char err[256];
+    struct output_filter *f1 = NULL, *f2 = NULL;
+    int ok = 1;
+
+    if (!outputFilterParse(spec, &f1, err, sizeof(err))) {
+        fprintf(stderr, "FAIL: parse '%s': %s\n", spec, err);
+        return 0;
+    }
+
+    const char *canonical = outputFilterSpec(f1);
+    if (strcmp(canonical, expected)) {
+        fprintf(stderr, "FAIL: '%s' canonicalized to '%s', expected '%s'\n", spec, canonical, expected);
+        ok = 0;
+    }
+
+    if (!outputFilterParse(canonical, &f2, err, sizeof(err))) {
+        fprintf(stderr, "FAIL: reparse '%s': %s\n", canonical, err);
+        ok = 0;
+    } else if (f2 != f1 || strcmp(outputFilterSpec(f2), canonical)) {
+        fprintf(stderr, "FAIL: '%s' did not round-trip (got '%s')\n", canonical, outputFilterSpec(f2));
+        ok = 0;
+    }
+
+    outputFilterRelease(f2);
+    outputFilterRelease(f1);
+    return ok;
+}
+
+static int testRejected(const char *spec)
+{
+    char err[256];
+    struct output_filter *f = NULL;
+
+    if (outputFilterParse(spec, &f, err, sizeof(err))) {
+        fprintf(stderr, "FAIL: '%s' was accepted as '%s'\n", spec, outputFilterSpec(f));
+        outputFilterRelease(f);
+        return 0;
+    }
+    return 1;
+}
+
+static int testFilterSpecs(void)
+{
+    int ok = 1;
+
+    ok = testRoundTrip("df=17", "df=17") && ok;
+    ok = testRoundTrip("addr=A1B2C3,4840d6 df=18,17", "df=17,18 addr=4840d6,a1b2c3") && ok;
+    ok = testRoundTrip("rssi=-20 box=52,5,50,-1", "box=50.000000,5.000000,52.000000,-1.000000 rssi=-20.0") && ok;
+
+    // every term at its longest
+    ok = testRoundTrip("df=0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24 "
+                       "box=-90,-180,-90,-180 rssi=-100 addr=ffffff,000000",
+                       "df=0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24 "
+                       "addr=000000,ffffff box=-90.000000,-180.000000,-90.000000,-180.000000 rssi=-100.0") && ok;
+
+    ok = testRejected("rssi=-1e300") && ok;
+    ok = testRejected("rssi=-100.1") && ok;
+    ok = testRejected("rssi=1") && ok;
+    ok = testRejected("df=25") && ok;
+    ok = testRejected("box=91,0,0,0") && ok;
+    ok = testRejected("addr=1000000") && ok;
+
+    fprintf(stderr, "testFilterSpecs:  %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+// Check a filter against a message (and, optionally, its aircraft)
+static int testMatch(const char *spec, const struct modesMessage *mm, const struct aircraft *a, bool expected)
+{
+    static uint64_t seq;
+    char err[256];
+    struct output_filter *f = NULL;
+
+    if (!outputFilterParse(spec, &f, err, sizeof(err))) {
+        fprintf(stderr, "FAIL: parse '%s': %s\n", spec, err);
+        return 0;
+    }
+
+    bool matched = outputFilterMatch(f, mm, a, ++seq);
+    outputFilterRelease(f);
+
+    if (matched != expected) {
+        fprintf(stderr, "FAIL: '%s' %s a DF%d message from %06x\n", spec, matched ? "matched" : "did not match", mm->msgtype, mm->addr);
+        return 0;
+    }
+    return 1;
+}
+
+static int testFilterMatch(void)
+{
+    static struct modesMessage mmZero;
+    static struct aircraft aZero;
+    int ok = 1;
+
+    _messageNow = 1000000;
+
+    // DF17 from 4840d6 at -10 dBFS with a decoded position just east of the antimeridian
+    struct modesMessage mm = mmZero;
+    mm.msgtype = 17;
+    mm.addr = 0x4840d6;
+    mm.signalLevel = 0.1;
+    mm.cpr_decoded = 1;
+    mm.decoded_lat = 10.0;
+    mm.decoded_lon = -179.5;
+
+    ok = testMatch("", &mm, NULL, true) && ok;
+    ok = testMatch("df=17,18", &mm, NULL, true) && ok;
+    ok = testMatch("df=11", &mm, NULL, false) && ok;
+    ok = testMatch("addr=a1b2c3,4840D6", &mm, NULL, true) && ok;
+    ok = testMatch("addr=a1b2c3", &mm, NULL, false) && ok;
+    ok = testMatch("rssi=-15", &mm, NULL, true) && ok;
+    ok = testMatch("rssi=-5", &mm, NULL, false) && ok;
+    ok = testMatch("df=17 addr=4840d6 rssi=-15", &mm, NULL, true) && ok;
+    ok = testMatch("df=17 addr=4840d6 rssi=-5", &mm, NULL, false) && ok;
+
+    // box crossing the antimeridian: west 170, east -170
+    ok = testMatch("box=0,170,20,-170", &mm, NULL, true) && ok;
+    mm.decoded_lon = 175.0;
+    ok = testMatch("box=0,170,20,-170", &mm, NULL, true) && ok;
+    mm.decoded_lon = 0.0;
+    ok = testMatch("box=0,170,20,-170", &mm, NULL, false) && ok;
+    ok = testMatch("box=0,-10,20,10", &mm, NULL, true) && ok;
+    mm.decoded_lat = 30.0;
+    ok = testMatch("box=0,-10,20,10", &mm, NULL, false) && ok;
+
+    // no position in the message: use the aircraft's, if it has a valid one
+    mm.cpr_decoded = 0;
+    ok = testMatch("box=0,-10,20,10", &mm, NULL, false) && ok;
+
+    struct aircraft a = aZero;
+    a.lat = 5.0;
+    a.lon = 5.0;
+    ok = testMatch("box=0,-10,20,10", &mm, &a, false) && ok;   // position not valid
+    a.position_valid.source = SOURCE_ADSB;
+    a.position_valid.expires = _messageNow + 1000;
+    ok = testMatch("box=0,-10,20,10", &mm, &a, true) && ok;
+    a.position_valid.expires = _messageNow;
+    ok = testMatch("box=0,-10,20,10", &mm, &a, false) && ok;   // expired
+
+    // Mode A/C has no DF or address
+    struct modesMessage modeac = mmZero;
+    modeac.msgtype = 32;
+    modeac.signalLevel = 0.1;
+    ok = testMatch("df=0,4,5,11,17", &modeac, NULL, false) && ok;
+    ok = testMatch("addr=000000", &modeac, NULL, false) && ok;
+    ok = testMatch("rssi=-15", &modeac, NULL, true) && ok;
+
+    fprintf(stderr, "testFilterMatch:  %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    MODES_NOTUSED(argc);
+    MODES_NOTUSED(argv);
+
+    int ok = 1;
+    ok = testFilterSpecs() && ok;
+    ok = testFilterMatch() && ok;
+    return ok ? 0 : 1;
+}
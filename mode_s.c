@@ -1920,6 +1920,9 @@ void displayModesMessage(struct modesMessage *mm) {
     if (mm->score)
         printf("Score: %d (%s)\n", mm->score, score_to_string(mm->score));
 
+    if (Modes.num_inputs > 1 && !mm->remote)
+        printf("Input: %u\n", mm->input);
+
     if (mm->timestampMsg) {
         if (mm->timestampMsg == MAGIC_MLAT_TIMESTAMP)
             printf("This is a synthetic MLAT message.\n");
@@ -2317,9 +2320,10 @@ void displayModesMessageAsWiffleCsv(struct modesMessage* mm) {
 // decoded message, we call this function in order to use the message.
 //
 // Basically this function passes a raw message to the upper layers for further
-// processing and visualization
+// processing and visualization. Returns the aircraft that the message updated,
+// if any.
 //
-void useModesMessage(struct modesMessage *mm) {
+struct aircraft *useModesMessage(struct modesMessage *mm) {
     struct aircraft *a;
 
     ++Modes.stats_current.messages_total;
@@ -2344,6 +2348,8 @@ void useModesMessage(struct modesMessage *mm) {
     if (Modes.net) {
         modesQueueOutput(mm, a);
     }
+
+    return a;
 }
 
 //
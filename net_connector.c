@@ -0,0 +1,661 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// net_connector.c: outbound connections to remote aggregators
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <sys/socket.h>
+
+#define CONNECT_TIMEOUT 10000      // ms to wait for a connection to complete
+#define BACKOFF_MIN 1000           // ms before the first reconnection attempt
+#define BACKOFF_MAX 60000          // longest interval between attempts
+
+typedef enum {
+    CONNECTOR_DISCONNECTED,
+    CONNECTOR_CONNECTING,
+    CONNECTOR_CONNECTED
+} connector_state_t;
+
+// A block of data waiting to be sent; with deflate, one compressed block
+// including its header
+struct connector_block {
+    struct connector_block *next;
+    size_t len;                    // bytes of data[] in use
+    size_t size;                   // bytes allocated for data[]
+    size_t sent;                   // bytes of data[] sent on the current connection
+    unsigned char data[];
+};
+
+struct net_connector {
+    struct net_connector *next;
+    char *host;
+    char *port;
+    const char *format;
+    struct net_writer *writer;     // writer whose output we send, once started
+
+    bool deflate;
+    uint64_t batch_interval;       // ms
+    size_t buffer_limit;           // bytes
+
+    connector_state_t state;
+    int fd;
+    uint64_t next_attempt;         // when to try connecting again (DISCONNECTED)
+    uint64_t connect_started;      // when the pending connect began (CONNECTING)
+    uint64_t backoff;              // current reconnection interval
+
+    unsigned char *batch;          // uncompressed output not yet made into a block
+    size_t batch_len;
+    uint64_t batch_started;        // when the first byte of the batch arrived
+
+    struct connector_block *head;  // blocks waiting to be sent, oldest first
+    struct connector_block *tail;
+    size_t queued;                 // total bytes in the block queue
+
+    uint64_t bytes_in;             // uncompressed bytes of output accepted
+    uint64_t bytes_out;            // bytes written to the connection
+    uint64_t bytes_dropped;        // queued bytes discarded over the memory limit
+    bool dropping;                 // data has been discarded since the last report
+};
+
+static struct net_connector *connectors;
+
+static void freeConnector(struct net_connector *conn)
+{
+    if (!conn)
+        return;
+
+    struct connector_block *block, *next;
+    for (block = conn->head; block; block = next) {
+        next = block->next;
+        free(block);
+    }
+
+    free(conn->batch);
+    free(conn->host);
+    free(conn->port);
+    free(conn);
+}
+
+bool netConnectorAdd(const char *spec)
+{
+    struct net_connector *conn = NULL;
+    char *copy = NULL;
+    bool ok = false;
+
+    if (!(conn = calloc(1, sizeof(*conn))) || !(copy = strdup(spec))) {
+        fprintf(stderr, "--net-connector: out of memory\n");
+        goto done;
+    }
+
+    conn->fd = -1;
+    conn->buffer_limit = 4096 * 1024;
+    conn->backoff = BACKOFF_MIN;
+
+    bool batch_given = false;
+    char *saveptr = NULL;
+    char *host = strtok_r(copy, ",", &saveptr);
+    char *port = strtok_r(NULL, ",", &saveptr);
+    char *format = strtok_r(NULL, ",", &saveptr);
+    if (!host || !port || !format) {
+        fprintf(stderr, "--net-connector: expected host,port,format[,options], got '%s'\n", spec);
+        goto done;
+    }
+
+    if (!(conn->format = netOutputFormat(format))) {
+        fprintf(stderr, "--net-connector: unknown output format '%s'\n", format);
+        goto done;
+    }
+
+    for (char *opt = strtok_r(NULL, ",", &saveptr); opt; opt = strtok_r(NULL, ",", &saveptr)) {
+        char *end;
+        if (!strcmp(opt, "deflate")) {
+#ifdef ENABLE_ZLIB
+            conn->deflate = true;
+#else
+            fprintf(stderr, "--net-connector: deflate is not supported in this build (no zlib)\n");
+            goto done;
+#endif
+        } else if (!strncmp(opt, "batch=", 6)) {
+            unsigned long ms = strtoul(opt + 6, &end, 10);
+            if (end == opt + 6 || *end || ms > 60000) {
+                fprintf(stderr, "--net-connector: bad batch interval '%s'\n", opt + 6);
+                goto done;
+            }
+            conn->batch_interval = ms;
+            batch_given = true;
+        } else if (!strncmp(opt, "buffer=", 7)) {
+            unsigned long kb = strtoul(opt + 7, &end, 10);
+            if (end == opt + 7 || *end || kb < 64 || kb > 1024 * 1024) {
+                fprintf(stderr, "--net-connector: bad buffer size '%s' (64..1048576 kB)\n", opt + 7);
+                goto done;
+            }
+            conn->buffer_limit = kb * 1024;
+        } else {
+            fprintf(stderr, "--net-connector: unknown option '%s'\n", opt);
+            goto done;
+        }
+    }
+
+    if (conn->deflate && !batch_given)
+        conn->batch_interval = 500;
+
+    if (!(conn->host = strdup(host)) || !(conn->port = strdup(port)) || !(conn->batch = malloc(NET_CONNECTOR_BLOCK_SIZE))) {
+        fprintf(stderr, "--net-connector: out of memory\n");
+        goto done;
+    }
+
+    conn->next = connectors;
+    connectors = conn;
+    conn = NULL;
+    ok = true;
+
+ done:
+    free(copy);
+    freeConnector(conn);
+    return ok;
+}
+
+void netConnectorStart(void)
+{
+    for (struct net_connector *conn = connectors; conn; conn = conn->next) {
+        // Counting as a connection of the writer and its service keeps the
+        // output flowing while we are disconnected
+        conn->writer = netOutputWriter(conn->format);
+        ++conn->writer->connections;
+        ++conn->writer->service->connections;
+    }
+}
+
+static void disconnect(struct net_connector *conn, uint64_t now, const char *why)
+{
+    if (conn->fd >= 0)
+        close(conn->fd);
+    conn->fd = -1;
+
+    if (conn->state == CONNECTOR_CONNECTED) {
+        fprintf(stderr, "net connector %s:%s: disconnected: %s (%zu bytes waiting)\n", conn->host, conn->port, why, conn->queued);
+        conn->backoff = BACKOFF_MIN;
+    } else {
+        fprintf(stderr, "net connector %s:%s: connection failed: %s (retry in %us)\n", conn->host, conn->port, why, (unsigned) (conn->backoff / 1000));
+    }
+
+    conn->state = CONNECTOR_DISCONNECTED;
+    conn->next_attempt = now + conn->backoff;
+    conn->backoff *= 2;
+    if (conn->backoff > BACKOFF_MAX)
+        conn->backoff = BACKOFF_MAX;
+
+    // the peer can't have a usable copy of a partly sent block; start it again
+    if (conn->head)
+        conn->head->sent = 0;
+}
+
+// Discard the oldest blocks until the queue fits the memory limit. A block
+// that is partly sent has to be finished, so it is kept.
+static void enforceLimit(struct net_connector *conn)
+{
+    while (conn->queued + conn->batch_len > conn->buffer_limit && conn->head) {
+        struct connector_block **victim = &conn->head;
+        if ((*victim)->sent)
+            victim = &(*victim)->next;
+
+        struct connector_block *block = *victim;
+        if (!block)
+            break;
+
+        *victim = block->next;
+        if (conn->tail == block)
+            conn->tail = (victim == &conn->head ? NULL : conn->head);
+
+        conn->queued -= block->len;
+        conn->bytes_dropped += block->len;
+        free(block);
+
+        if (!conn->dropping) {
+            fprintf(stderr, "net connector %s:%s: buffer limit reached, discarding oldest data\n", conn->host, conn->port);
+            conn->dropping = true;
+        }
+    }
+}
+
+static struct connector_block *newBlock(struct net_connector *conn, size_t size)
+{
+    struct connector_block *block = malloc(sizeof(*block) + size);
+    if (!block) {
+        fprintf(stderr, "net connector %s:%s: out of memory, discarding data\n", conn->host, conn->port);
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->len = 0;
+    block->size = size;
+    block->sent = 0;
+
+    if (conn->tail)
+        conn->tail->next = block;
+    else
+        conn->head = block;
+    conn->tail = block;
+    return block;
+}
+
+#ifdef ENABLE_ZLIB
+static void putBigEndian32(unsigned char *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+#endif
+
+// Move the current batch onto the send queue
+static void sealBatch(struct net_connector *conn)
+{
+    if (!conn->batch_len)
+        return;
+
+    struct connector_block *block = conn->tail;
+
+#ifdef ENABLE_ZLIB
+    if (conn->deflate) {
+        uLongf clen = compressBound(conn->batch_len);
+        if ((block = newBlock(conn, NET_CONNECTOR_BLOCK_HEADER + clen))) {
+            if (compress2(block->data + NET_CONNECTOR_BLOCK_HEADER, &clen, conn->batch, conn->batch_len, Z_DEFAULT_COMPRESSION) != Z_OK) {
+                // can't happen with a compressBound-sized buffer
+                fprintf(stderr, "net connector %s:%s: compression failed\n", conn->host, conn->port);
+                clen = 0;
+            }
+            memcpy(block->data, NET_CONNECTOR_BLOCK_MAGIC, 4);
+            putBigEndian32(block->data + 4, clen);
+            putBigEndian32(block->data + 8, conn->batch_len);
+            block->len = clen ? NET_CONNECTOR_BLOCK_HEADER + clen : 0;
+            conn->queued += block->len;
+        }
+        conn->batch_len = 0;
+        enforceLimit(conn);
+        return;
+    }
+#endif
+
+    // Uncompressed: extend the newest block if it has not started to go out
+    if (!block || block->sent || block->len + conn->batch_len > block->size)
+        block = newBlock(conn, NET_CONNECTOR_BLOCK_SIZE);
+    if (block) {
+        memcpy(block->data + block->len, conn->batch, conn->batch_len);
+        block->len += conn->batch_len;
+        conn->queued += conn->batch_len;
+    }
+    conn->batch_len = 0;
+    enforceLimit(conn);
+}
+
+void netConnectorQueue(struct net_writer *writer, const void *data, size_t len)
+{
+    for (struct net_connector *conn = connectors; conn; conn = conn->next) {
+        if (conn->writer != writer)
+            continue;
+
+        conn->bytes_in += len;
+
+        const unsigned char *p = data;
+        size_t left = len;
+        while (left > 0) {
+            if (!conn->batch_len)
+                conn->batch_started = mstime();
+
+            size_t n = NET_CONNECTOR_BLOCK_SIZE - conn->batch_len;
+            if (n > left)
+                n = left;
+            memcpy(conn->batch + conn->batch_len, p, n);
+            conn->batch_len += n;
+            p += n;
+            left -= n;
+
+            if (conn->batch_len == NET_CONNECTOR_BLOCK_SIZE || !conn->batch_interval)
+                sealBatch(conn);
+        }
+    }
+}
+
+static void startConnect(struct net_connector *conn, uint64_t now)
+{
+    char err[ANET_ERR_LEN];
+
+    int fd = anetTcpNonBlockConnect(err, conn->host, conn->port);
+    if (fd == ANET_ERR) {
+        disconnect(conn, now, err);
+        return;
+    }
+
+    anetSetSendBuffer(err, fd, (MODES_NET_SNDBUF_SIZE << Modes.net_sndbuf_size));
+    anetTcpKeepAlive(err, fd);
+
+    conn->fd = fd;
+    conn->state = CONNECTOR_CONNECTING;
+    conn->connect_started = now;
+}
+
+// Has the pending nonblocking connect finished?
+static void checkConnect(struct net_connector *conn, uint64_t now)
+{
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if (getsockopt(conn->fd, SOL_SOCKET, SO_ERROR, (void *) &error, &len) < 0)
+        error = errno;
+    if (error) {
+        disconnect(conn, now, strerror(error));
+        return;
+    }
+
+    struct sockaddr_storage peer;
+    socklen_t peerlen = sizeof(peer);
+    if (getpeername(conn->fd, (struct sockaddr *) &peer, &peerlen) < 0) {
+        // still in progress
+        if (now - conn->connect_started >= CONNECT_TIMEOUT)
+            disconnect(conn, now, "timed out");
+        return;
+    }
+
+    conn->state = CONNECTOR_CONNECTED;
+    fprintf(stderr, "net connector %s:%s: connected, sending %s%s (%zu bytes waiting)\n",
+            conn->host, conn->port, conn->format, conn->deflate ? " (deflate)" : "", conn->queued);
+    if (conn->dropping) {
+        fprintf(stderr, "net connector %s:%s: %" PRIu64 " bytes were discarded while disconnected\n",
+                conn->host, conn->port, conn->bytes_dropped);
+        conn->dropping = false;
+    }
+}
+
+static void sendQueued(struct net_connector *conn, uint64_t now)
+{
+    // anything the far end sends is ignored, but reading it tells us when it
+    // has closed the connection
+    char discard[256];
+#ifndef _WIN32
+    int nread = read(conn->fd, discard, sizeof(discard));
+#else
+    int nread = recv(conn->fd, discard, sizeof(discard), 0);
+    if (nread < 0) {errno = WSAGetLastError();}
+#endif
+    if (nread == 0) {
+        disconnect(conn, now, "closed by peer");
+        return;
+    }
+    if (nread < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        disconnect(conn, now, strerror(errno));
+        return;
+    }
+
+    struct connector_block *block;
+    while ((block = conn->head)) {
+#ifndef _WIN32
+        int nwritten = write(conn->fd, block->data + block->sent, block->len - block->sent);
+#else
+        int nwritten = send(conn->fd, block->data + block->sent, block->len - block->sent, 0);
+        if (nwritten < 0) {errno = WSAGetLastError();}
+#endif
+        if (nwritten < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                disconnect(conn, now, strerror(errno));
+            return;
+        }
+
+        block->sent += nwritten;
+        conn->bytes_out += nwritten;
+        if (block->sent < block->len)
+            return;
+
+        conn->head = block->next;
+        if (!conn->head)
+            conn->tail = NULL;
+        conn->queued -= block->len;
+        free(block);
+    }
+}
+
+void netConnectorPeriodicWork(uint64_t now)
+{
+    for (struct net_connector *conn = connectors; conn; conn = conn->next) {
+        if (conn->batch_len && now - conn->batch_started >= conn->batch_interval)
+            sealBatch(conn);
+
+        switch (conn->state) {
+        case CONNECTOR_DISCONNECTED:
+            if (now >= conn->next_attempt)
+                startConnect(conn, now);
+            break;
+
+        case CONNECTOR_CONNECTING:
+            checkConnect(conn, now);
+            break;
+
+        case CONNECTOR_CONNECTED:
+            break;
+        }
+
+        if (conn->state == CONNECTOR_CONNECTED)
+            sendQueued(conn, now);
+    }
+}
+
+void netConnectorCleanup(void)
+{
+    uint64_t now = mstime();
+
+    while (connectors) {
+        struct net_connector *conn = connectors;
+        connectors = conn->next;
+
+        // one last attempt to get buffered output out
+        sealBatch(conn);
+        if (conn->state == CONNECTOR_CONNECTED)
+            sendQueued(conn, now);
+        if (conn->fd >= 0)
+            close(conn->fd);
+
+        fprintf(stderr, "net connector %s:%s: %" PRIu64 " bytes of output, %" PRIu64 " bytes sent, %" PRIu64 " bytes discarded, %zu bytes unsent\n",
+                conn->host, conn->port, conn->bytes_in, conn->bytes_out, conn->bytes_dropped, conn->queued);
+
+        if (conn->writer) {
+            --conn->writer->connections;
+            --conn->writer->service->connections;
+        }
+        freeConnector(conn);
+    }
+}
+
+//
+// Receiving side
+//
+
+struct block_reader {
+    unsigned char header[NET_CONNECTOR_BLOCK_HEADER];
+    unsigned header_len;           // bytes of header[] received
+
+    unsigned char *in;             // compressed data of the current block
+    uint32_t in_size;              // its length, from the header
+    uint32_t in_len;               // bytes of in[] received
+    uint32_t out_size;             // uncompressed length, from the header
+
+    unsigned char *out;            // uncompressed data of the last block
+    uint32_t out_len;
+    uint32_t out_pos;              // bytes of out[] already returned
+
+    int error;                     // errno of a bad block; once set, every read fails
+};
+
+#ifdef ENABLE_ZLIB
+
+struct block_reader *blockReaderCreate(void)
+{
+    return calloc(1, sizeof(struct block_reader));
+}
+
+void blockReaderFree(struct block_reader *reader)
+{
+    if (!reader)
+        return;
+    free(reader->in);
+    free(reader->out);
+    free(reader);
+}
+
+static uint32_t getBigEndian32(const unsigned char *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static int readSome(int fd, void *buf, size_t len)
+{
+#ifndef _WIN32
+    return read(fd, buf, len);
+#else
+    int nread = recv(fd, buf, len, 0);
+    if (nread < 0) {errno = WSAGetLastError();}
+    return nread;
+#endif
+}
+
+// Give up on the stream: the rest of it can't be framed
+static int blockError(struct block_reader *reader, int error)
+{
+    reader->error = errno = error;
+    reader->header_len = 0;
+    reader->in_size = reader->in_len = 0;
+    return -1;
+}
+
+// Read the next part of the current block from the socket. Returns 1 if
+// there may be more to do, or the read() result if it returned <= 0.
+// A malformed block also returns -1, with reader->error set.
+static int readBlock(struct block_reader *reader, int fd)
+{
+    if (reader->header_len < NET_CONNECTOR_BLOCK_HEADER) {
+        int nread = readSome(fd, reader->header + reader->header_len, NET_CONNECTOR_BLOCK_HEADER - reader->header_len);
+        if (nread <= 0)
+            return nread;
+
+        reader->header_len += nread;
+        if (reader->header_len < NET_CONNECTOR_BLOCK_HEADER)
+            return 1;
+
+        reader->in_size = getBigEndian32(reader->header + 4);
+        reader->out_size = getBigEndian32(reader->header + 8);
+        if (memcmp(reader->header, NET_CONNECTOR_BLOCK_MAGIC, 4) ||
+            reader->out_size > NET_CONNECTOR_BLOCK_MAX ||
+            reader->in_size > compressBound(reader->out_size)) {
+            return blockError(reader, EINVAL);
+        }
+
+        unsigned char *in = realloc(reader->in, reader->in_size ? reader->in_size : 1);
+        unsigned char *out = realloc(reader->out, reader->out_size ? reader->out_size : 1);
+        if (in)
+            reader->in = in;
+        if (out)
+            reader->out = out;
+        if (!in || !out)
+            return blockError(reader, ENOMEM);
+
+        reader->in_len = 0;
+    }
+
+    if (reader->in_len < reader->in_size) {
+        int nread = readSome(fd, reader->in + reader->in_len, reader->in_size - reader->in_len);
+        if (nread <= 0)
+            return nread;
+
+        reader->in_len += nread;
+        if (reader->in_len < reader->in_size)
+            return 1;
+    }
+
+    // have a complete block
+    uLongf out_len = reader->out_size;
+    if (uncompress(reader->out, &out_len, reader->in, reader->in_size) != Z_OK || out_len != reader->out_size)
+        return blockError(reader, EINVAL);
+
+    reader->out_len = out_len;
+    reader->out_pos = 0;
+    reader->header_len = 0;
+    return 1;
+}
+
+int blockReaderRead(struct block_reader *reader, int fd, char *buf, int len)
+{
+    int done = 0;
+
+    if (reader->error) {
+        errno = reader->error;
+        return -1;
+    }
+
+    // Fill the caller's buffer across block boundaries, so that a short
+    // return means the socket has no more data, just as with read()
+    while (done < len) {
+        if (reader->out_pos < reader->out_len) {
+            uint32_t n = reader->out_len - reader->out_pos;
+            if (n > (uint32_t) (len - done))
+                n = len - done;
+            memcpy(buf + done, reader->out + reader->out_pos, n);
+            reader->out_pos += n;
+            done += n;
+            continue;
+        }
+
+        int result = readBlock(reader, fd);
+        if (result < 0 && reader->error) {
+            // a bad block: fail now so the caller drops the connection
+            errno = reader->error;
+            return -1;
+        }
+        if (result <= 0) {
+            // report EOF or read errors on the next call, once the data is used
+            return done ? done : result;
+        }
+    }
+
+    return done;
+}
+
+#else /* !ENABLE_ZLIB */
+
+struct block_reader *blockReaderCreate(void)
+{
+    return NULL;
+}
+
+void blockReaderFree(struct block_reader *reader)
+{
+    MODES_NOTUSED(reader);
+}
+
+int blockReaderRead(struct block_reader *reader, int fd, char *buf, int len)
+{
+    MODES_NOTUSED(reader);
+    MODES_NOTUSED(fd);
+    MODES_NOTUSED(buf);
+    MODES_NOTUSED(len);
+    errno = EINVAL;
+    return -1;
+}
+
+#endif
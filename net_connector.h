@@ -0,0 +1,88 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// net_connector.h: outbound connections to remote aggregators
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_NET_CONNECTOR_H
+#define DUMP1090_NET_CONNECTOR_H
+
+// A connector (--net-connector host,port,format[,options]) makes an outgoing
+// TCP connection and streams one of the output formats to it, in place of a
+// separate socat / netcat process. Output is generated whether or not the
+// connection is up; while it is down, data is held in memory up to a limit
+// and sent once the connection is re-established. Reconnection attempts back
+// off from 1 to 60 seconds.
+//
+// Options:
+//
+//   deflate        send the data as compressed blocks (see below)
+//   batch=<ms>     collect output for up to this long before sending it
+//                  (default: 0, or 500 with deflate)
+//   buffer=<kB>    memory limit for data waiting to be sent; once it is
+//                  exceeded the oldest data is discarded (default: 4096)
+//
+// Without 'deflate' the connection carries the output format unchanged.
+// With 'deflate' it carries a sequence of blocks, each of which is
+//
+//   magic           4 bytes, NET_CONNECTOR_BLOCK_MAGIC
+//   compressed      4 bytes, big-endian length of the data that follows
+//   uncompressed    4 bytes, big-endian length of the data once uncompressed
+//   data            zlib (RFC 1950) stream
+//
+// Each block is compressed independently, so a block that was cut off when
+// a connection dropped is simply sent again in full on the next connection.
+// A dump1090 listening with --net-zbi-port accepts such a stream of
+// compressed Beast data.
+
+#define NET_CONNECTOR_BLOCK_MAGIC "MZB1"
+#define NET_CONNECTOR_BLOCK_HEADER 12
+
+// Largest uncompressed block a connector produces
+#define NET_CONNECTOR_BLOCK_SIZE (64 * 1024)
+
+// Largest uncompressed block a receiver accepts
+#define NET_CONNECTOR_BLOCK_MAX (1024 * 1024)
+
+struct net_writer;
+
+// Parse a --net-connector specification and add the connector. Returns false,
+// with a message on stderr, if the specification is invalid.
+bool netConnectorAdd(const char *spec);
+
+// Attach the configured connectors to their output writers; called once the
+// network services exist.
+void netConnectorStart(void);
+
+// Hand a writer's flushed output to any connectors using that writer
+void netConnectorQueue(struct net_writer *writer, const void *data, size_t len);
+
+// Connect, send and reconnect as needed; called from modesNetPeriodicWork
+void netConnectorPeriodicWork(uint64_t now);
+
+void netConnectorCleanup(void);
+
+// Receiving side: unpacks a stream of compressed blocks read from a socket.
+struct block_reader;
+
+// Returns NULL if this build has no compression support
+struct block_reader *blockReaderCreate(void);
+void blockReaderFree(struct block_reader *reader);
+
+// Like read(2) on fd, but returns the uncompressed contents of the blocks.
+// A malformed block is reported as an error with errno set to EINVAL, at
+// once and on every later call: the stream can't be resynchronized.
+int blockReaderRead(struct block_reader *reader, int fd, char *buf, int len);
+
+#endif
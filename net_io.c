@@ -72,17 +72,18 @@ static int handleBeastCommand(struct client *c, char *p);
 static int decodeBinMessage(struct client *c, char *p);
 static int decodeHexMessage(struct client *c, char *hex);
 static int handleFaupCommand(struct client *c, char *hex);
+static int handleFilterCommand(struct client *c, char *line);
+static int handleMetricsRequest(struct client *c, char *request);
 
-static void moveNetClient(struct client *c, struct net_service *new_service);
+static void moveNetClient(struct client *c, struct net_service *new_service, struct output_filter *new_filter);
 
-static void send_raw_heartbeat(struct net_service *service);
-static void send_beast_heartbeat(struct net_service *service);
-static void send_sbs_heartbeat(struct net_service *service);
-static void send_stratux_heartbeat(struct net_service *service);
+static void send_raw_heartbeat(struct net_writer *writer);
+static void send_beast_heartbeat(struct net_writer *writer);
+static void send_sbs_heartbeat(struct net_writer *writer);
+static void send_stratux_heartbeat(struct net_writer *writer);
 
-static void writeBeastMessage(struct net_writer *writer, uint64_t timestamp, double signalLevel, unsigned char *msg, int msgLen);
-
-static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a);
+struct output_context;
+static void writeFATSVEvent(struct output_context *ctx);
 static void writeFATSVPositionUpdate(float lat, float lon, float alt);
 
 static void autoset_modeac();
@@ -126,8 +127,13 @@ struct net_service *serviceInit(const char *descr, struct net_writer *writer, he
             exit(1);
         }
 
+        service->writer->next = NULL;
         service->writer->service = service;
+        service->writer->filter = NULL;
+        service->writer->connections = 0;
         service->writer->dataUsed = 0;
+        service->writer->pendingCount = 0;
+        service->writer->udp = NULL;
         service->writer->lastWrite = mstime();
         service->writer->send_heartbeat = hb;
     }
@@ -155,15 +161,32 @@ struct client *createGenericClient(struct net_service *service, int fd)
     }
 
     c->service    = NULL;
+    c->writer     = NULL;
+    c->filter     = NULL;
+    c->blocks     = NULL;
     c->next       = Modes.clients;
     c->fd         = fd;
     c->buflen     = 0;
+    c->reply      = NULL;
+    c->reply_len  = 0;
+    c->reply_sent = 0;
     c->modeac_requested = 0;
     c->verbatim_requested = (service == Modes.beast_verbatim_service || service == Modes.beast_verbatim_local_service);
     c->local_requested = (service == Modes.beast_verbatim_local_service);
+    c->remote_modes = 0;
+    c->duplicates_seen = 0;
+    c->duplicates_dropped = 0;
+    if (anetPeerToString(NULL, fd, c->peer, sizeof(c->peer)) != ANET_OK)
+        c->peer[0] = 0;
     Modes.clients = c;
 
-    moveNetClient(c, service);
+    if (service->read_compressed && !(c->blocks = blockReaderCreate())) {
+        fprintf(stderr, "Out of memory allocating a new %s network client\n", service->descr);
+        exit(1);
+    }
+
+    moveNetClient(c, service, NULL);
+    ++service->connections_total;
 
     return c;
 }
@@ -258,6 +281,36 @@ struct net_service *makeFaCmdInputService(void)
     return serviceInit("faup Command input", NULL, NULL, READ_MODE_ASCII, "\n", handleFaupCommand);
 }
 
+static const char *outputFormats[] = { "beast", "beast_verbatim", "beast_local", "raw", "sbs", "stratux", "wiffle", NULL };
+
+const char *netOutputFormat(const char *name)
+{
+    for (const char **f = outputFormats; *f; ++f) {
+        if (!strcmp(name, *f))
+            return *f;
+    }
+    return NULL;
+}
+
+struct net_writer *netOutputWriter(const char *format)
+{
+    if (!strcmp(format, "beast"))
+        return Modes.net_verbatim ? &Modes.beast_verbatim_out : &Modes.beast_cooked_out;
+    if (!strcmp(format, "beast_verbatim"))
+        return &Modes.beast_verbatim_out;
+    if (!strcmp(format, "beast_local"))
+        return &Modes.beast_verbatim_local_out;
+    if (!strcmp(format, "raw"))
+        return &Modes.raw_out;
+    if (!strcmp(format, "sbs"))
+        return &Modes.sbs_out;
+    if (!strcmp(format, "stratux"))
+        return &Modes.stratux_out;
+    if (!strcmp(format, "wiffle"))
+        return &Modes.wiffle_out;
+    return NULL;
+}
+
 void modesInitNet(void) {
     struct net_service *s;
 
@@ -266,7 +319,7 @@ void modesInitNet(void) {
     Modes.services = NULL;
 
     // set up listeners
-    s = serviceInit("Raw TCP output", &Modes.raw_out, send_raw_heartbeat, READ_MODE_IGNORE, NULL, NULL);
+    s = serviceInit("Raw TCP output", &Modes.raw_out, send_raw_heartbeat, READ_MODE_ASCII, "\n", handleFilterCommand);
     serviceListen(s, Modes.net_bind_address, Modes.net_output_raw_ports);
 
     // we maintain three output services for the different option setting combinations we support
@@ -280,13 +333,13 @@ void modesInitNet(void) {
     else
         serviceListen(Modes.beast_cooked_service, Modes.net_bind_address, Modes.net_output_beast_ports);
 
-    s = serviceInit("Basestation TCP output", &Modes.sbs_out, send_sbs_heartbeat, READ_MODE_IGNORE, NULL, NULL);
+    s = serviceInit("Basestation TCP output", &Modes.sbs_out, send_sbs_heartbeat, READ_MODE_ASCII, "\n", handleFilterCommand);
     serviceListen(s, Modes.net_bind_address, Modes.net_output_sbs_ports);
 
-    s = serviceInit("Stratux TCP output", &Modes.stratux_out, send_stratux_heartbeat, READ_MODE_IGNORE, NULL, NULL);
+    s = serviceInit("Stratux TCP output", &Modes.stratux_out, send_stratux_heartbeat, READ_MODE_ASCII, "\n", handleFilterCommand);
     serviceListen(s, Modes.net_bind_address, Modes.net_output_stratux_ports);
 
-    s = serviceInit("Wiffle TCP output", &Modes.wiffle_out, NULL, READ_MODE_IGNORE, NULL, NULL);
+    s = serviceInit("Wiffle TCP output", &Modes.wiffle_out, NULL, READ_MODE_ASCII, "\n", handleFilterCommand);
     serviceListen(s, Modes.net_bind_address, Modes.net_output_wiffle_ports);
 
     s = serviceInit("Raw TCP input", NULL, NULL, READ_MODE_ASCII, "\n", decodeHexMessage);
@@ -294,6 +347,23 @@ void modesInitNet(void) {
 
     s = makeBeastInputService();
     serviceListen(s, Modes.net_bind_address, Modes.net_input_beast_ports);
+
+    s = serviceInit("OpenMetrics HTTP", NULL, NULL, READ_MODE_ASCII, "\r\n\r\n", handleMetricsRequest);
+    serviceListen(s, Modes.net_bind_address, Modes.net_metrics_ports);
+
+    s = makeBeastInputService();
+    s->descr = "Compressed Beast TCP input";
+    s->read_compressed = true;
+    serviceListen(s, Modes.net_bind_address, Modes.net_input_zbeast_ports);
+
+    if (Modes.net_shm_ring && !shmRingCreate(Modes.net_shm_ring, SHM_RING_DEFAULT_CAPACITY))
+        exit(1);
+
+    netConnectorStart();
+    if (!netUdpStart())
+        exit(1);
+    if (!dedupInit())
+        exit(1);
 }
 //
 //=========================================================================
@@ -334,10 +404,19 @@ static void modesCloseClient(struct client *c) {
 
     close(c->fd);
     c->service->connections--;
+    if (c->writer)
+        c->writer->connections--;
 
     // mark it as inactive and ready to be freed
     c->fd = -1;
     c->service = NULL;
+    c->writer = NULL;
+    outputFilterRelease(c->filter);
+    c->filter = NULL;
+    blockReaderFree(c->blocks);
+    c->blocks = NULL;
+    free(c->reply);
+    c->reply = NULL;
     c->modeac_requested = 0;
 
     autoset_modeac();
@@ -345,7 +424,7 @@ static void modesCloseClient(struct client *c) {
 //
 //=========================================================================
 //
-// Send the write buffer for the specified writer to all connected clients
+// Send the write buffer for the specified writer to all clients using it
 //
 static void flushWrites(struct net_writer *writer) {
     struct client *c;
@@ -353,18 +432,34 @@ static void flushWrites(struct net_writer *writer) {
     for (c = Modes.clients; c; c = c->next) {
         if (!c->service)
             continue;
-        if (c->service == writer->service) {
+        if (c->writer == writer) {
 #ifndef _WIN32
             int nwritten = write(c->fd, writer->data, writer->dataUsed);
 #else
             int nwritten = send(c->fd, writer->data, writer->dataUsed, 0 );
 #endif
+            if (nwritten > 0)
+                c->service->bytes_written += nwritten;
             if (nwritten != writer->dataUsed) {
                 modesCloseClient(c);
             }
         }
     }
 
+    // pipeline latency of the messages that were just sent
+    if (writer->pendingCount) {
+        uint64_t now = monotonic_us();
+        for (unsigned i = 0; i < writer->pendingCount; ++i) {
+            stats_add_latency(&Modes.stats_current, LATENCY_FLUSH, now - writer->pending[i].queued);
+            stats_add_latency(&Modes.stats_current, LATENCY_NETWORK, now - writer->pending[i].decoded);
+        }
+        writer->pendingCount = 0;
+    }
+
+    netConnectorQueue(writer, writer->data, writer->dataUsed);
+    if (writer->udp)
+        netUdpFlush(writer->udp);
+
     writer->dataUsed = 0;
     writer->lastWrite = mstime();
 }
@@ -374,7 +469,7 @@ static void flushWrites(struct net_writer *writer) {
 static void *prepareWrite(struct net_writer *writer, int len) {
     if (!writer ||
         !writer->service ||
-        !writer->service->connections ||
+        !writer->connections ||
         !writer->data)
         return NULL;
 
@@ -389,65 +484,175 @@ static void *prepareWrite(struct net_writer *writer, int len) {
     return writer->data + writer->dataUsed;
 }
 
+// Pipeline timestamps of the message currently being queued by
+// modesQueueOutput, or zero while writing anything else (heartbeats etc)
+static struct writer_latency output_latency;
+
 // Complete a write previously begun by prepareWrite.
 // endptr should point one byte past the last byte written
 // to the buffer returned from prepareWrite.
 static void completeWrite(struct net_writer *writer, void *endptr) {
+    if (writer->udp)
+        netUdpQueue(writer->udp, (char *) writer->data + writer->dataUsed, (char *) endptr - ((char *) writer->data + writer->dataUsed));
+
     writer->dataUsed = endptr - writer->data;
 
+    if (output_latency.decoded && writer->pendingCount < WRITER_LATENCY_SLOTS)
+        writer->pending[writer->pendingCount++] = output_latency;
+
     if (writer->dataUsed >= Modes.net_output_flush_size) {
         flushWrites(writer);
     }
 }
 
+// Is anyone listening to this writer?
+static bool writerActive(const struct net_writer *writer)
+{
+    return writer->service && writer->connections && writer->data;
+}
+
+// Find the writer of a service that serves clients with the given filter,
+// creating it if needed. Writers with identical filters are shared, so each
+// message is formatted once for all clients with the same filter.
+static struct net_writer *serviceWriter(struct net_service *service, struct output_filter *filter)
+{
+    struct net_writer *writer;
+
+    if (!service->writer)
+        return NULL;
+
+    for (writer = service->writer; writer; writer = writer->next) {
+        if (writer->filter == filter)
+            return writer;
+    }
+
+    if (!(writer = calloc(1, sizeof(*writer))) || !(writer->data = malloc(MODES_OUT_BUF_SIZE))) {
+        fprintf(stderr, "Out of memory allocating output buffer for service %s\n", service->descr);
+        exit(1);
+    }
+
+    writer->service = service;
+    writer->filter = outputFilterRetain(filter);
+    writer->lastWrite = mstime();
+    writer->send_heartbeat = service->writer->send_heartbeat;
+
+    writer->next = service->writer->next;
+    service->writer->next = writer;
+    return writer;
+}
+
+// Free the filtered writers of a service that no longer have any clients
+static void pruneServiceWriters(struct net_service *service)
+{
+    struct net_writer **prev, *writer;
+
+    if (!service->writer)
+        return;
+
+    for (prev = &service->writer->next, writer = *prev; writer; writer = *prev) {
+        if (writer->connections) {
+            prev = &writer->next;
+            continue;
+        }
+
+        *prev = writer->next;
+        outputFilterRelease(writer->filter);
+        free(writer->data);
+        free(writer);
+    }
+}
+
 //
 //=========================================================================
 //
-// Write raw output in Beast Binary format with Timestamp to TCP clients
+// Per-message output context.
+//
+// modesQueueOutput hands every message to each of the output writers in
+// turn. Several of them need the same derived values (the Beast encoding,
+// hex strings, the reception time, RSSI); the context holds those, each
+// computed the first time a writer asks for it and then shared by the rest.
+// Writers with no connected clients return before asking for anything.
 //
-static void modesSendBeastVerbatimOutput(struct modesMessage *mm) {
-    // Don't forward mlat messages, unless --forward-mlat is set
-    if (mm->source == SOURCE_MLAT && !Modes.forward_mlat)
-        return;
 
-    // Do verbatim output for all messages
-    writeBeastMessage(&Modes.beast_verbatim_out, mm->timestampMsg, mm->signalLevel, mm->verbatim, mm->msgbits / 8);
-}
+// Longest Beast frame: type, 6 timestamp bytes, signal, long message, all escaped
+#define BEAST_FRAME_MAX (2 + 2 * (7 + MODES_LONG_MSG_BYTES))
 
-static void modesSendBeastVerbatimLocalOutput(struct modesMessage *mm) {
-    // Never forward remote messages
-    if (mm->remote)
-        return;
+enum {
+    OUTPUT_CONTEXT_BEAST_SIGNAL   = 1 << 0,
+    OUTPUT_CONTEXT_BEAST_VERBATIM = 1 << 1,
+    OUTPUT_CONTEXT_BEAST_COOKED   = 1 << 2,
+    OUTPUT_CONTEXT_HEX_UPPER      = 1 << 3,
+    OUTPUT_CONTEXT_HEX_LOWER      = 1 << 4,
+    OUTPUT_CONTEXT_RECEIVE_LOCAL  = 1 << 5,
+    OUTPUT_CONTEXT_RECEIVE_UTC    = 1 << 6,
+    OUTPUT_CONTEXT_MLAT_TIMESTAMP = 1 << 7,
+    OUTPUT_CONTEXT_RSSI           = 1 << 8
+};
 
-    // Do verbatim output for all messages
-    writeBeastMessage(&Modes.beast_verbatim_local_out, mm->timestampMsg, mm->signalLevel, mm->verbatim, mm->msgbits / 8);
-}
+struct output_context {
+    struct modesMessage *mm;
+    struct aircraft *a;
+    int msgLen;                      // message length in bytes
+
+    // filtering decisions shared by several writers
+    bool mlat;                       // message came from mlat results
+    bool corrected2;                 // message had 2 bits corrected
+    bool reliable;                   // message or its aircraft is reliable
+
+    unsigned valid;                  // OUTPUT_CONTEXT_* bits for the fields below
+
+    unsigned char beast_signal;
+    int beast_verbatim_len;          // 0 if the message length can't be Beast-encoded
+    char beast_verbatim[BEAST_FRAME_MAX];
+    int beast_cooked_len;
+    char beast_cooked[BEAST_FRAME_MAX];
+    char hex_upper[MODES_LONG_MSG_BYTES * 2 + 1];
+    char hex_lower[MODES_LONG_MSG_BYTES * 2 + 1];
+    const struct tm *receive_local;
+    const struct tm *receive_utc;
+    char mlat_timestamp[14];         // "@" + 12 hex digits
+    double rssi;
+
+    uint64_t seq;                    // message sequence number, for caching filter results
+};
 
-static void modesSendBeastCookedOutput(struct modesMessage *mm, struct aircraft *a) {
-    // Don't forward mlat messages, unless --forward-mlat is set
-    if (mm->source == SOURCE_MLAT && !Modes.forward_mlat)
-        return;
+static void outputContextInit(struct output_context *ctx, struct modesMessage *mm, struct aircraft *a)
+{
+    ctx->mm = mm;
+    ctx->a = a;
+    ctx->msgLen = mm->msgbits / 8;
+    ctx->mlat = (mm->source == SOURCE_MLAT);
+    ctx->corrected2 = (mm->correctedbits >= 2);
+    ctx->reliable = (mm->reliable || !a || a->reliable);
+    ctx->valid = 0;
 
-    // Filter some messages from cooked output
-    // Don't forward 2-bit-corrected messages
-    if (mm->correctedbits >= 2)
-        return;
+    static uint64_t seq;
+    ctx->seq = ++seq;
+}
 
-    // Don't forward unreliable messages
-    if ((a && !a->reliable) && !mm->reliable)
-        return;
+static unsigned char contextBeastSignal(struct output_context *ctx)
+{
+    if (!(ctx->valid & OUTPUT_CONTEXT_BEAST_SIGNAL)) {
+        double signalLevel = ctx->mm->signalLevel;
+        int sig = round(sqrt(signalLevel) * 255);
+        if (signalLevel > 0 && sig < 1)
+            sig = 1;
+        if (sig > 255)
+            sig = 255;
+        ctx->beast_signal = (unsigned char) sig;
+        ctx->valid |= OUTPUT_CONTEXT_BEAST_SIGNAL;
+    }
 
-    writeBeastMessage(&Modes.beast_cooked_out, mm->timestampMsg, mm->signalLevel, mm->msg, mm->msgbits / 8);
+    return ctx->beast_signal;
 }
 
-static void writeBeastMessage(struct net_writer *writer, uint64_t timestamp, double signalLevel, unsigned char *msg, int msgLen) {
+// Encode a Beast binary frame into p, which must have room for
+// BEAST_FRAME_MAX bytes. Returns the frame length, or 0 if msgLen is
+// not a length that Beast can carry.
+static int encodeBeastMessage(char *p, uint64_t timestamp, unsigned char sig, const unsigned char *msg, int msgLen)
+{
+    char *start = p;
     char ch;
-    int  j;
-    int sig;
-
-    char *p = prepareWrite(writer, 2 + 2 * (7 + msgLen));
-    if (!p)
-        return;
 
     *p++ = 0x1a;
     if      (msgLen == MODES_SHORT_MSG_BYTES)
@@ -457,7 +662,7 @@ static void writeBeastMessage(struct net_writer *writer, uint64_t timestamp, dou
     else if (msgLen == MODEAC_MSG_BYTES)
       {*p++ = '1';}
     else
-      {return;}
+      {return 0;}
 
     /* timestamp, big-endian */
     *p++ = (ch = (timestamp >> 40));
@@ -473,36 +678,219 @@ static void writeBeastMessage(struct net_writer *writer, uint64_t timestamp, dou
     *p++ = (ch = (timestamp));
     if (0x1A == ch) {*p++ = ch; }
 
-    sig = round(sqrt(signalLevel) * 255);
-    if (signalLevel > 0 && sig < 1)
-        sig = 1;
-    if (sig > 255)
-        sig = 255;
     *p++ = ch = (char)sig;
     if (0x1A == ch) {*p++ = ch; }
 
-    for (j = 0; j < msgLen; j++) {
+    for (int j = 0; j < msgLen; j++) {
         *p++ = (ch = msg[j]);
         if (0x1A == ch) {*p++ = ch; }
     }
 
-    completeWrite(writer, p);
+    return p - start;
 }
 
-static void send_beast_heartbeat(struct net_service *service)
+// Beast frame of the message as received, before any correction
+static int contextBeastVerbatim(struct output_context *ctx, const char **frame)
 {
-    static char heartbeat_message[] = { 0x1a, '1', 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-    char *data;
+    if (!(ctx->valid & OUTPUT_CONTEXT_BEAST_VERBATIM)) {
+        ctx->beast_verbatim_len = encodeBeastMessage(ctx->beast_verbatim, ctx->mm->timestampMsg, contextBeastSignal(ctx), ctx->mm->verbatim, ctx->msgLen);
+        ctx->valid |= OUTPUT_CONTEXT_BEAST_VERBATIM;
+    }
 
-    if (!service->writer)
+    *frame = ctx->beast_verbatim;
+    return ctx->beast_verbatim_len;
+}
+
+// Beast frame of the corrected message; the same as the verbatim frame
+// unless some bits were corrected
+static int contextBeastCooked(struct output_context *ctx, const char **frame)
+{
+    if (!memcmp(ctx->mm->msg, ctx->mm->verbatim, ctx->msgLen))
+        return contextBeastVerbatim(ctx, frame);
+
+    if (!(ctx->valid & OUTPUT_CONTEXT_BEAST_COOKED)) {
+        ctx->beast_cooked_len = encodeBeastMessage(ctx->beast_cooked, ctx->mm->timestampMsg, contextBeastSignal(ctx), ctx->mm->msg, ctx->msgLen);
+        ctx->valid |= OUTPUT_CONTEXT_BEAST_COOKED;
+    }
+
+    *frame = ctx->beast_cooked;
+    return ctx->beast_cooked_len;
+}
+
+static void encodeHex(char *p, const unsigned char *data, int len, const char *digits)
+{
+    if (len > MODES_LONG_MSG_BYTES)
+        len = MODES_LONG_MSG_BYTES;
+
+    for (int j = 0; j < len; j++) {
+        *p++ = digits[data[j] >> 4];
+        *p++ = digits[data[j] & 15];
+    }
+    *p = 0;
+}
+
+// Hex string of the (corrected) message, upper or lower case
+static const char *contextHex(struct output_context *ctx, bool upper)
+{
+    if (upper) {
+        if (!(ctx->valid & OUTPUT_CONTEXT_HEX_UPPER)) {
+            encodeHex(ctx->hex_upper, ctx->mm->msg, ctx->msgLen, "0123456789ABCDEF");
+            ctx->valid |= OUTPUT_CONTEXT_HEX_UPPER;
+        }
+        return ctx->hex_upper;
+    } else {
+        if (!(ctx->valid & OUTPUT_CONTEXT_HEX_LOWER)) {
+            encodeHex(ctx->hex_lower, ctx->mm->msg, ctx->msgLen, "0123456789abcdef");
+            ctx->valid |= OUTPUT_CONTEXT_HEX_LOWER;
+        }
+        return ctx->hex_lower;
+    }
+}
+
+// localtime_r / gmtime_r are slow compared to everything else here, and
+// consecutive messages are nearly always within the same second, so keep
+// the last conversion around
+struct tm_cache {
+    bool valid;
+    time_t t;
+    struct tm tm;
+};
+
+static const struct tm *cachedTime(struct tm_cache *cache, time_t t, bool utc)
+{
+    if (!cache->valid || cache->t != t) {
+        if (utc)
+            gmtime_r(&t, &cache->tm);
+        else
+            localtime_r(&t, &cache->tm);
+        cache->t = t;
+        cache->valid = true;
+    }
+
+    return &cache->tm;
+}
+
+// Broken-down message reception time (system clock), local or UTC
+static const struct tm *contextReceiveTime(struct output_context *ctx, bool utc)
+{
+    static struct tm_cache local_cache, utc_cache;
+    time_t received = (time_t) (ctx->mm->sysTimestampMsg / 1000);
+
+    if (utc) {
+        if (!(ctx->valid & OUTPUT_CONTEXT_RECEIVE_UTC)) {
+            ctx->receive_utc = cachedTime(&utc_cache, received, true);
+            ctx->valid |= OUTPUT_CONTEXT_RECEIVE_UTC;
+        }
+        return ctx->receive_utc;
+    } else {
+        if (!(ctx->valid & OUTPUT_CONTEXT_RECEIVE_LOCAL)) {
+            ctx->receive_local = cachedTime(&local_cache, received, false);
+            ctx->valid |= OUTPUT_CONTEXT_RECEIVE_LOCAL;
+        }
+        return ctx->receive_local;
+    }
+}
+
+// "@" followed by the 12MHz message timestamp, as used by --mlat raw output
+static const char *contextMlatTimestamp(struct output_context *ctx)
+{
+    if (!(ctx->valid & OUTPUT_CONTEXT_MLAT_TIMESTAMP)) {
+        snprintf(ctx->mlat_timestamp, sizeof(ctx->mlat_timestamp), "@%012" PRIX64, ctx->mm->timestampMsg);
+        ctx->valid |= OUTPUT_CONTEXT_MLAT_TIMESTAMP;
+    }
+
+    return ctx->mlat_timestamp;
+}
+
+static double contextRSSI(struct output_context *ctx)
+{
+    if (!(ctx->valid & OUTPUT_CONTEXT_RSSI)) {
+        ctx->rssi = 10 * log10(ctx->mm->signalLevel);
+        ctx->valid |= OUTPUT_CONTEXT_RSSI;
+    }
+
+    return ctx->rssi;
+}
+
+static void writeBeastFrame(struct net_writer *writer, const char *frame, int len)
+{
+    if (!len)
+        return;
+
+    char *p = prepareWrite(writer, len);
+    if (!p)
+        return;
+
+    memcpy(p, frame, len);
+    completeWrite(writer, p + len);
+}
+
+//
+//=========================================================================
+//
+// Write raw output in Beast Binary format with Timestamp to TCP clients
+//
+static void modesSendBeastVerbatimOutput(struct output_context *ctx, struct net_writer *writer) {
+    if (!writerActive(writer))
+        return;
+
+    // Don't forward mlat messages, unless --forward-mlat is set
+    if (ctx->mlat && !Modes.forward_mlat)
+        return;
+
+    // Do verbatim output for all messages
+    const char *frame;
+    int len = contextBeastVerbatim(ctx, &frame);
+    writeBeastFrame(writer, frame, len);
+}
+
+static void modesSendBeastVerbatimLocalOutput(struct output_context *ctx, struct net_writer *writer) {
+    if (!writerActive(writer))
+        return;
+
+    // Never forward remote messages
+    if (ctx->mm->remote)
+        return;
+
+    // Do verbatim output for all messages
+    const char *frame;
+    int len = contextBeastVerbatim(ctx, &frame);
+    writeBeastFrame(writer, frame, len);
+}
+
+static void modesSendBeastCookedOutput(struct output_context *ctx, struct net_writer *writer) {
+    if (!writerActive(writer))
+        return;
+
+    // Don't forward mlat messages, unless --forward-mlat is set
+    if (ctx->mlat && !Modes.forward_mlat)
+        return;
+
+    // Filter some messages from cooked output
+    // Don't forward 2-bit-corrected messages
+    if (ctx->corrected2)
+        return;
+
+    // Don't forward unreliable messages
+    if (!ctx->reliable)
         return;
 
-    data = prepareWrite(service->writer, sizeof(heartbeat_message));
+    const char *frame;
+    int len = contextBeastCooked(ctx, &frame);
+    writeBeastFrame(writer, frame, len);
+}
+
+static void send_beast_heartbeat(struct net_writer *writer)
+{
+    static char heartbeat_message[] = { 0x1a, '1', 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    char *data;
+
+    data = prepareWrite(writer, sizeof(heartbeat_message));
     if (!data)
         return;
 
     memcpy(data, heartbeat_message, sizeof(heartbeat_message));
-    completeWrite(service->writer, data + sizeof(heartbeat_message));
+    completeWrite(writer, data + sizeof(heartbeat_message));
 }
 
 //
@@ -510,60 +898,58 @@ static void send_beast_heartbeat(struct net_service *service)
 //
 // Write raw output to TCP clients
 //
-static void modesSendRawOutput(struct modesMessage *mm, struct aircraft *a) {
+static void modesSendRawOutput(struct output_context *ctx, struct net_writer *writer) {
+    struct modesMessage *mm = ctx->mm;
+
+    if (!writerActive(writer))
+        return;
+
     // Don't ever forward mlat messages via raw output.
-    if (mm->source == SOURCE_MLAT)
+    if (ctx->mlat)
         return;
 
     // Filter some messages
     // Don't forward 2-bit-corrected messages
-    if (mm->correctedbits >= 2)
+    if (ctx->corrected2)
         return;
 
     // Don't forward unreliable messages
-    if ((a && !a->reliable) && !mm->reliable)
+    if (!ctx->reliable)
         return;
 
-    int msgLen = mm->msgbits / 8;
-    char *p = prepareWrite(&Modes.raw_out, msgLen*2 + 15);
+    int msgLen = ctx->msgLen;
+    char *p = prepareWrite(writer, msgLen*2 + 15);
     if (!p)
         return;
 
     if (Modes.mlat && mm->timestampMsg) {
         /* timestamp, big-endian */
-        sprintf(p, "@%012" PRIX64,
-                mm->timestampMsg);
+        memcpy(p, contextMlatTimestamp(ctx), 13);
         p += 13;
     } else
         *p++ = '*';
 
-    unsigned char *msg = mm->msg;
-    for (int j = 0; j < msgLen; j++) {
-        sprintf(p, "%02X", msg[j]);
-        p += 2;
-    }
+    memcpy(p, contextHex(ctx, true), msgLen * 2);
+    p += msgLen * 2;
 
     *p++ = ';';
     *p++ = '\n';
 
-    completeWrite(&Modes.raw_out, p);
+    completeWrite(writer, p);
 }
 
-static void send_raw_heartbeat(struct net_service *service)
+static void send_raw_heartbeat(struct net_writer *writer)
 {
     static char *heartbeat_message = "*0000;\n";
     char *data;
     int len = strlen(heartbeat_message);
 
-    if (!service->writer)
-        return;
-
-    data = prepareWrite(service->writer, len);
+    data = prepareWrite(writer, len);
     if (!data)
         return;
 
     memcpy(data, heartbeat_message, len);
-    completeWrite(service->writer, data + len);
+    completeWrite(writer, data + len);
 }
 
 //
@@ -571,33 +957,38 @@ static void send_raw_heartbeat(struct net_service *service)
 //
 // Write SBS output to TCP clients
 //
-static void modesSendSBSOutput(struct modesMessage *mm, struct aircraft *a) {
+static void modesSendSBSOutput(struct output_context *ctx, struct net_writer *writer) {
+    struct modesMessage *mm = ctx->mm;
+    struct aircraft *a = ctx->a;
     char *p;
     struct timespec now;
-    struct tm    stTime_receive, stTime_now;
+    static struct tm_cache now_cache;
     int          msgType;
 
+    if (!writerActive(writer))
+        return;
+
     // We require a tracked aircraft for SBS output
     if (!a)
         return;
 
     // Don't ever forward 2-bit-corrected messages via SBS output.
-    if (mm->correctedbits >= 2)
+    if (ctx->corrected2)
         return;
 
     // Don't ever forward mlat messages via SBS output.
-    if (mm->source == SOURCE_MLAT)
+    if (ctx->mlat)
         return;
 
     // Don't ever send unreliable messages via SBS output
-    if (!mm->reliable && !a->reliable)
+    if (!ctx->reliable)
         return;
 
     // For now, suppress non-ICAO addresses
     if (mm->addr & MODES_NON_ICAO_ADDRESS)
         return;
 
-    p = prepareWrite(&Modes.sbs_out, 200);
+    p = prepareWrite(writer, 200);
     if (!p)
         return;
 
@@ -652,19 +1043,18 @@ static void modesSendSBSOutput(struct modesMessage *mm, struct aircraft *a) {
 
     // Find current system time
     clock_gettime(CLOCK_REALTIME, &now);
-    localtime_r(&now.tv_sec, &stTime_now);
+    const struct tm *stTime_now = cachedTime(&now_cache, now.tv_sec, false);
 
     // Find message reception time
-    time_t received = (time_t) (mm->sysTimestampMsg / 1000);
-    localtime_r(&received, &stTime_receive);
+    const struct tm *stTime_receive = contextReceiveTime(ctx, false);
 
     // Fields 7 & 8 are the message reception time and date
-    p += sprintf(p, "%04d/%02d/%02d,", (stTime_receive.tm_year+1900),(stTime_receive.tm_mon+1), stTime_receive.tm_mday);
-    p += sprintf(p, "%02d:%02d:%02d.%03u,", stTime_receive.tm_hour, stTime_receive.tm_min, stTime_receive.tm_sec, (unsigned) (mm->sysTimestampMsg % 1000));
+    p += sprintf(p, "%04d/%02d/%02d,", (stTime_receive->tm_year+1900),(stTime_receive->tm_mon+1), stTime_receive->tm_mday);
+    p += sprintf(p, "%02d:%02d:%02d.%03u,", stTime_receive->tm_hour, stTime_receive->tm_min, stTime_receive->tm_sec, (unsigned) (mm->sysTimestampMsg % 1000));
 
     // Fields 9 & 10 are the current time and date
-    p += sprintf(p, "%04d/%02d/%02d,", (stTime_now.tm_year+1900),(stTime_now.tm_mon+1), stTime_now.tm_mday);
-    p += sprintf(p, "%02d:%02d:%02d.%03u", stTime_now.tm_hour, stTime_now.tm_min, stTime_now.tm_sec, (unsigned) (now.tv_nsec / 1000000U));
+    p += sprintf(p, "%04d/%02d/%02d,", (stTime_now->tm_year+1900),(stTime_now->tm_mon+1), stTime_now->tm_mday);
+    p += sprintf(p, "%02d:%02d:%02d.%03u", stTime_now->tm_hour, stTime_now->tm_min, stTime_now->tm_sec, (unsigned) (now.tv_nsec / 1000000U));
 
     // Field 11 is the callsign (if we have it)
     if (mm->callsign_valid) {p += sprintf(p, ",%s", mm->callsign);}
@@ -786,24 +1176,21 @@ static void modesSendSBSOutput(struct modesMessage *mm, struct aircraft *a) {
 
     p += sprintf(p, "\r\n");
 
-    completeWrite(&Modes.sbs_out, p);
+    completeWrite(writer, p);
 }
 
-static void send_sbs_heartbeat(struct net_service *service)
+static void send_sbs_heartbeat(struct net_writer *writer)
 {
     static char *heartbeat_message = "\r\n";  // is there a better one?
     char *data;
     int len = strlen(heartbeat_message);
 
-    if (!service->writer)
-        return;
-
-    data = prepareWrite(service->writer, len);
+    data = prepareWrite(writer, len);
     if (!data)
         return;
 
     memcpy(data, heartbeat_message, len);
-    completeWrite(service->writer, data + len);
+    completeWrite(writer, data + len);
 }
 
 //
@@ -813,22 +1200,27 @@ static void send_sbs_heartbeat(struct net_service *service)
 //
 
 #define STRATUX_MAX_PACKET_SIZE 1000
-static void modesSendStratuxOutput(struct modesMessage *mm, struct aircraft *a) {
+static void modesSendStratuxOutput(struct output_context *ctx, struct net_writer *writer) {
+    struct modesMessage *mm = ctx->mm;
+    struct aircraft *a = ctx->a;
     char *p;
 
+    if (!writerActive(writer))
+        return;
+
     // We require a tracked aircraft for Stratux output
     if (!a)
         return;
 
     // Don't ever forward 2-bit-corrected messages via Stratux output.
-    if (mm->correctedbits >= 2)
+    if (ctx->corrected2)
         return;
 
     // Don't ever send unreliable messages via Stratux output
-    if (!mm->reliable && !a->reliable)
+    if (!ctx->reliable)
         return;
 
-    p = prepareWrite(&Modes.stratux_out, STRATUX_MAX_PACKET_SIZE); // larger buffer size needed vs SBS
+    p = prepareWrite(writer, STRATUX_MAX_PACKET_SIZE); // larger buffer size needed vs SBS
     if (!p)
         return;
 
@@ -845,7 +1237,7 @@ static void modesSendStratuxOutput(struct modesMessage *mm, struct aircraft *a)
     }
 
     const char* is_mlat_str = "false";
-    if (mm->source == SOURCE_MLAT)
+    if (ctx->mlat)
         is_mlat_str = "true";
 
     p = safe_snprintf(p, end,
@@ -977,38 +1369,33 @@ static void modesSendStratuxOutput(struct modesMessage *mm, struct aircraft *a)
         p = safe_snprintf(p, end, "\"Emitter_category\":null,");
 
     // Time message received (based on system clock). Format is 2016-02-20T06:35:43.155Z
-    struct tm stTime_receive;
-    time_t received = (time_t) (mm->sysTimestampMsg / 1000);
-    gmtime_r(&received, &stTime_receive);
+    const struct tm *stTime_receive = contextReceiveTime(ctx, true);
     p = safe_snprintf(p, end, "\"Timestamp\":\"%04d-%02d-%02dT%02d:%02d:%02d.%03uZ\"",
-            (stTime_receive.tm_year+1900),(stTime_receive.tm_mon+1),
-            stTime_receive.tm_mday, stTime_receive.tm_hour,
-            stTime_receive.tm_min, stTime_receive.tm_sec,
+            (stTime_receive->tm_year+1900),(stTime_receive->tm_mon+1),
+            stTime_receive->tm_mday, stTime_receive->tm_hour,
+            stTime_receive->tm_min, stTime_receive->tm_sec,
             (unsigned)(mm->sysTimestampMsg % 1000));
 
     p = safe_snprintf(p, end, "}\r\n");
 
     if (p < end)
-        completeWrite(&Modes.stratux_out, p);
+        completeWrite(writer, p);
     else
         fprintf(stderr, "stratux: output too large (max %d, overran by %d)\n", STRATUX_MAX_PACKET_SIZE, (int) (p - end));
 }
 
-static void send_stratux_heartbeat(struct net_service *service)
+static void send_stratux_heartbeat(struct net_writer *writer)
 {
     static char *heartbeat_message = "{\"Icao_addr\":134217727}\r\n";  // 0x07FFFFFF. Overflows 24-bit ICAO to signal invalic #, need to validate that this won't cause problems with traffic.go
     char *data;
     int len = strlen(heartbeat_message);
 
-    if (!service->writer)
-        return;
-
-    data = prepareWrite(service->writer, len);
+    data = prepareWrite(writer, len);
     if (!data)
         return;
 
     memcpy(data, heartbeat_message, len);
-    completeWrite(service->writer, data + len);
+    completeWrite(writer, data + len);
 }
 
 //
@@ -1016,22 +1403,27 @@ static void send_stratux_heartbeat(struct net_service *service)
 //
 // Write Wiffle output to TCP clients
 //
-static void modesSendWiffleOutput(struct modesMessage* mm, struct aircraft* a) {
+static void modesSendWiffleOutput(struct output_context* ctx, struct net_writer* writer) {
+   struct modesMessage* mm = ctx->mm;
+
+   if (!writerActive(writer))
+      return;
+
    // Don't ever forward mlat messages via raw output.
-   if (mm->source == SOURCE_MLAT)
+   if (ctx->mlat)
       return;
 
    // Filter some messages
    // Don't forward 2-bit-corrected messages
-   if (mm->correctedbits >= 2)
+   if (ctx->corrected2)
       return;
 
    // Don't forward unreliable messages
-   if ((a && !a->reliable) && !mm->reliable)
+   if (!ctx->reliable)
       return;
 
-   int msgLen = mm->msgbits / 8;
-   char* p = prepareWrite(&Modes.wiffle_out, msgLen * 2 + 15 + 100); // 100?
+   int msgLen = ctx->msgLen;
+   char* p = prepareWrite(writer, msgLen * 2 + 15 + 100); // 100?
    if (!p)
       return;
 
@@ -1061,16 +1453,14 @@ static void modesSendWiffleOutput(struct modesMessage* mm, struct aircraft* a) {
 
    if (Modes.mlat && mm->timestampMsg) {
       /* timestamp, big-endian */
-      sprintf(p, "@%012" PRIX64,
-         mm->timestampMsg);
+      memcpy(p, contextMlatTimestamp(ctx), 13);
       p += 13;
    }
    else if (mm->sysTimestampMsg) {
-      time_t epoch = mm->sysTimestampMsg / 1000.0;
       int milliseconds = mm->sysTimestampMsg % 1000;
-      struct tm* local_tm = gmtime(&epoch);
+      const struct tm* utc_tm = contextReceiveTime(ctx, true);
       char time_string[80];
-      strftime(time_string, sizeof(time_string), "%Y-%m-%dT%H:%M:%S", local_tm);
+      strftime(time_string, sizeof(time_string), "%Y-%m-%dT%H:%M:%S", utc_tm);
       sprintf(&time_string[strlen(time_string)], ".%03dZ", milliseconds);
       sprintf(p, "%s,%lu",
          time_string,
@@ -1091,35 +1481,62 @@ static void modesSendWiffleOutput(struct modesMessage* mm, struct aircraft* a) {
        aq,
        (int)mm->addrtype,
        mm->msgtype, 
-       10 * log10(mm->signalLevel) // RSSI
+       contextRSSI(ctx) // RSSI
       );
    *p++ = ',';
 
-   unsigned char* msg = mm->msg; // raw squitter
-   for (int j = 0; j < msgLen; j++) {
-      sprintf(p, "%02x", msg[j]);
-      p += 2;
-   }
+   memcpy(p, contextHex(ctx, false), msgLen * 2); // raw squitter
+   p += msgLen * 2;
 
    *p++ = '\n';
 
-   completeWrite(&Modes.wiffle_out, p);
+   completeWrite(writer, p);
 }
 
 //
 //=========================================================================
 //
+typedef void (*output_fn)(struct output_context *ctx, struct net_writer *writer);
+
+// Hand a message to each writer of a service whose filter it matches. Each
+// distinct filter is evaluated at most once per message.
+static void queueServiceOutput(struct output_context *ctx, struct net_writer *writer, output_fn send)
+{
+    if (!writer->service || !writer->service->connections)
+        return;
+
+    for (; writer; writer = writer->next) {
+        if (writer->connections && outputFilterMatch(writer->filter, ctx->mm, ctx->a, ctx->seq))
+            send(ctx, writer);
+    }
+}
+
 void modesQueueOutput(struct modesMessage *mm, struct aircraft *a) {
+    struct output_context ctx;
+    outputContextInit(&ctx, mm, a);
+
+    if (mm->decodeTime) {
+        output_latency.decoded = mm->decodeTime;
+        output_latency.queued = monotonic_us();
+        stats_add_latency(&Modes.stats_current, LATENCY_QUEUE, output_latency.queued - output_latency.decoded);
+    }
 
     // Delegate to the format-specific outputs, each of which makes its own decision about filtering messages
-    modesSendSBSOutput(mm, a);
-    modesSendStratuxOutput(mm, a);
-    modesSendRawOutput(mm, a);
-    modesSendBeastVerbatimOutput(mm);
-    modesSendBeastVerbatimLocalOutput(mm);
-    modesSendBeastCookedOutput(mm, a);
-    writeFATSVEvent(mm, a);
-    modesSendWiffleOutput(mm, a);
+    queueServiceOutput(&ctx, &Modes.sbs_out, modesSendSBSOutput);
+    queueServiceOutput(&ctx, &Modes.stratux_out, modesSendStratuxOutput);
+    queueServiceOutput(&ctx, &Modes.raw_out, modesSendRawOutput);
+    queueServiceOutput(&ctx, &Modes.beast_verbatim_out, modesSendBeastVerbatimOutput);
+    queueServiceOutput(&ctx, &Modes.beast_verbatim_local_out, modesSendBeastVerbatimLocalOutput);
+    queueServiceOutput(&ctx, &Modes.beast_cooked_out, modesSendBeastCookedOutput);
+    writeFATSVEvent(&ctx);
+
+    // The shared memory ring carries what a verbatim Beast connection would see
+    if (Modes.net_shm_ring && (!ctx.mlat || Modes.forward_mlat))
+        shmRingPublish(mm);
+
+    queueServiceOutput(&ctx, &Modes.wiffle_out, modesSendWiffleOutput);
+
+    output_latency.decoded = 0;
 }
 
 // Decode a little-endian IEEE754 float (binary32)
@@ -1211,27 +1628,37 @@ void sendBeastSettings(struct client *c, const char *settings)
     free(buf);
 }
 
-// Move a network client to a new service
-static void moveNetClient(struct client *c, struct net_service *new_service)
+// Move a network client to a new service and/or filter
+static void moveNetClient(struct client *c, struct net_service *new_service, struct output_filter *new_filter)
 {
-    if (c->service == new_service)
+    if (c->service == new_service && c->filter == new_filter)
         return;
 
     if (c->service) {
         // Flush to ensure correct message framing
-        if (c->service->writer)
-            flushWrites(c->service->writer);
+        if (c->writer) {
+            flushWrites(c->writer);
+            --c->writer->connections;
+        }
         --c->service->connections;
     }
 
+    struct net_writer *new_writer = NULL;
     if (new_service) {
         // Flush to ensure correct message framing
-        if (new_service->writer)
-            flushWrites(new_service->writer);
+        if ((new_writer = serviceWriter(new_service, new_filter))) {
+            flushWrites(new_writer);
+            ++new_writer->connections;
+        }
         ++new_service->connections;
     }
 
     c->service = new_service;
+    c->writer = new_writer;
+    if (c->filter != new_filter) {
+        outputFilterRelease(c->filter);
+        c->filter = outputFilterRetain(new_filter);
+    }
 }
 
 static int handleFaupCommand(struct client *c, char *p) {
@@ -1277,16 +1704,50 @@ static int handleFaupCommand(struct client *c, char *p) {
 // the currently requested options
 static void handleOptionsChange(struct client *c) {
     if (c->local_requested)
-        moveNetClient(c, Modes.beast_verbatim_local_service);
+        moveNetClient(c, Modes.beast_verbatim_local_service, c->filter);
     else if (c->verbatim_requested)
-        moveNetClient(c, Modes.beast_verbatim_service);
+        moveNetClient(c, Modes.beast_verbatim_service, c->filter);
     else
-        moveNetClient(c, Modes.beast_cooked_service);
+        moveNetClient(c, Modes.beast_cooked_service, c->filter);
+}
+
+// Replace a client's subscription filter with the one described by 'spec'.
+// A bad filter is reported and leaves the existing filter in place.
+static void setClientFilter(struct client *c, const char *spec)
+{
+    struct output_filter *filter;
+    char err[100];
+
+    if (!outputFilterParse(spec, &filter, err, sizeof(err))) {
+        fprintf(stderr, "%s: ignoring bad filter from client: %s\n", c->service->descr, err);
+        return;
+    }
+
+    moveNetClient(c, c->service, filter);
+    outputFilterRelease(filter);
+}
+
+//
+// Handle a line of text from a client of an ASCII output service. The only
+// command is "filter [terms...]", which sets the client's subscription
+// filter (see output_filter.h); "filter" alone removes it. Anything else is
+// ignored.
+//
+static int handleFilterCommand(struct client *c, char *line) {
+    while (isspace((unsigned char) *line))
+        ++line;
+
+    if (strncmp(line, "filter", 6) || (line[6] && !isspace((unsigned char) line[6])))
+        return 0;
+
+    setClientFilter(c, line + 6);
+    return 0;
 }
 
 //
 // Handle a Beast command message. Currently we support only j/J, l/L, v/V
-// and ignore other options
+// and F (subscription filter: <esc> '1' 'F' followed by NUL-terminated filter
+// text, see output_filter.h) and ignore other options
 //
 static int handleBeastCommand(struct client *c, char *p) {
     if (p[0] != '1') {
@@ -1319,11 +1780,58 @@ static int handleBeastCommand(struct client *c, char *p) {
         c->local_requested = 1;
         handleOptionsChange(c);
         break;
+    case 'F':
+        setClientFilter(c, p + 2);
+        break;
     }
 
     return 0;
 }
 
+//
+// Decode and use a message received from another receiver
+// (mm has the reception details filled in already). 'c' is the network
+// input connection it arrived on and 'input' the kind of input, or NULL
+// and -1 for a local source that is never checked for duplicates.
+//
+static void useRemoteMessage(struct client *c, struct modesMessage *mm, const unsigned char *msg, int msgLen, int input)
+{
+    if (msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
+        Modes.stats_current.remote_received_modeac++;
+        decodeModeAMessage(mm, ((msg[0] << 8) | msg[1]));
+    } else {
+        int result;
+
+        if (c)
+            c->remote_modes++;
+
+        if (input >= 0 && dedupCheck(msg, msgLen, mm->sysTimestampMsg, mm->signalLevel)) {
+            Modes.stats_current.remote_duplicates_seen[input]++;
+            c->duplicates_seen++;
+            if (!Modes.net_dedup_observe) {
+                Modes.stats_current.remote_duplicates_dropped[input]++;
+                c->duplicates_dropped++;
+                return;
+            }
+        }
+
+        Modes.stats_current.remote_received_modes++;
+        result = decodeModesMessage(mm, msg);
+        if (result < 0) {
+            if (result == -1)
+                Modes.stats_current.remote_rejected_unknown_icao++;
+            else
+                Modes.stats_current.remote_rejected_bad++;
+            return;
+        } else {
+            Modes.stats_current.remote_accepted[mm->correctedbits]++;
+        }
+    }
+
+    mm->decodeTime = monotonic_us();
+    dedupSetAircraft(useModesMessage(mm));
+}
+
 //
 //=========================================================================
 //
@@ -1344,7 +1852,6 @@ static int decodeBinMessage(struct client *c, char *p) {
     unsigned char msg[MODES_LONG_MSG_BYTES + 7];
     static struct modesMessage zeroMessage;
     struct modesMessage mm;
-    MODES_NOTUSED(c);
     memset(&mm, 0, sizeof(mm));
 
     ch = *p++; /// Get the message type
@@ -1402,28 +1909,52 @@ static int decodeBinMessage(struct client *c, char *p) {
             if (0x1A == ch) {p++;}
         }
 
-        if (msgLen == MODEAC_MSG_BYTES) { // ModeA or ModeC
-            Modes.stats_current.remote_received_modeac++;
-            decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
-        } else {
-            int result;
-
-            Modes.stats_current.remote_received_modes++;
-            result = decodeModesMessage(&mm, msg);
-            if (result < 0) {
-                if (result == -1)
-                    Modes.stats_current.remote_rejected_unknown_icao++;
-                else
-                    Modes.stats_current.remote_rejected_bad++;
-                return 0;
-            } else {
-                Modes.stats_current.remote_accepted[mm.correctedbits]++;
-            }
+        useRemoteMessage(c, &mm, msg, msgLen, REMOTE_INPUT_BEAST);
+    }
+    return (0);
+}
+
+//
+// Read messages from a shared memory ring. The records carry the same
+// information as a Beast verbatim frame, plus the full-precision signal level,
+// the reception time and the sender's score, so the message isn't re-scored.
+//
+int modesReadShmRing(struct shm_ring_reader *reader)
+{
+    static struct modesMessage zeroMessage;
+    struct shm_ring_record records[64];
+    int total = 0;
+
+    // Read what's available, up to a limit so that the caller's periodic work still happens
+    while (total < 1024) {
+        int count = shmRingRead(reader, records, sizeof(records) / sizeof(records[0]));
+        if (count < 0)
+            return (total > 0 ? total : -1);
+        if (count == 0)
+            break;
+
+        for (int i = 0; i < count; ++i) {
+            const struct shm_ring_record *rec = &records[i];
+            struct modesMessage mm = zeroMessage;
+
+            if (rec->length == MODEAC_MSG_BYTES && !Modes.mode_ac)
+                continue;
+            if (rec->length != MODEAC_MSG_BYTES && rec->length != MODES_SHORT_MSG_BYTES && rec->length != MODES_LONG_MSG_BYTES)
+                continue;
+
+            mm.remote = 1;
+            mm.timestampMsg = rec->timestamp;
+            mm.sysTimestampMsg = rec->sys_timestamp;
+            mm.signalLevel = rec->signal_level;
+            mm.score = rec->score;
+
+            useRemoteMessage(NULL, &mm, rec->msg, rec->length, -1);
         }
 
-        useModesMessage(&mm);
+        total += count;
     }
-    return (0);
+
+    return total;
 }
 //
 //=========================================================================
@@ -1487,7 +2018,6 @@ static int decodeHexMessage(struct client *c, char *hex) {
     struct modesMessage mm;
     static struct modesMessage zeroMessage;
 
-    MODES_NOTUSED(c);
     mm = zeroMessage;
 
     // Mark messages received over the internet as remote so that we don't try to
@@ -1574,26 +2104,7 @@ static int decodeHexMessage(struct client *c, char *hex) {
     // record reception time as the time we read it.
     mm.sysTimestampMsg = mstime();
 
-    if (l == (MODEAC_MSG_BYTES * 2)) {  // ModeA or ModeC
-        Modes.stats_current.remote_received_modeac++;
-        decodeModeAMessage(&mm, ((msg[0] << 8) | msg[1]));
-    } else {       // Assume ModeS
-        int result;
-
-        Modes.stats_current.remote_received_modes++;
-        result = decodeModesMessage(&mm, msg);
-        if (result < 0) {
-            if (result == -1)
-                Modes.stats_current.remote_rejected_unknown_icao++;
-            else
-                Modes.stats_current.remote_rejected_bad++;
-            return 0;
-        } else {
-            Modes.stats_current.remote_accepted[mm.correctedbits]++;
-        }
-    }
-
-    useModesMessage(&mm);
+    useRemoteMessage(c, &mm, msg, l / 2, REMOTE_INPUT_RAW);
     return (0);
 }
 
@@ -2019,6 +2530,19 @@ static char * appendStatsJson(char *p,
         p = safe_snprintf(p, end, ",\"strong_signals\":%u", st->strong_signal_count);
         if (st->sdr_gain >= 0)
             p = safe_snprintf(p, end, ",\"gain_db\":%.1f", sdrGetGainDb(st->sdr_gain));
+
+        if (Modes.num_inputs > 1) {
+            double seconds = (st->end - st->start) / 1000.0;
+            p = safe_snprintf(p, end, ",\"inputs\":[");
+            for (unsigned k = 0; k < Modes.num_inputs; ++k) {
+                p = safe_snprintf(p, end, "%s{\"samples_processed\":%llu,\"messages\":%u,\"message_rate\":%.1f}",
+                                  k ? "," : "",
+                                  (unsigned long long)st->input_samples_processed[k],
+                                  st->input_messages[k],
+                                  seconds > 0 ? st->input_messages[k] / seconds : 0.0);
+            }
+            p = safe_snprintf(p, end, "]");
+        }
         p = safe_snprintf(p, end, "}");
     }
 
@@ -2037,8 +2561,20 @@ static char * appendStatsJson(char *p,
             if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->remote_accepted[i]);
             else p = safe_snprintf(p, end, ",%u", st->remote_accepted[i]);
         }
+        p = safe_snprintf(p, end, "]");
+
+        if (Modes.net_dedup_window) {
+            static const char *inputs[REMOTE_INPUT_COUNT] = { "beast", "raw" };
+            p = safe_snprintf(p, end, ",\"duplicates\":{");
+            for (i = 0; i < REMOTE_INPUT_COUNT; ++i) {
+                p = safe_snprintf(p, end, "%s\"%s\":{\"seen\":%u,\"dropped\":%u}",
+                                  i ? "," : "", inputs[i],
+                                  st->remote_duplicates_seen[i], st->remote_duplicates_dropped[i]);
+            }
+            p = safe_snprintf(p, end, "}");
+        }
 
-        p = safe_snprintf(p, end, "]}");
+        p = safe_snprintf(p, end, "}");
     }
 
     uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
@@ -2124,6 +2660,28 @@ static char * appendStatsJson(char *p,
         }
         p = safe_snprintf(p, end, "]}");
     }
+
+    static const char *latency_names[LATENCY_STAGE_COUNT] = { "fifo", "demod", "queue", "flush", "network" };
+    p = safe_snprintf(p, end, ",\"latency\":{");
+    for (unsigned stage = 0; stage < LATENCY_STAGE_COUNT; ++stage) {
+        const uint32_t *histogram = st->latency_histogram[stage];
+        uint64_t count = 0;
+        for (unsigned i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+            count += histogram[i];
+
+        p = safe_snprintf(p, end, "%s\"%s\":{\"count\":%llu", stage ? "," : "", latency_names[stage], (unsigned long long)count);
+        if (count > 0) {
+            p = safe_snprintf(p, end, ",\"p50\":%llu,\"p90\":%llu,\"p99\":%llu",
+                              (unsigned long long)stats_latency_percentile(histogram, 50),
+                              (unsigned long long)stats_latency_percentile(histogram, 90),
+                              (unsigned long long)stats_latency_percentile(histogram, 99));
+        }
+        for (unsigned i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+            p = safe_snprintf(p, end, "%s%u", i ? "," : ",\"histogram\":[", histogram[i]);
+        p = safe_snprintf(p, end, "]}");
+    }
+    p = safe_snprintf(p, end, "}");
+
     p = safe_snprintf(p, end, "}");
     return p;
 }
@@ -2158,6 +2716,21 @@ char *generateStatsJson(const char *url_path, int *len) {
     p = safe_snprintf(p, end, ",\n");
 
     p = appendStatsJson(p, end, &Modes.stats_alltime, "total");
+
+    if (Modes.net_dedup_window) {
+        // Duplicates by connected Beast/raw input, since it connected
+        bool first = true;
+        p = safe_snprintf(p, end, ",\n\"feeds\":[");
+        for (struct client *c = Modes.clients; c; c = c->next) {
+            if (!c->service || (c->service->read_handler != decodeBinMessage && c->service->read_handler != decodeHexMessage))
+                continue;
+            p = safe_snprintf(p, end, "%s{\"service\":\"%s\",\"peer\":\"%s\",\"modes\":%" PRIu64 ",\"duplicates\":{\"seen\":%" PRIu64 ",\"dropped\":%" PRIu64 "}}",
+                              first ? "" : ",", c->service->descr, c->peer, c->remote_modes, c->duplicates_seen, c->duplicates_dropped);
+            first = false;
+        }
+        p = safe_snprintf(p, end, "]");
+    }
+
     p = safe_snprintf(p, end, "\n}\n");
 
     int used = p - buf;
@@ -2172,6 +2745,357 @@ char *generateStatsJson(const char *url_path, int *len) {
     return buf;
 }
 
+//
+//=========================================================================
+//
+// OpenMetrics (Prometheus) scrape endpoint
+//
+// Counters are cumulative since startup and come straight from the
+// in-memory stats (stats_alltime plus whatever hasn't been flushed to it
+// yet), so a scrape never waits for the once-a-minute stats rollover.
+//
+
+static char *appendMetricFamily(char *p, char *end, const char *name, const char *type, const char *help)
+{
+    return safe_snprintf(p, end, "# TYPE %s %s\n# HELP %s %s\n", name, type, name, help);
+}
+
+static char *appendCounter(char *p, char *end, const char *name, const char *help, uint64_t value)
+{
+    p = appendMetricFamily(p, end, name, "counter", help);
+    return safe_snprintf(p, end, "%s_total %llu\n", name, (unsigned long long) value);
+}
+
+static char *appendGauge(char *p, char *end, const char *name, const char *help, double value)
+{
+    p = appendMetricFamily(p, end, name, "gauge", help);
+    return safe_snprintf(p, end, "%s %.6g\n", name, value);
+}
+
+// A histogram from per-bucket counts; 'bounds' are the upper bounds of all
+// but the last bucket, which is +Inf. We don't track the sum of the observed
+// values, so there is no _sum (and, per OpenMetrics, no _count either; the
+// +Inf bucket has the count).
+static char *appendHistogram(char *p, char *end, const char *name, const char *labels,
+                             const uint32_t *counts, const double *bounds, unsigned nbuckets)
+{
+    uint64_t cumulative = 0;
+    for (unsigned i = 0; i < nbuckets; ++i) {
+        cumulative += counts[i];
+        if (i + 1 < nbuckets)
+            p = safe_snprintf(p, end, "%s_bucket{%s%sle=\"%.9g\"} %llu\n", name, labels, labels[0] ? "," : "", bounds[i], (unsigned long long) cumulative);
+        else
+            p = safe_snprintf(p, end, "%s_bucket{%s%sle=\"+Inf\"} %llu\n", name, labels, labels[0] ? "," : "", (unsigned long long) cumulative);
+    }
+    return p;
+}
+
+static char *appendMetrics(char *p, char *end)
+{
+    struct stats st;
+    add_stats(&Modes.stats_alltime, &Modes.stats_current, &st);
+
+    unsigned i;
+    char labels[128];
+
+    if (!Modes.net_only) {
+        p = appendCounter(p, end, "dump1090_samples_processed", "Samples processed by the demodulator", st.samples_processed);
+        p = appendCounter(p, end, "dump1090_samples_dropped", "Samples dropped before processing", st.samples_dropped);
+        if (Modes.num_inputs > 1) {
+            p = appendMetricFamily(p, end, "dump1090_input_samples_processed", "counter", "Samples processed by the demodulator, by input");
+            for (i = 0; i < Modes.num_inputs; ++i)
+                p = safe_snprintf(p, end, "dump1090_input_samples_processed_total{input=\"%u\"} %llu\n", i, (unsigned long long)st.input_samples_processed[i]);
+            p = appendMetricFamily(p, end, "dump1090_input_messages", "counter", "Messages accepted by the demodulator, by input");
+            for (i = 0; i < Modes.num_inputs; ++i)
+                p = safe_snprintf(p, end, "dump1090_input_messages_total{input=\"%u\"} %u\n", i, st.input_messages[i]);
+        }
+        p = appendCounter(p, end, "dump1090_demod_modeac", "Mode A/C messages decoded", st.demod_modeac);
+        p = appendCounter(p, end, "dump1090_demod_preambles", "Mode S preambles received", st.demod_preambles);
+        p = appendCounter(p, end, "dump1090_demod_rejected_bad", "Mode S preambles that didn't give a valid message", st.demod_rejected_bad);
+        p = appendCounter(p, end, "dump1090_demod_rejected_unknown_icao", "Mode S messages rejected for an unrecognized address", st.demod_rejected_unknown_icao);
+
+        p = appendMetricFamily(p, end, "dump1090_demod_accepted", "counter", "Mode S messages accepted, by number of bits corrected");
+        for (i = 0; i <= (unsigned) Modes.nfix_crc; ++i)
+            p = safe_snprintf(p, end, "dump1090_demod_accepted_total{corrected_bits=\"%u\"} %u\n", i, st.demod_accepted[i]);
+
+        p = appendMetricFamily(p, end, "dump1090_signal_power", "summary", "Signal power of received messages, fraction of full scale");
+        p = safe_snprintf(p, end, "dump1090_signal_power_sum %.6g\ndump1090_signal_power_count %llu\n",
+                          st.signal_power_sum, (unsigned long long) st.signal_power_count);
+        p = appendMetricFamily(p, end, "dump1090_noise_power", "summary", "Noise power of non-message samples, fraction of full scale");
+        p = safe_snprintf(p, end, "dump1090_noise_power_sum %.6g\ndump1090_noise_power_count %llu\n",
+                          st.noise_power_sum, (unsigned long long) st.noise_power_count);
+
+        // the all-time peak isn't very interesting; report the peak over the last one to two minutes
+        double peak = Modes.stats_1min[Modes.stats_newest_1min].peak_signal_power;
+        if (Modes.stats_latest.peak_signal_power > peak)
+            peak = Modes.stats_latest.peak_signal_power;
+        if (Modes.stats_current.peak_signal_power > peak)
+            peak = Modes.stats_current.peak_signal_power;
+        if (peak > 0)
+            p = appendGauge(p, end, "dump1090_peak_signal_dbfs", "Peak signal power of a received message over the last 1-2 minutes, dBFS", 10 * log10(peak));
+
+        p = appendCounter(p, end, "dump1090_strong_signals", "Messages received with a signal power above -3dBFS", st.strong_signal_count);
+
+        int gain = sdrGetGain();
+        if (gain >= 0)
+            p = appendGauge(p, end, "dump1090_gain_db", "Current SDR gain, dB", sdrGetGainDb(gain));
+
+        unsigned queued, total;
+        fifo_depth(&queued, &total);
+        p = appendGauge(p, end, "dump1090_fifo_queued_buffers", "Sample buffers waiting for the demodulator", queued);
+        p = appendGauge(p, end, "dump1090_fifo_buffers", "Sample buffers allocated", total);
+    }
+
+    if (Modes.net) {
+        p = appendCounter(p, end, "dump1090_remote_modeac", "Mode A/C messages received from the network", st.remote_received_modeac);
+        p = appendCounter(p, end, "dump1090_remote_modes", "Mode S messages received from the network", st.remote_received_modes);
+        p = appendCounter(p, end, "dump1090_remote_rejected_bad", "Network Mode S messages that were invalid", st.remote_rejected_bad);
+        p = appendCounter(p, end, "dump1090_remote_rejected_unknown_icao", "Network Mode S messages rejected for an unrecognized address", st.remote_rejected_unknown_icao);
+
+        p = appendMetricFamily(p, end, "dump1090_remote_accepted", "counter", "Network Mode S messages accepted, by number of bits corrected");
+        for (i = 0; i <= (unsigned) Modes.nfix_crc; ++i)
+            p = safe_snprintf(p, end, "dump1090_remote_accepted_total{corrected_bits=\"%u\"} %u\n", i, st.remote_accepted[i]);
+
+        if (Modes.net_dedup_window) {
+            static const char *inputs[REMOTE_INPUT_COUNT] = { "beast", "raw" };
+            p = appendMetricFamily(p, end, "dump1090_remote_duplicates_seen", "counter", "Network Mode S messages that duplicated a recent message, by input");
+            for (i = 0; i < REMOTE_INPUT_COUNT; ++i)
+                p = safe_snprintf(p, end, "dump1090_remote_duplicates_seen_total{input=\"%s\"} %u\n", inputs[i], st.remote_duplicates_seen[i]);
+            p = appendMetricFamily(p, end, "dump1090_remote_duplicates_dropped", "counter", "Duplicate network Mode S messages that were dropped, by input");
+            for (i = 0; i < REMOTE_INPUT_COUNT; ++i)
+                p = safe_snprintf(p, end, "dump1090_remote_duplicates_dropped_total{input=\"%s\"} %u\n", inputs[i], st.remote_duplicates_dropped[i]);
+        }
+    }
+
+    p = appendMetricFamily(p, end, "dump1090_cpu_seconds", "counter", "CPU time used, by area");
+    p = safe_snprintf(p, end, "dump1090_cpu_seconds_total{area=\"demod\"} %.3f\n", st.demod_cpu.tv_sec + st.demod_cpu.tv_nsec / 1e9);
+    p = safe_snprintf(p, end, "dump1090_cpu_seconds_total{area=\"reader\"} %.3f\n", st.reader_cpu.tv_sec + st.reader_cpu.tv_nsec / 1e9);
+    p = safe_snprintf(p, end, "dump1090_cpu_seconds_total{area=\"background\"} %.3f\n", st.background_cpu.tv_sec + st.background_cpu.tv_nsec / 1e9);
+
+    p = appendMetricFamily(p, end, "dump1090_cpr_messages", "counter", "CPR position messages received");
+    p = safe_snprintf(p, end, "dump1090_cpr_messages_total{type=\"surface\"} %u\n", st.cpr_surface);
+    p = safe_snprintf(p, end, "dump1090_cpr_messages_total{type=\"airborne\"} %u\n", st.cpr_airborne);
+
+    p = appendMetricFamily(p, end, "dump1090_cpr_global", "counter", "Global CPR decoding attempts, by result");
+    p = safe_snprintf(p, end, "dump1090_cpr_global_total{result=\"ok\"} %u\n", st.cpr_global_ok);
+    p = safe_snprintf(p, end, "dump1090_cpr_global_total{result=\"bad\"} %u\n", st.cpr_global_bad);
+    p = safe_snprintf(p, end, "dump1090_cpr_global_total{result=\"skipped\"} %u\n", st.cpr_global_skipped);
+    p = appendCounter(p, end, "dump1090_cpr_global_range_checks", "Global CPR positions rejected by the range check", st.cpr_global_range_checks);
+    p = appendCounter(p, end, "dump1090_cpr_global_speed_checks", "Global CPR positions rejected by the speed check", st.cpr_global_speed_checks);
+
+    p = appendMetricFamily(p, end, "dump1090_cpr_local", "counter", "Local CPR decoding attempts, by result");
+    p = safe_snprintf(p, end, "dump1090_cpr_local_total{result=\"aircraft_relative\"} %u\n", st.cpr_local_aircraft_relative);
+    p = safe_snprintf(p, end, "dump1090_cpr_local_total{result=\"receiver_relative\"} %u\n", st.cpr_local_receiver_relative);
+    p = safe_snprintf(p, end, "dump1090_cpr_local_total{result=\"skipped\"} %u\n", st.cpr_local_skipped);
+    p = appendCounter(p, end, "dump1090_cpr_local_range_checks", "Local CPR positions rejected by the range check", st.cpr_local_range_checks);
+    p = appendCounter(p, end, "dump1090_cpr_local_speed_checks", "Local CPR positions rejected by the speed check", st.cpr_local_speed_checks);
+    p = appendCounter(p, end, "dump1090_cpr_filtered", "CPR messages ignored as likely faulty transponder output", st.cpr_filtered);
+
+    p = appendCounter(p, end, "dump1090_altitude_suppressed", "Altitude messages ignored because of a recent DF17/18 altitude", st.suppressed_altitude_messages);
+
+    p = appendCounter(p, end, "dump1090_tracks", "Aircraft tracks created", st.unique_aircraft);
+    p = appendCounter(p, end, "dump1090_tracks_single_message", "Tracks with only a single message", st.single_message_aircraft);
+    p = appendCounter(p, end, "dump1090_tracks_unreliable", "Tracks that were never reliable", st.unreliable_aircraft);
+
+    p = appendCounter(p, end, "dump1090_messages", "Messages accepted from any source", st.messages_total);
+    p = appendMetricFamily(p, end, "dump1090_messages_by_df", "counter", "Messages accepted, by downlink format");
+    for (i = 0; i < 32; ++i) {
+        if (st.messages_by_df[i])
+            p = safe_snprintf(p, end, "dump1090_messages_by_df_total{df=\"%u\"} %u\n", i, st.messages_by_df[i]);
+    }
+
+    if (Modes.stats_range_histo && Modes.maxRange > 0) {
+        // positions are counted in the bucket nearest to their range (see update_range_histogram)
+        double bounds[RANGE_BUCKET_COUNT];
+        for (i = 0; i < RANGE_BUCKET_COUNT; ++i)
+            bounds[i] = (i + 0.5) * Modes.maxRange / RANGE_BUCKET_COUNT;
+        p = appendMetricFamily(p, end, "dump1090_position_range_meters", "histogram", "Range of decoded positions from the receiver, meters");
+        p = appendHistogram(p, end, "dump1090_position_range_meters", "", st.range_histogram, bounds, RANGE_BUCKET_COUNT);
+    }
+
+    if (st.adaptive_valid) {
+        p = appendGauge(p, end, "dump1090_adaptive_dynamic_range_limit_db", "Gain upper limit set by dynamic range control, dB", sdrGetGainDb(st.adaptive_range_gain_limit));
+        p = appendGauge(p, end, "dump1090_adaptive_noise_dbfs", "Adaptive gain noise floor estimate, dBFS", st.adaptive_noise_dbfs);
+        p = appendCounter(p, end, "dump1090_adaptive_gain_changes", "Gain changes made by adaptive gain control", st.adaptive_gain_changes);
+        p = appendCounter(p, end, "dump1090_adaptive_loud_undecoded", "Loud bursts that could not be decoded", st.adaptive_loud_undecoded);
+        p = appendCounter(p, end, "dump1090_adaptive_loud_decoded", "Loud messages that were decoded", st.adaptive_loud_decoded);
+
+        p = appendMetricFamily(p, end, "dump1090_adaptive_gain_seconds", "counter", "Time spent at each gain setting");
+        for (i = 0; i < STATS_GAIN_COUNT; ++i) {
+            if (st.adaptive_gain_seconds[i])
+                p = safe_snprintf(p, end, "dump1090_adaptive_gain_seconds_total{gain_db=\"%.1f\"} %u\n", sdrGetGainDb(i), st.adaptive_gain_seconds[i]);
+        }
+    }
+
+    {
+        static const char *stage_names[LATENCY_STAGE_COUNT] = { "fifo", "demod", "queue", "flush", "network" };
+        double bounds[LATENCY_BUCKET_COUNT];
+        for (i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+            bounds[i] = ldexp(1e-6, i);
+
+        p = appendMetricFamily(p, end, "dump1090_latency_seconds", "histogram", "Time spent in each stage of message processing");
+        for (unsigned stage = 0; stage < LATENCY_STAGE_COUNT; ++stage) {
+            snprintf(labels, sizeof(labels), "stage=\"%s\"", stage_names[stage]);
+            p = appendHistogram(p, end, "dump1090_latency_seconds", labels, st.latency_histogram[stage], bounds, LATENCY_BUCKET_COUNT);
+        }
+    }
+
+    p = appendMetricFamily(p, end, "dump1090_net_connections", "gauge", "Current network connections, by service");
+    for (struct net_service *s = Modes.services; s; s = s->next)
+        p = safe_snprintf(p, end, "dump1090_net_connections{service=\"%s\"} %d\n", s->descr, s->connections);
+    p = appendMetricFamily(p, end, "dump1090_net_accepted_connections", "counter", "Network connections made, by service");
+    for (struct net_service *s = Modes.services; s; s = s->next)
+        p = safe_snprintf(p, end, "dump1090_net_accepted_connections_total{service=\"%s\"} %llu\n", s->descr, (unsigned long long) s->connections_total);
+    p = appendMetricFamily(p, end, "dump1090_net_received_bytes", "counter", "Bytes received from network clients, by service");
+    for (struct net_service *s = Modes.services; s; s = s->next)
+        p = safe_snprintf(p, end, "dump1090_net_received_bytes_total{service=\"%s\"} %llu\n", s->descr, (unsigned long long) s->bytes_read);
+    p = appendMetricFamily(p, end, "dump1090_net_sent_bytes", "counter", "Bytes sent to network clients, by service");
+    for (struct net_service *s = Modes.services; s; s = s->next)
+        p = safe_snprintf(p, end, "dump1090_net_sent_bytes_total{service=\"%s\"} %llu\n", s->descr, (unsigned long long) s->bytes_written);
+
+    p = safe_snprintf(p, end, "# EOF\n");
+    return p;
+}
+
+static char *generateMetrics(int *len)
+{
+    int buflen = 32768;
+    char *buf, *p, *end;
+
+ retry:
+    if (!(buf = malloc(buflen))) {
+        // allocation failed, give up
+        *len = 0;
+        return NULL;
+    }
+
+    p = buf;
+    end = buf + buflen;
+    p = appendMetrics(p, end);
+
+    int used = p - buf;
+    if (p >= end) {
+        // overran the buffer
+        buflen = used + 50;
+        free(buf);
+        goto retry;
+    }
+
+    *len = used;
+    return buf;
+}
+
+// Write as much of a client's queued reply as the socket will take. Once the
+// whole reply has been sent (or the write fails), the connection is closed.
+static void flushClientReply(struct client *c)
+{
+    while (c->reply_sent < c->reply_len) {
+#ifndef _WIN32
+        int nwritten = write(c->fd, c->reply + c->reply_sent, c->reply_len - c->reply_sent);
+#else
+        int nwritten = send(c->fd, c->reply + c->reply_sent, c->reply_len - c->reply_sent, 0);
+        if (nwritten < 0) {errno = WSAGetLastError();}
+#endif
+        if (nwritten > 0) {
+            c->service->bytes_written += nwritten;
+            c->reply_sent += nwritten;
+            continue;
+        }
+
+#ifndef _WIN32
+        if (nwritten < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+#else
+        if (nwritten < 0 && errno == EWOULDBLOCK)
+#endif
+        {
+            // socket buffer is full, try again on the next pass
+            return;
+        }
+
+        break;
+    }
+
+    modesCloseClient(c);
+}
+
+// Queue a complete HTTP response to a client. A /metrics response can be
+// larger than the socket send buffer, so it is sent from modesNetPeriodicWork
+// as the client drains it, and the connection is closed once it has all gone.
+static void writeHttpResponse(struct client *c, const char *status, const char *content_type, const char *body, int body_len, bool send_body)
+{
+    char header[256];
+    int header_len = snprintf(header, sizeof(header),
+                              "HTTP/1.1 %s\r\n"
+                              "Content-Type: %s\r\n"
+                              "Content-Length: %d\r\n"
+                              "Cache-Control: no-cache\r\n"
+                              "Connection: close\r\n"
+                              "\r\n",
+                              status, content_type, body_len);
+
+    if (!send_body)
+        body_len = 0;
+
+    if (!(c->reply = malloc(header_len + body_len))) {
+        // nothing we can send; just drop the connection
+        c->reply_len = c->reply_sent = 0;
+        return;
+    }
+
+    memcpy(c->reply, header, header_len);
+    if (body_len)
+        memcpy(c->reply + header_len, body, body_len);
+    c->reply_len = header_len + body_len;
+    c->reply_sent = 0;
+}
+
+//
+// Handle an HTTP request on the metrics service. Only "GET /metrics" (or
+// HEAD) is served; the connection is closed once the response has been sent.
+// Returns 1 (close now) only if the response could not be queued.
+//
+static int handleMetricsRequest(struct client *c, char *request)
+{
+    // a response is already on its way; ignore anything else the client sends
+    if (c->reply)
+        return 0;
+
+    char method[16], path[256];
+    if (sscanf(request, "%15s %255s", method, path) != 2) {
+        static const char body[] = "Bad request\n";
+        writeHttpResponse(c, "400 Bad Request", "text/plain", body, sizeof(body) - 1, true);
+        return !c->reply;
+    }
+
+    bool head = !strcmp(method, "HEAD");
+    if (!head && strcmp(method, "GET")) {
+        static const char body[] = "Method not allowed\n";
+        writeHttpResponse(c, "405 Method Not Allowed", "text/plain", body, sizeof(body) - 1, true);
+        return !c->reply;
+    }
+
+    char *query = strchr(path, '?');
+    if (query)
+        *query = 0;
+
+    if (strcmp(path, "/metrics")) {
+        static const char body[] = "Not found\n";
+        writeHttpResponse(c, "404 Not Found", "text/plain", body, sizeof(body) - 1, !head);
+        return !c->reply;
+    }
+
+    int len;
+    char *body = generateMetrics(&len);
+    if (!body) {
+        writeHttpResponse(c, "500 Internal Server Error", "text/plain", NULL, 0, false);
+        return !c->reply;
+    }
+
+    writeHttpResponse(c, "200 OK", "application/openmetrics-text; version=1.0.0; charset=utf-8", body, len, !head);
+    free(body);
+    return !c->reply;
+}
+
 //
 // Return a description of the receiver in json.
 //
@@ -2336,6 +3260,10 @@ static void modesReadFromClient(struct client *c) {
     int bContinue = 1;
 
     while (bContinue) {
+        // Stop reading while a reply is being sent; the connection closes after it
+        if (c->reply)
+            return;
+
         left = MODES_CLIENT_BUF_SIZE - c->buflen - 1; // leave 1 extra byte for NUL termination in the ASCII case
 
         // If our buffer is full discard it, this is some badly formatted shit
@@ -2344,12 +3272,16 @@ static void modesReadFromClient(struct client *c) {
             left = MODES_CLIENT_BUF_SIZE;
             // If there is garbage, read more to discard it ASAP
         }
+        if (c->blocks) {
+            nread = blockReaderRead(c->blocks, c->fd, c->buf+c->buflen, left);
+        } else {
 #ifndef _WIN32
-        nread = read(c->fd, c->buf+c->buflen, left);
+            nread = read(c->fd, c->buf+c->buflen, left);
 #else
-        nread = recv(c->fd, c->buf+c->buflen, left, 0);
-        if (nread < 0) {errno = WSAGetLastError();}
+            nread = recv(c->fd, c->buf+c->buflen, left, 0);
+            if (nread < 0) {errno = WSAGetLastError();}
 #endif
+        }
 
         // If we didn't get all the data we asked for, then return once we've processed what we did get.
         if (nread != left) {
@@ -2376,6 +3308,7 @@ static void modesReadFromClient(struct client *c) {
         }
 
         c->buflen += nread;
+        c->service->bytes_read += nread;
 
         char *som = c->buf;           // first byte of next message
         char *eod = som + c->buflen;  // one byte past end of data
@@ -2453,7 +3386,15 @@ static void modesReadFromClient(struct client *c) {
                     break;
                 }
 
-                if (*p == '1') {
+                if (*p == '1' && p + 1 < eod && p[1] == 'F') {
+                    // Filter command, NUL-terminated text follows
+                    char *nul = memchr(p + 2, 0, eod - (p + 2));
+                    if (!nul) {
+                        // Incomplete message in buffer, retry later
+                        break;
+                    }
+                    eom = nul + 1;
+                } else if (*p == '1') {
                     eom = p + 2;
                 } else {
                     // Not a valid beast command, skip 0x1a and try again
@@ -2592,15 +3533,18 @@ static void writeFATSVEventMessage(struct modesMessage *mm, const char *datafiel
 #       undef bufsize
 }
 
-static void writeFATSVEvent(struct modesMessage *mm, struct aircraft *a)
+static void writeFATSVEvent(struct output_context *ctx)
 {
+    struct modesMessage *mm = ctx->mm;
+    struct aircraft *a = ctx->a;
+
     // Write event records for a couple of message types.
 
-    if (!Modes.fatsv_out.service || !Modes.fatsv_out.service->connections) {
+    if (!writerActive(&Modes.fatsv_out)) {
         return; // not enabled or no active connections
     }
 
-    if (!a || mm->source == SOURCE_MLAT || (!a->reliable && !mm->reliable))
+    if (!a || ctx->mlat || !ctx->reliable)
         return;
 
     switch (mm->msgtype) {
@@ -3007,6 +3951,12 @@ void modesNetPeriodicWork(void) {
             modesReadFromClient(c);
     }
 
+    // Send queued replies
+    for (c = Modes.clients; c; c = c->next) {
+        if (c->service && c->reply)
+            flushClientReply(c);
+    }
+
     // Generate FATSV output
     writeFATSV();
 
@@ -3014,23 +3964,30 @@ void modesNetPeriodicWork(void) {
     // a heartbeat
     if (Modes.net_heartbeat_interval) {
         for (s = Modes.services; s; s = s->next) {
-            if (s->writer &&
-                s->connections &&
-                s->writer->send_heartbeat &&
-                (s->writer->lastWrite + Modes.net_heartbeat_interval) <= now) {
-                s->writer->send_heartbeat(s);
+            for (struct net_writer *w = s->writer; w; w = w->next) {
+                if (w->connections &&
+                    w->send_heartbeat &&
+                    (w->lastWrite + Modes.net_heartbeat_interval) <= now) {
+                    w->send_heartbeat(w);
+                }
             }
         }
     }
 
+    shmRingHeartbeat();
+    netConnectorPeriodicWork(now);
+
     // If we have data that has been waiting to be written for a while,
     // write it now.
     for (s = Modes.services; s; s = s->next) {
-        if (s->writer &&
-            s->writer->dataUsed &&
-            (need_flush || (s->writer->lastWrite + Modes.net_output_flush_interval) <= now)) {
-            flushWrites(s->writer);
+        for (struct net_writer *w = s->writer; w; w = w->next) {
+            if (w->dataUsed &&
+                (need_flush || (w->lastWrite + Modes.net_output_flush_interval) <= now)) {
+                flushWrites(w);
+            }
         }
+
+        pruneServiceWriters(s);
     }
 
     // Unlink and free closed clients
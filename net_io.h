@@ -26,8 +26,12 @@ struct aircraft;
 struct modesMessage;
 struct client;
 struct net_service;
+struct net_writer;
+struct output_filter;
+struct block_reader;
+struct net_udp;
 typedef int (*read_fn)(struct client *, char *);
-typedef void (*heartbeat_fn)(struct net_service *);
+typedef void (*heartbeat_fn)(struct net_writer *);
 
 typedef enum {
     READ_MODE_IGNORE,
@@ -45,11 +49,17 @@ struct net_service {
 
     int connections;     // number of active clients
 
-    struct net_writer *writer; // shared writer state
+    uint64_t connections_total; // number of clients ever created for this service
+    uint64_t bytes_read;        // bytes received from clients
+    uint64_t bytes_written;     // bytes sent to clients
+
+    struct net_writer *writer; // shared writer state; further writers for
+                               // filtered clients are chained from writer->next
 
     const char *read_sep;      // hander details for input data
     read_mode_t read_mode;
     read_fn read_handler;
+    bool read_compressed;      // input arrives as net_connector compressed blocks
 };
 
 // Structure used to describe a networking client
@@ -57,20 +67,45 @@ struct client {
     struct client*  next;                // Pointer to next client
     int    fd;                           // File descriptor
     struct net_service *service;         // Service this client is part of
+    struct net_writer *writer;           // Writer this client receives from (service writer matching its filter)
+    struct output_filter *filter;        // Subscription filter, or NULL for everything
+    struct block_reader *blocks;         // Decompressor for compressed input, or NULL
     int    buflen;                       // Amount of data on buffer
     char   buf[MODES_CLIENT_BUF_SIZE+1]; // Read buffer
+    char  *reply;                        // Queued reply still being sent (HTTP responses), or NULL
+    int    reply_len;                    // Length of reply
+    int    reply_sent;                   // Bytes of reply written so far
     int    modeac_requested;             // 1 if this Beast output connection has asked for A/C
     int    verbatim_requested;           // 1 if this Beast output connection has asked for verbatim mode
     int    local_requested;              // 1 if this Beast output connection has asked for local-only mode
+    char   peer[64];                     // Remote address as host:port, or empty if not a network socket
+    uint64_t remote_modes;               // Mode S messages received from this input connection
+    uint64_t duplicates_seen;            // .. that matched a recent message (--net-dedup)
+    uint64_t duplicates_dropped;         // .. and were discarded
+};
+
+// Pipeline timestamps of a message held in a writer's buffer
+struct writer_latency {
+    uint64_t decoded;            // monotonic_us() when the message was decoded
+    uint64_t queued;             // monotonic_us() when the message was queued to the writers
 };
 
-// Common writer state for all output sockets of one type
+// Messages per writer buffer whose latency is tracked; the rest go unmeasured
+#define WRITER_LATENCY_SLOTS 128
+
+// Common writer state for all output sockets of one type with the same filter
 struct net_writer {
+    struct net_writer *next;     // next writer of the same service (with a different filter)
     struct net_service *service; // owning service
+    struct output_filter *filter; // filter applied to this writer's output, or NULL
+    int connections;             // number of clients using this writer
     void *data;          // shared write buffer, sized MODES_OUT_BUF_SIZE
     int dataUsed;        // number of bytes of write buffer currently used
     uint64_t lastWrite;  // time of last write to clients
     heartbeat_fn send_heartbeat; // function that queues a heartbeat if needed
+    unsigned pendingCount;       // number of messages in pending[]
+    struct writer_latency pending[WRITER_LATENCY_SLOTS]; // messages in the buffer, oldest first
+    struct net_udp *udp;         // UDP outputs fed from this writer, or NULL
 };
 
 struct net_service *serviceInit(const char *descr, struct net_writer *writer, heartbeat_fn hb_handler, read_mode_t mode, const char *sep, read_fn read_handler);
@@ -86,6 +121,18 @@ struct net_service *makeFaCmdInputService(void);
 
 void sendBeastSettings(struct client *c, const char *settings);
 
+// Output formats that can be sent by --net-connector and --net-udp: beast,
+// beast_verbatim, beast_local, raw, sbs, stratux, wiffle. netOutputFormat
+// returns the canonical (static) name, or NULL if the name is unknown;
+// netOutputWriter returns the writer producing that format.
+const char *netOutputFormat(const char *name);
+struct net_writer *netOutputWriter(const char *format);
+
+// Decode and use new messages from a shared memory ring. Returns the number
+// of messages read, or -1 if the producer has gone away.
+struct shm_ring_reader;
+int modesReadShmRing(struct shm_ring_reader *reader);
+
 void modesInitNet(void);
 void modesQueueOutput(struct modesMessage *mm, struct aircraft *a);
 void modesNetPeriodicWork(void);
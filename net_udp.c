@@ -0,0 +1,322 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// net_udp.c: UDP (multicast / broadcast) output
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netdb.h>
+
+struct net_udp {
+    struct net_udp *next;          // all UDP outputs
+    struct net_udp *writer_next;   // next output fed by the same writer
+    char *address;
+    char *port;
+    const char *format;
+    struct net_writer *writer;
+
+    int ttl;                       // multicast TTL / hop limit, or -1 for the default
+    char *iface;                   // outgoing multicast interface, or NULL
+    unsigned mtu;
+
+    int fd;
+    struct sockaddr_storage dest;
+    socklen_t dest_len;
+
+    unsigned char *datagram;       // header + pending messages
+    size_t len;                    // bytes of datagram[] in use
+    size_t max;                    // largest datagram that fits the MTU
+    uint32_t seq;                  // sequence number of the pending datagram
+
+    uint64_t datagrams;            // datagrams sent
+    uint64_t dropped;              // datagrams that could not be sent
+};
+
+static struct net_udp *outputs;
+
+static char formatCode(const char *format)
+{
+    if (!strncmp(format, "beast", 5))
+        return 'B';
+    if (!strcmp(format, "raw"))
+        return 'R';
+    if (!strcmp(format, "sbs"))
+        return 'S';
+    if (!strcmp(format, "stratux"))
+        return 'X';
+    return 'W';
+}
+
+static void freeOutput(struct net_udp *u)
+{
+    if (!u)
+        return;
+    if (u->fd >= 0)
+        close(u->fd);
+    free(u->datagram);
+    free(u->address);
+    free(u->port);
+    free(u->iface);
+    free(u);
+}
+
+bool netUdpAdd(const char *spec)
+{
+    struct net_udp *u = NULL;
+    char *copy = NULL;
+    bool ok = false;
+
+    if (!(u = calloc(1, sizeof(*u))) || !(copy = strdup(spec))) {
+        fprintf(stderr, "--net-udp: out of memory\n");
+        goto done;
+    }
+
+    u->fd = -1;
+    u->ttl = -1;
+    u->mtu = NET_UDP_DEFAULT_MTU;
+
+    char *saveptr = NULL;
+    char *address = strtok_r(copy, ",", &saveptr);
+    char *port = strtok_r(NULL, ",", &saveptr);
+    char *format = strtok_r(NULL, ",", &saveptr);
+    if (!address || !port || !format) {
+        fprintf(stderr, "--net-udp: expected address,port,format[,options], got '%s'\n", spec);
+        goto done;
+    }
+
+    if (!(u->format = netOutputFormat(format))) {
+        fprintf(stderr, "--net-udp: unknown output format '%s'\n", format);
+        goto done;
+    }
+
+    for (char *opt = strtok_r(NULL, ",", &saveptr); opt; opt = strtok_r(NULL, ",", &saveptr)) {
+        char *end;
+        if (!strncmp(opt, "ttl=", 4)) {
+            unsigned long ttl = strtoul(opt + 4, &end, 10);
+            if (end == opt + 4 || *end || ttl > 255) {
+                fprintf(stderr, "--net-udp: bad TTL '%s'\n", opt + 4);
+                goto done;
+            }
+            u->ttl = ttl;
+        } else if (!strncmp(opt, "mtu=", 4)) {
+            unsigned long mtu = strtoul(opt + 4, &end, 10);
+            if (end == opt + 4 || *end || mtu < 576 || mtu > 65535) {
+                fprintf(stderr, "--net-udp: bad MTU '%s' (576..65535)\n", opt + 4);
+                goto done;
+            }
+            u->mtu = mtu;
+        } else if (!strncmp(opt, "iface=", 6) && opt[6]) {
+            free(u->iface);
+            if (!(u->iface = strdup(opt + 6))) {
+                fprintf(stderr, "--net-udp: out of memory\n");
+                goto done;
+            }
+        } else {
+            fprintf(stderr, "--net-udp: unknown option '%s'\n", opt);
+            goto done;
+        }
+    }
+
+    if (!(u->address = strdup(address)) || !(u->port = strdup(port))) {
+        fprintf(stderr, "--net-udp: out of memory\n");
+        goto done;
+    }
+
+    // keep the outputs in command-line order
+    struct net_udp **tail = &outputs;
+    while (*tail)
+        tail = &(*tail)->next;
+    *tail = u;
+    u = NULL;
+    ok = true;
+
+ done:
+    free(copy);
+    freeOutput(u);
+    return ok;
+}
+
+static bool openOutput(struct net_udp *u)
+{
+    struct addrinfo hints, *result;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    int gai_error = getaddrinfo(u->address, u->port, &hints, &result);
+    if (gai_error) {
+        fprintf(stderr, "--net-udp: can't resolve %s: %s\n", u->address, gai_strerror(gai_error));
+        return false;
+    }
+
+    memcpy(&u->dest, result->ai_addr, result->ai_addrlen);
+    u->dest_len = result->ai_addrlen;
+    int family = result->ai_family;
+    freeaddrinfo(result);
+
+    if ((u->fd = socket(family, SOCK_DGRAM, 0)) < 0) {
+        fprintf(stderr, "--net-udp %s: can't create socket: %s\n", u->address, strerror(errno));
+        return false;
+    }
+
+    anetNonBlock(Modes.aneterr, u->fd);
+    anetSetSendBuffer(Modes.aneterr, u->fd, (MODES_NET_SNDBUF_SIZE << Modes.net_sndbuf_size));
+
+    int rc = 0;
+    if (family == AF_INET) {
+        int on = 1;
+        rc = setsockopt(u->fd, SOL_SOCKET, SO_BROADCAST, (void *) &on, sizeof(on));
+        if (!rc && u->ttl >= 0) {
+            unsigned char ttl = u->ttl;
+            rc = setsockopt(u->fd, IPPROTO_IP, IP_MULTICAST_TTL, (void *) &ttl, sizeof(ttl));
+        }
+        if (!rc && u->iface) {
+            struct in_addr iface;
+            if (inet_pton(AF_INET, u->iface, &iface) != 1) {
+                fprintf(stderr, "--net-udp %s: iface must be a local IPv4 address\n", u->address);
+                return false;
+            }
+            rc = setsockopt(u->fd, IPPROTO_IP, IP_MULTICAST_IF, (void *) &iface, sizeof(iface));
+        }
+        u->max = u->mtu - 20 - 8;
+    } else {
+        if (u->ttl >= 0) {
+            int hops = u->ttl;
+            rc = setsockopt(u->fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, (void *) &hops, sizeof(hops));
+        }
+        if (!rc && u->iface) {
+            unsigned index = if_nametoindex(u->iface);
+            if (!index) {
+                fprintf(stderr, "--net-udp %s: unknown interface %s\n", u->address, u->iface);
+                return false;
+            }
+            rc = setsockopt(u->fd, IPPROTO_IPV6, IPV6_MULTICAST_IF, (void *) &index, sizeof(index));
+        }
+        u->max = u->mtu - 40 - 8;
+    }
+
+    if (rc < 0) {
+        fprintf(stderr, "--net-udp %s: can't set socket options: %s\n", u->address, strerror(errno));
+        return false;
+    }
+
+    if (!(u->datagram = malloc(u->max))) {
+        fprintf(stderr, "--net-udp: out of memory\n");
+        return false;
+    }
+
+    u->datagram[0] = 'M';
+    u->datagram[1] = 'U';
+    u->datagram[2] = NET_UDP_VERSION;
+    u->datagram[3] = formatCode(u->format);
+    u->len = NET_UDP_HEADER;
+    return true;
+}
+
+bool netUdpStart(void)
+{
+    for (struct net_udp *u = outputs; u; u = u->next) {
+        if (!openOutput(u))
+            return false;
+
+        // Like a TCP client, keep the writer (and its service) producing output
+        u->writer = netOutputWriter(u->format);
+        ++u->writer->connections;
+        ++u->writer->service->connections;
+
+        struct net_udp **tail = &u->writer->udp;
+        while (*tail)
+            tail = &(*tail)->writer_next;
+        *tail = u;
+    }
+
+    return true;
+}
+
+static void sendDatagram(struct net_udp *u)
+{
+    if (u->len <= NET_UDP_HEADER)
+        return;
+
+    u->datagram[4] = u->seq >> 24;
+    u->datagram[5] = u->seq >> 16;
+    u->datagram[6] = u->seq >> 8;
+    u->datagram[7] = u->seq;
+    ++u->seq;
+
+    ssize_t sent = sendto(u->fd, (void *) u->datagram, u->len, 0, (struct sockaddr *) &u->dest, u->dest_len);
+    if (sent < 0) {
+        // socket buffer full or the network is unreachable; receivers see the gap
+        if (!u->dropped++)
+            fprintf(stderr, "net udp %s:%s: send failed: %s\n", u->address, u->port, strerror(errno));
+    } else {
+        ++u->datagrams;
+        u->writer->service->bytes_written += sent;
+    }
+
+    u->len = NET_UDP_HEADER;
+}
+
+void netUdpQueue(struct net_udp *list, const void *data, size_t len)
+{
+    for (struct net_udp *u = list; u; u = u->writer_next) {
+        if (u->len + len > u->max)
+            sendDatagram(u);
+
+        if (NET_UDP_HEADER + len > u->max) {
+            // a message that can never fit; can't happen with the standard formats
+            ++u->seq;
+            ++u->dropped;
+            continue;
+        }
+
+        memcpy(u->datagram + u->len, data, len);
+        u->len += len;
+    }
+}
+
+void netUdpFlush(struct net_udp *list)
+{
+    for (struct net_udp *u = list; u; u = u->writer_next)
+        sendDatagram(u);
+}
+
+void netUdpCleanup(void)
+{
+    while (outputs) {
+        struct net_udp *u = outputs;
+        outputs = u->next;
+
+        if (u->writer) {
+            sendDatagram(u);
+            fprintf(stderr, "net udp %s:%s: %" PRIu64 " datagrams sent, %" PRIu64 " dropped\n",
+                    u->address, u->port, u->datagrams, u->dropped);
+
+            struct net_udp **prev = &u->writer->udp;
+            while (*prev != u)
+                prev = &(*prev)->writer_next;
+            *prev = u->writer_next;
+
+            --u->writer->connections;
+            --u->writer->service->connections;
+        }
+
+        freeOutput(u);
+    }
+}
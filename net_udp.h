@@ -0,0 +1,67 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// net_udp.h: UDP (multicast / broadcast) output
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_NET_UDP_H
+#define DUMP1090_NET_UDP_H
+
+// --net-udp <address>,<port>,<format>[,ttl=<n>][,mtu=<bytes>][,iface=<if>]
+// sends one of the output formats (as for --net-connector) to a UDP address,
+// usually a multicast group or a broadcast address, so that a single send
+// reaches every consumer on the network. 'iface' selects the outgoing
+// interface for multicast: a local address for IPv4, an interface name for
+// IPv6.
+//
+// Each datagram holds one or more whole messages, packed up to the MTU, and
+// is sent when the next message would not fit or when the output would
+// otherwise be flushed (--net-ro-size / --net-ro-interval). Every datagram
+// starts with a header:
+//
+//   offset 0:  'M', 'U'
+//   offset 2:  NET_UDP_VERSION
+//   offset 3:  format: 'B' Beast, 'R' raw, 'S' SBS, 'X' Stratux, 'W' Wiffle
+//   offset 4:  sequence number, 32 bits big-endian, +1 per datagram
+//
+// followed by the messages exactly as a TCP client would receive them.
+// Datagrams that could not be sent still use up a sequence number, so a gap
+// in the sequence always means lost data. The sequence starts again from 0
+// when dump1090 restarts.
+
+#define NET_UDP_VERSION 1
+#define NET_UDP_HEADER 8
+#define NET_UDP_DEFAULT_MTU 1500
+
+struct net_writer;
+struct net_udp;
+
+// Parse a --net-udp specification and add the output. Returns false, with a
+// message on stderr, if the specification is invalid.
+bool netUdpAdd(const char *spec);
+
+// Open the sockets and attach the outputs to their writers. Returns false,
+// with a message on stderr, on failure.
+bool netUdpStart(void);
+
+// Add one complete message from a writer to the pending datagram of each
+// output in the list (writer->udp)
+void netUdpQueue(struct net_udp *list, const void *data, size_t len);
+
+// Send the pending datagrams of each output in the list
+void netUdpFlush(struct net_udp *list);
+
+void netUdpCleanup(void);
+
+#endif
@@ -0,0 +1,683 @@
+/* records Beast streams with a timing index, and replays them over several
+ * TCP connections as a load generator for dump1090's Beast input
+ *
+ *   beast_replay record [-t seconds] [-v] host:port capture.beast
+ *
+ *     Connects to a Beast output (e.g. dump1090 --net-bo-port) and writes the
+ *     frames it receives to capture.beast, plus a timing index to
+ *     capture.beast.idx. -v asks dump1090 for verbatim (uncorrected) output.
+ *
+ *   beast_replay replay [-c connections] [-s speed | -f] [-n loops] [-m host:port] capture.beast host:port
+ *
+ *     Opens 'connections' connections to a Beast input (e.g. dump1090
+ *     --net-bi-port) and sends the whole capture down each of them, paced
+ *     to the original arrival times divided by 'speed', or as fast as the
+ *     receiver will take it with -f. -m also connects to a Beast output and
+ *     counts the messages that come back out.
+ *
+ * The capture itself is a plain Beast byte stream (any Beast tool can read
+ * it). The index is a header followed by one entry per batch of frames that
+ * arrived together:
+ *
+ *   header: "BEASTIDX", uint32 version (1), uint32 entry size (24)
+ *   entry:  uint64 offset of the batch in the capture
+ *           uint64 arrival time, microseconds since the start of the capture
+ *           uint32 number of frames in the batch
+ *           uint32 reserved
+ *
+ * all in host byte order. Replaying a capture without an index paces it using
+ * the 12MHz timestamps in the frames instead.
+ *
+ * Once a second, replay reports the messages sent per second and the lag: how
+ * far the slowest connection is behind the schedule, which grows when the
+ * receiver can't keep up and pushes back on the TCP connections.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#define INDEX_MAGIC "BEASTIDX"
+#define INDEX_VERSION 1
+
+struct index_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_size;
+};
+
+struct index_entry {
+    uint64_t offset;
+    uint64_t time_us;
+    uint32_t messages;
+    uint32_t reserved;
+};
+
+static volatile sig_atomic_t exiting;
+
+static void sigintHandler(int sig)
+{
+    (void) sig;
+    exiting = 1;
+}
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Length of the complete frame at buf (buf[0] == 0x1a), including escapes;
+// 0 if more data is needed; -1 if this isn't a valid frame.
+// On success, stores the frame's 12MHz timestamp in *timestamp if not NULL.
+static int frameLength(const uint8_t *buf, size_t len, uint64_t *timestamp)
+{
+    if (len < 2)
+        return 0;
+
+    unsigned payload;
+    switch (buf[1]) {
+    case '1': payload = 2; break;
+    case '2': payload = 7; break;
+    case '3': case '4': case '5': payload = 14; break;
+    default: return -1;
+    }
+
+    unsigned need = 6 + 1 + payload;   // timestamp, signal, message
+    uint64_t ts = 0;
+    size_t i = 2;
+    for (unsigned n = 0; n < need; ++n) {
+        if (i >= len)
+            return 0;
+        if (buf[i] == 0x1a) {
+            if (i + 1 >= len)
+                return 0;
+            if (buf[i + 1] != 0x1a)
+                return -1;   // unescaped 0x1a: start of another frame
+            ++i;
+        }
+        if (n < 6)
+            ts = (ts << 8) | buf[i];
+        ++i;
+    }
+
+    if (timestamp)
+        *timestamp = ts;
+    return i;
+}
+
+// Find complete frames in buf[0..len). Returns the number of bytes consumed
+// (garbage and complete frames); complete frames are appended to 'out' if it
+// is not NULL. Stores the number of frames found in *frames.
+static size_t scanFrames(const uint8_t *buf, size_t len, FILE *out, unsigned *frames)
+{
+    size_t pos = 0;
+    *frames = 0;
+
+    while (pos < len) {
+        const uint8_t *p = memchr(buf + pos, 0x1a, len - pos);
+        if (!p)
+            return len;   // all garbage
+        pos = p - buf;
+
+        int flen = frameLength(buf + pos, len - pos, NULL);
+        if (flen == 0)
+            break;        // incomplete, wait for more
+        if (flen < 0) {
+            ++pos;        // resync
+            continue;
+        }
+
+        if (out)
+            fwrite(buf + pos, 1, flen, out);
+        ++*frames;
+        pos += flen;
+    }
+
+    return pos;
+}
+
+static int connectTo(const char *hostport)
+{
+    char host[256];
+    const char *colon = strrchr(hostport, ':');
+    if (!colon || colon == hostport || (size_t) (colon - hostport) >= sizeof(host)) {
+        fprintf(stderr, "%s: expected host:port\n", hostport);
+        return -1;
+    }
+    memcpy(host, hostport, colon - hostport);
+    host[colon - hostport] = 0;
+
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    int err = getaddrinfo(host, colon + 1, &hints, &res);
+    if (err) {
+        fprintf(stderr, "%s: %s\n", hostport, gai_strerror(err));
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai; ai = ai->ai_next) {
+        if ((fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol)) < 0)
+            continue;
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+            break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+
+    if (fd < 0)
+        fprintf(stderr, "%s: can't connect: %s\n", hostport, strerror(errno));
+    return fd;
+}
+
+static char *indexFilename(const char *capture)
+{
+    char *name = malloc(strlen(capture) + 5);
+    if (name)
+        sprintf(name, "%s.idx", capture);
+    return name;
+}
+
+//
+// Recording
+//
+
+static int record(int argc, char **argv)
+{
+    double duration = 0;
+    bool verbatim = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:v")) != -1) {
+        switch (opt) {
+        case 't': duration = atof(optarg); break;
+        case 'v': verbatim = true; break;
+        default: return 2;
+        }
+    }
+
+    if (argc - optind != 2) {
+        fprintf(stderr, "usage: beast_replay record [-t seconds] [-v] host:port capture.beast\n");
+        return 2;
+    }
+
+    const char *source = argv[optind];
+    const char *capture = argv[optind + 1];
+    char *idxname = indexFilename(capture);
+
+    FILE *out = fopen(capture, "wb");
+    FILE *idx = idxname ? fopen(idxname, "wb") : NULL;
+    if (!out || !idx) {
+        fprintf(stderr, "can't create %s / %s: %s\n", capture, idxname ? idxname : "index", strerror(errno));
+        return 1;
+    }
+
+    struct index_header header;
+    memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    header.version = INDEX_VERSION;
+    header.entry_size = sizeof(struct index_entry);
+    fwrite(&header, sizeof(header), 1, idx);
+
+    int fd = connectTo(source);
+    if (fd < 0)
+        return 1;
+
+    if (verbatim) {
+        static const char cmd[] = { 0x1a, '1', 'V' };
+        if (write(fd, cmd, sizeof(cmd)) != sizeof(cmd))
+            fprintf(stderr, "warning: failed to request verbatim mode\n");
+    }
+
+    static uint8_t buf[65536];
+    size_t buflen = 0;
+    uint64_t offset = 0, total_frames = 0;
+    uint64_t start = now_us(), last_report = start, report_frames = 0;
+
+    while (!exiting) {
+        uint64_t now = now_us();
+        if (duration > 0 && now - start >= duration * 1e6)
+            break;
+
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 100) < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("poll");
+            break;
+        }
+
+        if (pfd.revents) {
+            ssize_t n = read(fd, buf + buflen, sizeof(buf) - buflen);
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR)
+                    continue;
+                fprintf(stderr, "%s: connection closed\n", source);
+                break;
+            }
+            buflen += n;
+
+            unsigned frames;
+            long before = ftell(out);
+            size_t used = scanFrames(buf, buflen, out, &frames);
+            memmove(buf, buf + used, buflen - used);
+            buflen -= used;
+
+            if (frames) {
+                struct index_entry entry = { offset, now_us() - start, frames, 0 };
+                fwrite(&entry, sizeof(entry), 1, idx);
+                offset += ftell(out) - before;
+                total_frames += frames;
+                report_frames += frames;
+            }
+        }
+
+        now = now_us();
+        if (now - last_report >= 1000000) {
+            fprintf(stderr, "%8.1fs  %8.0f msg/s  %10llu messages  %8.1f MB\n",
+                    (now - start) / 1e6, report_frames * 1e6 / (now - last_report),
+                    (unsigned long long) total_frames, offset / 1e6);
+            last_report = now;
+            report_frames = 0;
+        }
+    }
+
+    close(fd);
+    fclose(out);
+    fclose(idx);
+
+    double elapsed = (now_us() - start) / 1e6;
+    fprintf(stderr, "recorded %llu messages (%llu bytes) in %.1fs to %s (index %s)\n",
+            (unsigned long long) total_frames, (unsigned long long) offset, elapsed, capture, idxname);
+    free(idxname);
+    return 0;
+}
+
+//
+// Replay
+//
+
+struct connection {
+    int fd;
+    size_t entry;          // next index entry to send
+    size_t sent;           // bytes of that entry already sent
+    unsigned loop;         // number of complete passes through the capture
+    uint64_t messages;
+    uint64_t bytes;
+    bool done;
+};
+
+// Load the index for a capture, or build one from the frame timestamps
+static struct index_entry *loadIndex(const char *capture, const uint8_t *data, size_t size, size_t *count, uint64_t *total_messages)
+{
+    struct index_entry *entries = NULL;
+    char *idxname = indexFilename(capture);
+    FILE *idx = idxname ? fopen(idxname, "rb") : NULL;
+    free(idxname);
+
+    *total_messages = 0;
+
+    if (idx) {
+        struct index_header header;
+        struct stat st;
+        if (fread(&header, sizeof(header), 1, idx) != 1 ||
+            memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) ||
+            header.version != INDEX_VERSION ||
+            header.entry_size != sizeof(struct index_entry) ||
+            fstat(fileno(idx), &st) < 0) {
+            fprintf(stderr, "%s.idx: not a valid index\n", capture);
+            fclose(idx);
+            return NULL;
+        }
+
+        *count = (st.st_size - sizeof(header)) / sizeof(struct index_entry);
+        if (!(entries = malloc((*count + 1) * sizeof(*entries))) ||
+            fread(entries, sizeof(*entries), *count, idx) != *count) {
+            fprintf(stderr, "%s.idx: read failed\n", capture);
+            fclose(idx);
+            free(entries);
+            return NULL;
+        }
+        fclose(idx);
+
+        for (size_t i = 0; i < *count; ++i) {
+            if (entries[i].offset > size || (i > 0 && entries[i].offset < entries[i-1].offset)) {
+                fprintf(stderr, "%s.idx: doesn't match the capture\n", capture);
+                free(entries);
+                return NULL;
+            }
+            *total_messages += entries[i].messages;
+        }
+    } else {
+        // No index; one entry per frame, timed by the 12MHz clock
+        size_t cap = 4096, n = 0, pos = 0;
+        uint64_t last_ts = 0, time_us = 0;
+        bool have_ts = false;
+
+        entries = malloc(cap * sizeof(*entries));
+        while (entries && pos < size) {
+            const uint8_t *p = memchr(data + pos, 0x1a, size - pos);
+            if (!p)
+                break;
+            pos = p - data;
+
+            uint64_t ts;
+            int flen = frameLength(data + pos, size - pos, &ts);
+            if (flen == 0)
+                break;
+            if (flen < 0) {
+                ++pos;
+                continue;
+            }
+
+            // follow the clock forwards; treat resets and jumps over a minute as no delay
+            if (!have_ts) {
+                last_ts = ts;
+                have_ts = true;
+            }
+            if (ts > last_ts && ts - last_ts < 12000000ULL * 60)
+                time_us += (ts - last_ts) / 12;
+            last_ts = ts;
+
+            if (n + 1 >= cap) {
+                cap *= 2;
+                struct index_entry *grown = realloc(entries, cap * sizeof(*entries));
+                if (!grown) {
+                    free(entries);
+                    entries = NULL;
+                    break;
+                }
+                entries = grown;
+            }
+
+            entries[n].offset = pos;
+            entries[n].time_us = time_us;
+            entries[n].messages = 1;
+            entries[n].reserved = 0;
+            ++n;
+            pos += flen;
+        }
+
+        if (!entries) {
+            fprintf(stderr, "out of memory\n");
+            return NULL;
+        }
+
+        *count = n;
+        *total_messages = n;
+        fprintf(stderr, "%s: no index, using frame timestamps\n", capture);
+    }
+
+    // sentinel marking the end of the last entry
+    entries[*count].offset = size;
+    entries[*count].time_us = *count ? entries[*count - 1].time_us : 0;
+    entries[*count].messages = 0;
+    entries[*count].reserved = 0;
+    return entries;
+}
+
+static int replay(int argc, char **argv)
+{
+    unsigned nconn = 1, loops = 1;
+    double speed = 1.0;
+    bool flat_out = false;
+    const char *monitor = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:s:fn:m:")) != -1) {
+        switch (opt) {
+        case 'c': nconn = atoi(optarg); break;
+        case 's': speed = atof(optarg); break;
+        case 'f': flat_out = true; break;
+        case 'n': loops = atoi(optarg); break;
+        case 'm': monitor = optarg; break;
+        default: return 2;
+        }
+    }
+
+    if (argc - optind != 2 || nconn < 1 || speed <= 0) {
+        fprintf(stderr, "usage: beast_replay replay [-c connections] [-s speed | -f] [-n loops] [-m host:port] capture.beast host:port\n");
+        return 2;
+    }
+
+    const char *capture = argv[optind];
+    const char *target = argv[optind + 1];
+
+    int cfd = open(capture, O_RDONLY);
+    struct stat st;
+    if (cfd < 0 || fstat(cfd, &st) < 0) {
+        fprintf(stderr, "%s: %s\n", capture, strerror(errno));
+        return 1;
+    }
+    size_t size = st.st_size;
+    const uint8_t *data = size ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, cfd, 0) : NULL;
+    close(cfd);
+    if (data == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    size_t count;
+    uint64_t capture_messages;
+    struct index_entry *entries = loadIndex(capture, data, size, &count, &capture_messages);
+    if (!entries)
+        return 1;
+    if (!count) {
+        fprintf(stderr, "%s: no messages\n", capture);
+        return 1;
+    }
+
+    // a little gap between passes, so the last batch isn't sent at the same time as the first
+    uint64_t pass_us = entries[count - 1].time_us + 1000;
+
+    // Keep the send buffers small, so that "sent" is close to "consumed" and
+    // the receiver's backpressure shows up as lag rather than as a backlog of
+    // megabytes queued in the kernel
+    int sndbuf = 65536;
+
+    struct connection *conns = calloc(nconn, sizeof(*conns));
+    for (unsigned i = 0; i < nconn; ++i) {
+        if ((conns[i].fd = connectTo(target)) < 0)
+            return 1;
+        setsockopt(conns[i].fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        fcntl(conns[i].fd, F_SETFL, fcntl(conns[i].fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    int mfd = -1;
+    static uint8_t mbuf[65536];
+    size_t mbuflen = 0;
+    uint64_t monitor_messages = 0, report_monitor = 0;
+    if (monitor && (mfd = connectTo(monitor)) < 0)
+        return 1;
+
+    fprintf(stderr, "replaying %llu messages x %u connections x %u passes, %s\n",
+            (unsigned long long) capture_messages, nconn, loops, flat_out ? "flat out" : "paced");
+
+    struct pollfd *pfds = calloc(nconn + 1, sizeof(*pfds));
+    uint64_t start = now_us(), last_report = start;
+    uint64_t report_messages = 0, report_bytes = 0;
+    uint64_t total_messages = 0, max_lag = 0, report_lag = 0;
+    unsigned active = nconn;
+
+    while (active && !exiting) {
+        uint64_t elapsed = now_us() - start;
+        uint64_t next_due = UINT64_MAX;
+        unsigned npfd = 0;
+
+        for (unsigned i = 0; i < nconn; ++i) {
+            struct connection *c = &conns[i];
+            bool blocked = false;
+            unsigned budget = 1024;   // batches per connection per round, so flat-out connections share fairly
+
+            while (!c->done && !blocked && budget--) {
+                const struct index_entry *e = &entries[c->entry];
+                uint64_t due = (uint64_t) ((c->loop * pass_us + e->time_us) / speed);
+                if (!flat_out && due > elapsed) {
+                    if (due < next_due)
+                        next_due = due;
+                    break;
+                }
+
+                size_t len = entries[c->entry + 1].offset - e->offset - c->sent;
+                ssize_t n = len ? send(c->fd, data + e->offset + c->sent, len, 0) : 0;
+                if (n < 0) {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        blocked = true;
+                        break;
+                    }
+                    fprintf(stderr, "connection %u: %s\n", i, strerror(errno));
+                    c->done = true;
+                    --active;
+                    break;
+                }
+
+                c->sent += n;
+                c->bytes += n;
+                report_bytes += n;
+                if ((size_t) n < len) {
+                    blocked = true;
+                    break;
+                }
+
+                // finished this batch
+                c->messages += e->messages;
+                report_messages += e->messages;
+                total_messages += e->messages;
+                if (!flat_out) {
+                    uint64_t lag = elapsed - due;
+                    if (lag > report_lag)
+                        report_lag = lag;
+                }
+
+                c->sent = 0;
+                if (++c->entry == count) {
+                    c->entry = 0;
+                    if (++c->loop == loops) {
+                        c->done = true;
+                        --active;
+                    }
+                }
+            }
+
+            if (blocked) {
+                pfds[npfd].fd = c->fd;
+                pfds[npfd].events = POLLOUT;
+                ++npfd;
+            }
+        }
+
+        if (mfd >= 0) {
+            pfds[npfd].fd = mfd;
+            pfds[npfd].events = POLLIN;
+            ++npfd;
+        }
+
+        // sleep until something is writable, the next batch is due, or the next report
+        uint64_t now = now_us();
+        uint64_t wake = last_report + 1000000;
+        if (next_due != UINT64_MAX && start + next_due < wake)
+            wake = start + next_due;
+        int timeout = (wake > now ? (int) ((wake - now + 999) / 1000) : 0);
+
+        if (npfd || timeout > 0) {
+            if (poll(pfds, npfd, timeout) < 0 && errno != EINTR) {
+                perror("poll");
+                break;
+            }
+        }
+
+        if (mfd >= 0) {
+            ssize_t n = recv(mfd, mbuf + mbuflen, sizeof(mbuf) - mbuflen, MSG_DONTWAIT);
+            if (n > 0) {
+                unsigned frames;
+                mbuflen += n;
+                size_t used = scanFrames(mbuf, mbuflen, NULL, &frames);
+                memmove(mbuf, mbuf + used, mbuflen - used);
+                mbuflen -= used;
+                monitor_messages += frames;
+                report_monitor += frames;
+            } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                fprintf(stderr, "%s: monitor connection closed\n", monitor);
+                close(mfd);
+                mfd = -1;
+            }
+        }
+
+        now = now_us();
+        if (now - last_report >= 1000000) {
+            double secs = (now - last_report) / 1e6;
+            fprintf(stderr, "%8.1fs  sent %9.0f msg/s %7.2f MB/s", (now - start) / 1e6, report_messages / secs, report_bytes / secs / 1e6);
+            if (!flat_out)
+                fprintf(stderr, "  lag %8.1f ms", report_lag / 1e3);
+            if (monitor)
+                fprintf(stderr, "  received %9.0f msg/s", report_monitor / secs);
+            fprintf(stderr, "\n");
+
+            if (report_lag > max_lag)
+                max_lag = report_lag;
+            report_messages = report_bytes = report_lag = report_monitor = 0;
+            last_report = now;
+        }
+    }
+
+    double elapsed = (now_us() - start) / 1e6;
+    fprintf(stderr, "sent %llu messages in %.1fs: %.0f msg/s",
+            (unsigned long long) total_messages, elapsed, total_messages / elapsed);
+    if (!flat_out)
+        fprintf(stderr, ", max lag %.1f ms", max_lag / 1e3);
+    if (monitor)
+        fprintf(stderr, ", received %llu messages", (unsigned long long) monitor_messages);
+    fprintf(stderr, "\n");
+
+    for (unsigned i = 0; i < nconn; ++i)
+        close(conns[i].fd);
+    if (mfd >= 0)
+        close(mfd);
+    free(conns);
+    free(pfds);
+    free(entries);
+    if (data)
+        munmap((void *) data, size);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr,
+                "usage: beast_replay record [-t seconds] [-v] host:port capture.beast\n"
+                "       beast_replay replay [-c connections] [-s speed | -f] [-n loops] [-m host:port] capture.beast host:port\n");
+        return 2;
+    }
+
+    signal(SIGINT, sigintHandler);
+    signal(SIGTERM, sigintHandler);
+    signal(SIGPIPE, SIG_IGN);
+
+    if (!strcmp(argv[1], "record"))
+        return record(argc - 1, argv + 1);
+    if (!strcmp(argv[1], "replay"))
+        return replay(argc - 1, argv + 1);
+
+    fprintf(stderr, "unknown command '%s'\n", argv[1]);
+    return 2;
+}
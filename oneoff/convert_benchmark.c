@@ -19,11 +19,13 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "../dump1090.h"
+#include "../dsp/helpers/preamble_bitmap.h"
 
 static void **testdata_uc8;
 static void **testdata_sc16;
 static void **testdata_sc16q11;
 static uint16_t *outdata;
+static uint64_t *outbitmap;
 
 // SC16Q11_TABLE_BITS notes:
 
@@ -64,6 +66,7 @@ static void prepare()
     testdata_sc16 = calloc(10, sizeof(void*));
     testdata_sc16q11 = calloc(10, sizeof(void*));
     outdata = calloc(MODES_MAG_BUF_SAMPLES, sizeof(uint16_t));
+    outbitmap = calloc(PREAMBLE_BITMAP_WORDS(MODES_MAG_BUF_SAMPLES), sizeof(uint64_t));
 
     for (int buf = 0; buf < 10; ++buf) {
         uint8_t *uc8 = calloc(MODES_MAG_BUF_SAMPLES, 2);
@@ -89,11 +92,11 @@ static void prepare()
     }
 }
 
-static void test(const char *what, input_format_t format, void **data, double sample_rate, bool filter_dc) {
+static void test(const char *what, input_format_t format, void **data, double sample_rate, bool filter_dc, bool bitmap) {
     fprintf(stderr, "Benchmarking: %s ", what);
 
     struct converter_state *state;
-    iq_convert_fn converter = init_converter(format, sample_rate, filter_dc, &state);
+    iq_convert_fn converter = init_converter(format, sample_rate, 2400000, filter_dc, &state);
     if (!converter) {
         fprintf(stderr, "Can't initialize converter\n");
         return;
@@ -103,10 +106,11 @@ static void test(const char *what, input_format_t format, void **data, double sa
     int iterations = 0;
 
     double level, power;
+    uint64_t *preamble_bitmap = (bitmap ? outbitmap : NULL);
 
     // Run it once to force init.
     for (int i = 0; i < 10; ++i) {
-        converter(data[i], outdata, MODES_MAG_BUF_SAMPLES, state, &level, &power);
+        converter(data[i], outdata, MODES_MAG_BUF_SAMPLES, state, &level, &power, preamble_bitmap);
     }
 
     while (total.tv_sec < 5) {
@@ -116,7 +120,7 @@ static void test(const char *what, input_format_t format, void **data, double sa
         start_cpu_timing(&start);
 
         for (int i = 0; i < 10; ++i) {
-            converter(data[i], outdata, MODES_MAG_BUF_SAMPLES, state, &level, &power);
+            converter(data[i], outdata, MODES_MAG_BUF_SAMPLES, state, &level, &power, preamble_bitmap);
         }
 
         end_cpu_timing(&start, &total);
@@ -144,12 +148,20 @@ int main(int argc, char **argv)
 
     prepare();
 
-    test("SC16Q11, DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, true);
-    test("SC16Q11, no DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, false);
+    test("SC16Q11, DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, true, false);
+    test("SC16Q11, no DC", INPUT_SC16Q11, testdata_sc16q11, 2400000, false, false);
 
-    test("UC8, DC", INPUT_UC8, testdata_uc8, 2400000, true);
-    test("UC8, no DC", INPUT_UC8, testdata_uc8, 2400000, false);
+    test("UC8, DC", INPUT_UC8, testdata_uc8, 2400000, true, false);
+    test("UC8, DC, preamble bitmap", INPUT_UC8, testdata_uc8, 2400000, true, true);
+    test("UC8, no DC", INPUT_UC8, testdata_uc8, 2400000, false, false);
+    test("UC8, no DC, preamble bitmap", INPUT_UC8, testdata_uc8, 2400000, false, true);
 
-    test("SC16, DC", INPUT_SC16, testdata_sc16, 2400000, true);
-    test("SC16, no DC", INPUT_SC16, testdata_sc16, 2400000, false);
+    test("SC16, DC", INPUT_SC16, testdata_sc16, 2400000, true, false);
+    test("SC16, no DC", INPUT_SC16, testdata_sc16, 2400000, false, false);
+
+    // sample rates are of the input; these are resampled to 2.4MHz
+    test("SC16, no DC, 6MHz", INPUT_SC16, testdata_sc16, 6000000, false, true);
+    test("SC16, no DC, 8MHz", INPUT_SC16, testdata_sc16, 8000000, false, true);
+    test("SC16, no DC, 10MHz", INPUT_SC16, testdata_sc16, 10000000, false, true);
+    test("SC16, DC, 8MHz", INPUT_SC16, testdata_sc16, 8000000, true, true);
 }
@@ -0,0 +1,462 @@
+// Usage:
+//
+//   decode_benchmark [-n iterations] [-o formats] [-f] [-j] corpus
+//
+// Loads a corpus of Mode S messages into memory and times each stage of the
+// message path separately, without any radio or network I/O:
+//
+//   score    scoreModesMessage()
+//   decode   decodeModesMessage(), which includes scoring and Comm-B decoding
+//   commb    decodeCommB() alone, over the DF20/21 messages only
+//   track    trackUpdateFromMessage()
+//   <format> the output formatter for one network output format, as
+//            modesQueueOutput() would run it for a connected client
+//
+// The corpus is either a Beast binary capture (for example from
+// oneoff/beast_replay record) or dump1090 --raw output, one "*hex;" or
+// "@timestamp hex;" message per line. Mode A/C messages are skipped.
+//
+// Each stage is run over the whole corpus once per iteration (default 10)
+// and the fastest pass is reported, to reduce noise from other activity on
+// the machine. Later stages use the results of earlier ones, so tracking
+// sees each message decoded and the formatters see the aircraft state. The
+// tracker keeps its state between iterations; each pass is presented to it
+// as the same traffic seen again an hour later.
+//
+// Options:
+//   -n iterations  passes per stage
+//   -o formats     comma-separated output formats to time (default: all of
+//                  beast,beast_verbatim,beast_local,raw,sbs,stratux,wiffle),
+//                  or "none"
+//   -f             enable single-bit error correction (as dump1090 --fix)
+//   -j             print the results as a JSON object instead of a table,
+//                  for comparing runs
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../dump1090.h"
+
+struct _Modes Modes;
+
+void receiverPositionChanged(float lat, float lon, float alt)
+{
+    /* nothing */
+    (void) lat;
+    (void) lon;
+    (void) alt;
+}
+
+#define MAX_STAGES 16
+#define PASS_INTERVAL_MS (3600 * 1000)
+
+struct corpus_entry {
+    uint64_t timestamp;         // 12MHz receiver clock, or 0
+    uint64_t offset_ms;         // reception time relative to the first message
+    double signal;
+    unsigned char len;
+    unsigned char msg[MODES_LONG_MSG_BYTES];
+};
+
+struct stage {
+    const char *name;
+    unsigned messages;          // messages handled per pass
+    double best_ns;             // fastest pass
+};
+
+static struct corpus_entry *corpus;
+static unsigned corpus_count, corpus_capacity;
+
+static struct stage stages[MAX_STAGES];
+static unsigned stage_count;
+
+static struct corpus_entry *corpusAdd(void)
+{
+    if (corpus_count == corpus_capacity) {
+        corpus_capacity = corpus_capacity ? corpus_capacity * 2 : 65536;
+        if (!(corpus = realloc(corpus, corpus_capacity * sizeof(*corpus)))) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+
+    struct corpus_entry *e = &corpus[corpus_count];
+    memset(e, 0, sizeof(*e));
+    return e;
+}
+
+// Beast binary: <1a> <type> <6 byte timestamp> <signal> <message>, with any
+// 1a byte after the type doubled
+static void loadBeast(const unsigned char *data, size_t size)
+{
+    size_t p = 0;
+    while (p < size) {
+        if (data[p] != 0x1a || p + 1 >= size) {
+            ++p;
+            continue;
+        }
+
+        unsigned len;
+        switch (data[p + 1]) {
+        case '1': len = 2; break;
+        case '2': len = MODES_SHORT_MSG_BYTES; break;
+        case '3': len = MODES_LONG_MSG_BYTES; break;
+        case '4': len = 14; break;
+        case '5': len = 21; break;
+        default:
+            ++p;
+            continue;
+        }
+
+        unsigned char frame[7 + MODES_LONG_MSG_BYTES + 21];
+        unsigned n = 0, need = 7 + len;
+        size_t q = p + 2;
+        while (n < need && q < size) {
+            unsigned char ch = data[q++];
+            if (ch == 0x1a) {
+                if (q >= size || data[q] != 0x1a)
+                    break;      // start of the next frame; this one is truncated
+                ++q;
+            }
+            frame[n++] = ch;
+        }
+
+        if (n == need && (len == MODES_SHORT_MSG_BYTES || len == MODES_LONG_MSG_BYTES)) {
+            struct corpus_entry *e = corpusAdd();
+            for (int i = 0; i < 6; ++i)
+                e->timestamp = e->timestamp << 8 | frame[i];
+            e->signal = (frame[6] / 255.0) * (frame[6] / 255.0);
+            e->len = len;
+            memcpy(e->msg, frame + 7, len);
+            ++corpus_count;
+        }
+
+        p = q;
+    }
+}
+
+static int hexDigit(int c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// dump1090 --raw output: "*hex;" or "@<12 hex digit timestamp>hex;"
+static void loadRaw(const char *data, size_t size)
+{
+    const char *end = data + size;
+    for (const char *line = data; line < end; ) {
+        const char *eol = memchr(line, '\n', end - line);
+        if (!eol)
+            eol = end;
+
+        const char *p = line;
+        uint64_t timestamp = 0;
+        bool ok = (p < eol && (*p == '*' || *p == '@'));
+        if (ok && *p++ == '@') {
+            for (int i = 0; i < 12 && ok; ++i) {
+                int d = (p < eol ? hexDigit(*p++) : -1);
+                ok = (d >= 0);
+                timestamp = timestamp << 4 | (d & 15);
+            }
+        }
+
+        unsigned char msg[MODES_LONG_MSG_BYTES];
+        unsigned len = 0;
+        while (ok && p + 1 < eol && *p != ';' && len < sizeof(msg)) {
+            int hi = hexDigit(p[0]), lo = hexDigit(p[1]);
+            if (hi < 0 || lo < 0) {
+                ok = false;
+                break;
+            }
+            msg[len++] = hi << 4 | lo;
+            p += 2;
+        }
+
+        if (ok && p < eol && *p == ';' && (len == MODES_SHORT_MSG_BYTES || len == MODES_LONG_MSG_BYTES)) {
+            struct corpus_entry *e = corpusAdd();
+            e->timestamp = timestamp;
+            e->len = len;
+            memcpy(e->msg, msg, len);
+            ++corpus_count;
+        }
+
+        line = eol + 1;
+    }
+}
+
+static bool loadCorpus(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    size_t size = 0, capacity = 0;
+    unsigned char *data = NULL;
+    for (;;) {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : (1 << 20);
+            if (!(data = realloc(data, capacity))) {
+                fprintf(stderr, "out of memory\n");
+                exit(1);
+            }
+        }
+        size_t n = fread(data + size, 1, capacity - size, f);
+        if (!n)
+            break;
+        size += n;
+    }
+    fclose(f);
+
+    if (size && data[0] == 0x1a)
+        loadBeast(data, size);
+    else
+        loadRaw((const char *) data, size);
+    free(data);
+
+    // Reception times follow the receiver clock where there is one, and are
+    // otherwise spaced 1ms apart
+    uint64_t first = 0, last = 0;
+    for (unsigned i = 0; i < corpus_count; ++i) {
+        struct corpus_entry *e = &corpus[i];
+        if (!first && e->timestamp)
+            first = last = e->timestamp;
+
+        if (e->timestamp && e->timestamp >= last && e->timestamp - last < 12000000ULL * 60)
+            last = e->timestamp;
+        else
+            last += 12000;      // gap, reset or no clock
+
+        e->offset_ms = (last - first) / 12000;
+    }
+
+    return true;
+}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static struct stage *addStage(const char *name)
+{
+    if (stage_count == MAX_STAGES) {
+        fprintf(stderr, "too many stages\n");
+        exit(1);
+    }
+
+    struct stage *s = &stages[stage_count++];
+    s->name = name;
+    s->messages = 0;
+    s->best_ns = 0;
+    return s;
+}
+
+static void recordPass(struct stage *s, unsigned iter, unsigned messages, const struct timespec *start, const struct timespec *end)
+{
+    double ns = elapsed_ns(start, end);
+    if (iter == 0 || ns < s->best_ns)
+        s->best_ns = ns;
+    s->messages = messages;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: decode_benchmark [-n iterations] [-o formats|none] [-f] [-j] corpus\n");
+}
+
+int main(int argc, char **argv)
+{
+    unsigned iterations = 10;
+    const char *formats = "beast,beast_verbatim,beast_local,raw,sbs,stratux,wiffle";
+    bool json = false;
+
+    memset(&Modes, 0, sizeof(Modes));
+    Modes.fix_df = 1;
+    Modes.maxRange = 1852 * 300;
+    Modes.quiet = 1;
+    Modes.net_output_flush_size = 1300;
+    Modes.net_output_flush_interval = 500;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:o:fj")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = strtoul(optarg, NULL, 10);
+            break;
+        case 'o':
+            formats = optarg;
+            break;
+        case 'f':
+            Modes.nfix_crc = 1;
+            break;
+        case 'j':
+            json = true;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    if (optind + 1 != argc || iterations == 0) {
+        usage();
+        return 1;
+    }
+
+    const char *path = argv[optind];
+    if (!loadCorpus(path))
+        return 1;
+    if (!corpus_count) {
+        fprintf(stderr, "%s: no Mode S messages found\n", path);
+        return 1;
+    }
+
+    modesChecksumInit(Modes.nfix_crc, NULL);
+    icaoFilterInit();
+    modeACInit();
+    modesInitNet();
+
+    // Per-message results carried from one stage to the next
+    struct modesMessage *decoded = calloc(corpus_count, sizeof(*decoded));
+    struct modesMessage *tracked = calloc(corpus_count, sizeof(*tracked));
+    struct aircraft **aircraft = calloc(corpus_count, sizeof(*aircraft));
+    bool *accepted = calloc(corpus_count, sizeof(*accepted));
+    if (!decoded || !tracked || !aircraft || !accepted) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    struct stage *score = addStage("score");
+    struct stage *decode = addStage("decode");
+    struct stage *commb = addStage("commb");
+    struct stage *track = addStage("track");
+
+    struct stage *first_output = &stages[stage_count];
+    if (strcmp(formats, "none")) {
+        char *copy = strdup(formats), *saveptr = NULL;
+        for (char *f = strtok_r(copy, ",", &saveptr); f; f = strtok_r(NULL, ",", &saveptr)) {
+            const char *name = netOutputFormat(f);
+            if (!name) {
+                fprintf(stderr, "unknown output format '%s'\n", f);
+                return 1;
+            }
+            addStage(name);
+        }
+        free(copy);
+    }
+    struct stage *end_output = &stages[stage_count];
+
+    uint64_t base_ms = mstime();
+    unsigned accepted_count = 0;
+    volatile unsigned sink = 0;
+
+    for (unsigned iter = 0; iter < iterations; ++iter) {
+        struct timespec start, end;
+        unsigned n;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        unsigned total = 0;
+        for (unsigned i = 0; i < corpus_count; ++i)
+            total += scoreModesMessage(corpus[i].msg);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        sink += total;
+        recordPass(score, iter, corpus_count, &start, &end);
+
+        static struct modesMessage zeroMessage;
+        uint64_t pass_ms = base_ms + (uint64_t) iter * PASS_INTERVAL_MS;
+        accepted_count = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned i = 0; i < corpus_count; ++i) {
+            struct modesMessage *mm = &decoded[i];
+            *mm = zeroMessage;
+            mm->remote = 1;
+            mm->timestampMsg = corpus[i].timestamp;
+            mm->sysTimestampMsg = pass_ms + corpus[i].offset_ms;
+            mm->signalLevel = corpus[i].signal;
+            accepted[i] = (decodeModesMessage(mm, corpus[i].msg) >= 0);
+            accepted_count += accepted[i];
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        recordPass(decode, iter, corpus_count, &start, &end);
+
+        // decodeModesMessage has already decoded these; doing it again
+        // gives the same answer and times the Comm-B decoder alone
+        n = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned i = 0; i < corpus_count; ++i) {
+            if (accepted[i] && (decoded[i].msgtype == 20 || decoded[i].msgtype == 21)) {
+                decodeCommB(&decoded[i]);
+                ++n;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        recordPass(commb, iter, n, &start, &end);
+
+        // The tracker updates the message as well as the aircraft, so it
+        // works on a copy and the formatters see the updated copy
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned i = 0; i < corpus_count; ++i) {
+            if (accepted[i]) {
+                tracked[i] = decoded[i];
+                aircraft[i] = trackUpdateFromMessage(&tracked[i]);
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        recordPass(track, iter, accepted_count, &start, &end);
+
+        // Each formatter runs as if a client were connected to that output only
+        for (struct stage *s = first_output; s < end_output; ++s) {
+            struct net_writer *writer = netOutputWriter(s->name);
+            ++writer->connections;
+            ++writer->service->connections;
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (unsigned i = 0; i < corpus_count; ++i) {
+                if (accepted[i])
+                    modesQueueOutput(&tracked[i], aircraft[i]);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            recordPass(s, iter, accepted_count, &start, &end);
+
+            --writer->connections;
+            --writer->service->connections;
+        }
+    }
+
+    if (json) {
+        printf("{ \"corpus\": \"%s\", \"messages\": %u, \"accepted\": %u, \"iterations\": %u, \"stages\": [",
+               path, corpus_count, accepted_count, iterations);
+        for (unsigned i = 0; i < stage_count; ++i) {
+            const struct stage *s = &stages[i];
+            printf("%s\n  { \"stage\": \"%s\", \"messages\": %u, \"ns\": %.0f, \"ns_per_message\": %.1f, \"messages_per_second\": %.0f }",
+                   i ? "," : "", s->name, s->messages, s->best_ns,
+                   s->messages ? s->best_ns / s->messages : 0.0,
+                   s->best_ns > 0 ? s->messages * 1e9 / s->best_ns : 0.0);
+        }
+        printf("\n] }\n");
+    } else {
+        printf("%s: %u messages, %u accepted, best of %u passes\n", path, corpus_count, accepted_count, iterations);
+        printf("%-16s %10s %12s %14s\n", "stage", "messages", "ns/message", "messages/s");
+        for (unsigned i = 0; i < stage_count; ++i) {
+            const struct stage *s = &stages[i];
+            printf("%-16s %10u %12.1f %14.0f\n", s->name, s->messages,
+                   s->messages ? s->best_ns / s->messages : 0.0,
+                   s->best_ns > 0 ? s->messages * 1e9 / s->best_ns : 0.0);
+        }
+    }
+
+    free(accepted);
+    free(aircraft);
+    free(tracked);
+    free(decoded);
+    free(corpus);
+    return 0;
+}
@@ -1,24 +1,36 @@
+// Usage:
+//
+//   decode_comm_b < corpus
+//     decode each line and print the results
+//
+//   decode_comm_b --benchmark [iterations] < corpus
+//     time decoding of the whole corpus, and check every pass agrees
+//
+// Each corpus line is "timestamp [address] MB", with the address and MB in hex.
+// oneoff/extract-comm-b.py produces per-aircraft files without the address;
+// concatenate them with the address prepended to build a mixed corpus.
+
 #include <stdio.h>
 
 #include "../dump1090.h"
 #include "../comm_b.h"
 
-char last_callsign[8];
-double last_callsign_ts = 0;
-double last_track = -1;
-double last_track_ts = 0;
-double last_magnetic = -1;
-double last_magnetic_ts = 0;
-double last_gs = -1;
-double last_gs_ts = 0;
-double last_ias = -1;
-double last_ias_ts = 0;
-double last_tas = -1;
-double last_tas_ts = 0;
-double last_mach = -1;
-double last_mach_ts = 0;
-
-double angle_difference(double h1, double h2)
+static char last_callsign[8];
+static double last_callsign_ts = 0;
+static double last_track = -1;
+static double last_track_ts = 0;
+static double last_magnetic = -1;
+static double last_magnetic_ts = 0;
+static double last_gs = -1;
+static double last_gs_ts = 0;
+static double last_ias = -1;
+static double last_ias_ts = 0;
+static double last_tas = -1;
+static double last_tas_ts = 0;
+static double last_mach = -1;
+static double last_mach_ts = 0;
+
+static double angle_difference(double h1, double h2)
 {
     float delta = fabs(h1 - h2);
     if (delta > 180.0)
@@ -26,7 +38,7 @@ double angle_difference(double h1, double h2)
     return delta;
 }
 
-void process(double timestamp, const char *line, struct modesMessage *mm)
+static void process(double timestamp, const char *line, struct modesMessage *mm)
 {
     decodeCommB(mm);
 
@@ -96,16 +108,16 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
         last_gs_ts = timestamp;
     }
     if (mm->ias_valid) {
-        printf("\tias\t%d", mm->ias);
-        if ((timestamp - last_ias_ts) < 10.0 && abs(last_ias - mm->ias) > 50) {
+        printf("\tias\t%u", mm->ias);
+        if ((timestamp - last_ias_ts) < 10.0 && fabs(last_ias - mm->ias) > 50) {
             suspicious = 1;
         }
         last_ias = mm->ias;
         last_ias_ts = timestamp;
     }
     if (mm->tas_valid) {
-        printf("\ttas\t%d", mm->tas);
-        if ((timestamp - last_tas_ts) < 10.0 && abs(last_tas - mm->tas) > 50) {
+        printf("\ttas\t%u", mm->tas);
+        if ((timestamp - last_tas_ts) < 10.0 && fabs(last_tas - mm->tas) > 50) {
             suspicious = 1;
         }
         last_tas = mm->tas;
@@ -113,7 +125,7 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
     }
     if (mm->mach_valid) {
         printf("\tmach\t%.3f", mm->mach);
-        if ((timestamp - last_mach_ts) < 10.0 && abs(last_mach - mm->mach) > 0.1) {
+        if ((timestamp - last_mach_ts) < 10.0 && fabs(last_mach - mm->mach) > 0.1) {
             suspicious = 1;
         }
         last_mach = mm->mach;
@@ -127,46 +139,155 @@ void process(double timestamp, const char *line, struct modesMessage *mm)
     printf("\n");
 }
 
-int main(int argc, char **argv)
+// Parse "timestamp [address] MB"
+static bool parse_line(const char *line, double *timestamp, struct modesMessage *mm)
+{
+    static struct modesMessage mmZero;
+    int index = 0;
+
+    *mm = mmZero;
+    if (sscanf(line, "%lf %n", timestamp, &index) < 1) {
+        return false;
+    }
+
+    const char *hex = line + index;
+    unsigned addr = 0;
+    int addr_index = 0;
+    if (sscanf(hex, "%6x %n", &addr, &addr_index) == 1 && addr_index == 7) {
+        mm->addr = addr;
+        hex += addr_index;
+    }
+
+    for (unsigned i = 0; i < sizeof(mm->MB); ++i) {
+        if (!isxdigit(hex[i*2]) || !isxdigit(hex[i*2 + 1])) {
+            return false;
+        }
+
+        unsigned xvalue = 0;
+        if (sscanf(hex + i*2, "%2x", &xvalue) < 1) {
+            return false;
+        }
+
+        mm->MB[i] = xvalue;
+    }
+
+    return true;
+}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static int benchmark(unsigned iterations)
 {
-    /* unused */ (void)argc;
-    /* unused */ (void)argv;
-    
     char line[1024];
+    // keep only the fields the decoder looks at, so the corpus is compact
+    // and the timed loop reuses a single message like the real decoder does
+    struct corpus_entry {
+        uint32_t addr;
+        unsigned char MB[7];
+    } *corpus = NULL;
+    unsigned count = 0, capacity = 0;
 
     while (fgets(line, sizeof(line), stdin)) {
-        if (line[strlen(line)-1] == '\n') {
-            line[strlen(line)-1] = '\0';
+        double timestamp;
+        struct modesMessage mm;
+
+        if (!parse_line(line, &timestamp, &mm))
+            continue;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 65536;
+            if (!(corpus = realloc(corpus, capacity * sizeof(*corpus)))) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
         }
 
-        double timestamp = 0;
-        int index = 0;
-        if (sscanf(line, "%lf %n", &timestamp, &index) < 1) {
-            goto bad;
+        corpus[count].addr = mm.addr;
+        memcpy(corpus[count].MB, mm.MB, sizeof(corpus[count].MB));
+        ++count;
+    }
+
+    if (!count) {
+        fprintf(stderr, "no messages read\n");
+        return 1;
+    }
+
+    commb_format_t *expected = malloc(count * sizeof(*expected));
+    commb_format_t *actual = malloc(count * sizeof(*actual));
+    if (!expected || !actual) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // Keep the fastest pass, to reduce noise from other activity on the machine
+    double best_ns = 0;
+    int ok = 1;
+    for (unsigned iter = 0; iter < iterations; ++iter) {
+        struct timespec start, end;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned i = 0; i < count; ++i) {
+            static struct modesMessage mmZero;
+            struct modesMessage mm = mmZero;
+
+            mm.addr = corpus[i].addr;
+            memcpy(mm.MB, corpus[i].MB, sizeof(mm.MB));
+            decodeCommB(&mm);
+            actual[i] = mm.commb_format;
         }
+        clock_gettime(CLOCK_MONOTONIC, &end);
 
-        char *hex = line + index;
+        double ns = elapsed_ns(&start, &end);
+        if (iter == 0 || ns < best_ns)
+            best_ns = ns;
 
-        static struct modesMessage mmZero;
-        struct modesMessage mm = mmZero;
-        for (unsigned i = 0; i < sizeof(mm.MB); ++i) {
-            if (!isxdigit(hex[i*2]) || !isxdigit(hex[i*2 + 1])) {
-                goto bad;
-            }
+        unsigned mismatches = 0;
+        for (unsigned i = 0; i < count; ++i) {
+            if (iter == 0)
+                expected[i] = actual[i];
+            else if (expected[i] != actual[i])
+                ++mismatches;
+        }
 
-            unsigned xvalue = 0;
-            if (sscanf(hex + i*2, "%2x", &xvalue) < 1) {
-                goto bad;
-            }
+        if (mismatches) {
+            fprintf(stderr, "%u results differ from the first pass!\n", mismatches);
+            ok = 0;
+        }
+    }
+
+    fprintf(stderr, "%u messages, best of %u: %.1f ns/message\n", count, iterations, best_ns / count);
+
+    free(actual);
+    free(expected);
+    free(corpus);
+    return ok ? 0 : 1;
+}
 
-            mm.MB[i] = xvalue;
+int main(int argc, char **argv)
+{
+    char line[1024];
+
+    if (argc > 1 && !strcmp(argv[1], "--benchmark")) {
+        return benchmark(argc > 2 ? strtoul(argv[2], NULL, 10) : 10);
+    }
+
+    while (fgets(line, sizeof(line), stdin)) {
+        if (line[strlen(line)-1] == '\n') {
+            line[strlen(line)-1] = '\0';
         }
 
-        process(timestamp, line, &mm);
-        continue;
+        double timestamp = 0;
+        struct modesMessage mm;
+        if (!parse_line(line, &timestamp, &mm)) {
+            fprintf(stderr, "failed to scan line: %s\n", line);
+            continue;
+        }
 
-    bad:
-        fprintf(stderr, "failed to scan line: %s", line);
-        continue;
+        process(timestamp, line, &mm);
     }
+
+    return 0;
 }
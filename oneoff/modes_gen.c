@@ -0,0 +1,752 @@
+/* synthesizes Mode S sample files with known content, and scores what the
+ * demodulator made of them
+ *
+ *   modes_gen generate [options] -o samples -t truth
+ *
+ *     Writes 'duration' seconds of IQ samples containing DF11, DF17 and DF20
+ *     frames from a pool of aircraft, in complex Gaussian noise, plus a
+ *     ground-truth file listing every frame. Options:
+ *
+ *       -f uc8|sc16   sample format (default uc8)
+ *       -r rate       sample rate, Hz (default 2400000)
+ *       -d seconds    duration (default 10)
+ *       -m rate       Mode S frames per second (default 2000)
+ *       -s list       comma-separated SNRs in dB; each frame uses one of them
+ *                     (default 0,2,4,6,8,10,12,14,16,20)
+ *       -n dBFS       noise power (default -30)
+ *       -O fraction   fraction of frames deliberately started inside the
+ *                     previous frame (default 0.05)
+ *       -i rate       interfering Mode A/C replies per second (default 2000)
+ *       -F hz         carrier offsets are uniform in +/- this (default 0)
+ *       -a count      number of aircraft (default 200)
+ *       -S seed       random seed (default 1)
+ *
+ *     Each frame starts at a random sub-sample time with a random carrier
+ *     phase. Pulses are integrated over each sample period, so a pulse edge
+ *     that falls inside a sample contributes in proportion. SNR is the
+ *     ratio of pulse power to noise power per sample. The first frame from
+ *     each aircraft is a DF17, so that its address is known before any
+ *     DF20 (whose parity is overlaid with the address) arrives.
+ *
+ *     The truth file has one line per frame, in time order:
+ *
+ *       <timestamp> <message hex> <snr dB> <overlapped>
+ *
+ *     where the timestamp is in 12MHz units since the start of the file, at
+ *     the end of bit 56 as dump1090 reports it, and 'overlapped' is 1 if the
+ *     frame overlaps any other frame or Mode A/C reply.
+ *
+ *   modes_gen score truth output
+ *
+ *     Reads the output of 'dump1090 --ifile samples --raw --mlat --stats'
+ *     and reports, per SNR, the fraction of frames decoded (overall and for
+ *     frames with no overlap) and the number of false decodes: messages
+ *     that match no frame. A false decode is charged to the SNR of the
+ *     nearest frame, if there is one within 120us. It also reports the
+ *     demodulator's CPU time per million samples and decodes per second of
+ *     demodulator CPU time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+
+#include <unistd.h>
+
+#define MAX_SNRS 32
+#define CHUNK_SAMPLES (1 << 20)
+#define MAX_EVENT_US 121.0          // longest event: a 112-bit frame plus preamble
+
+//
+// Random numbers (xorshift64*), reproducible for a given seed
+//
+
+static uint64_t rng_state;
+
+static uint64_t rng_next(void)
+{
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 2685821657736338717ULL;
+}
+
+static double rng_uniform(void)
+{
+    return (rng_next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double rng_gaussian(void)
+{
+    // Box-Muller; one value per call is plenty fast here
+    double u1 = rng_uniform();
+    double u2 = rng_uniform();
+    if (u1 < 1e-300)
+        u1 = 1e-300;
+    return sqrt(-2.0 * log(u1)) * cos(2 * M_PI * u2);
+}
+
+//
+// Mode S frames
+//
+
+static uint32_t crc24(const uint8_t *msg, int bytes)
+{
+    // bitwise, independently of dump1090's table-driven version
+    uint32_t crc = 0;
+    for (int i = 0; i < bytes * 8; ++i) {
+        int bit = (msg[i / 8] >> (7 - (i & 7))) & 1;
+        int top = (crc >> 23) & 1;
+        crc = (crc << 1) & 0xFFFFFF;
+        if (bit ^ top)
+            crc ^= 0xFFF409;
+    }
+    return crc;
+}
+
+static void setParity(uint8_t *msg, int bytes, uint32_t overlay)
+{
+    uint32_t crc = crc24(msg, bytes - 3) ^ overlay;
+    msg[bytes - 3] = crc >> 16;
+    msg[bytes - 2] = crc >> 8;
+    msg[bytes - 1] = crc;
+}
+
+static int makeFrame(int df, uint32_t addr, uint8_t *msg)
+{
+    int bytes = (df == 11 ? 7 : 14);
+    for (int i = 0; i < bytes; ++i)
+        msg[i] = rng_next() >> 56;
+
+    switch (df) {
+    case 11:
+        // all-call reply, capability 5, interrogator code 0
+        msg[0] = (11 << 3) | 5;
+        msg[1] = addr >> 16;
+        msg[2] = addr >> 8;
+        msg[3] = addr;
+        setParity(msg, bytes, 0);
+        break;
+
+    case 17:
+        // extended squitter, capability 5, random ME with a typecode that
+        // carries data (1..22)
+        msg[0] = (17 << 3) | 5;
+        msg[1] = addr >> 16;
+        msg[2] = addr >> 8;
+        msg[3] = addr;
+        msg[4] = (uint8_t) ((1 + rng_next() % 22) << 3) | (msg[4] & 7);
+        setParity(msg, bytes, 0);
+        break;
+
+    case 20:
+        // Comm-B altitude reply, random content, address overlaid on parity
+        msg[0] = (20 << 3) | (msg[0] & 7);
+        setParity(msg, bytes, addr);
+        break;
+    }
+
+    return bytes;
+}
+
+//
+// Events: Mode S frames and Mode A/C replies, rendered into the sample stream
+//
+
+struct event {
+    double start;           // seconds since the start of the file
+    double end;
+    double amplitude;       // fraction of full scale
+    double phase;           // carrier phase at 'start', radians
+    double freq;            // carrier offset, Hz
+    int snr_index;          // index into the SNR list, or -1 for Mode A/C
+    bool overlapped;
+    int bytes;              // Mode S: message length
+    uint8_t msg[14];
+    unsigned squawk;        // Mode A/C: 13 pulse positions as bits (bit 0 = C1)
+};
+
+static int compareEvents(const void *a, const void *b)
+{
+    const struct event *ea = a, *eb = b;
+    return (ea->start > eb->start) - (ea->start < eb->start);
+}
+
+// Add one rectangular pulse [p0,p1) (seconds) of an event to the chunk
+// starting at sample 'base'
+static void addPulse(const struct event *e, double p0, double p1, double rate, uint64_t base, unsigned len, float *iq)
+{
+    double first = floor(p0 * rate);
+    double last = ceil(p1 * rate);
+    for (double s = first; s < last; s += 1) {
+        if (s < (double) base || s >= (double) (base + len))
+            continue;
+
+        // fraction of this sample period covered by the pulse
+        double t0 = s / rate, t1 = (s + 1) / rate;
+        double covered = (p1 < t1 ? p1 : t1) - (p0 > t0 ? p0 : t0);
+        double a = e->amplitude * covered * rate;
+        double phase = e->phase + 2 * M_PI * e->freq * (t0 - e->start);
+
+        unsigned k = (unsigned) (s - base);
+        iq[2 * k] += a * cos(phase);
+        iq[2 * k + 1] += a * sin(phase);
+    }
+}
+
+static void renderEvent(const struct event *e, double rate, uint64_t base, unsigned len, float *iq)
+{
+    const double us = 1e-6;
+    double t = e->start;
+
+    if (e->snr_index < 0) {
+        // Mode A/C: F1, 13 information positions at 1.45us spacing, F2 at 20.3us
+        addPulse(e, t, t + 0.45 * us, rate, base, len, iq);
+        for (int i = 0; i < 13; ++i) {
+            if (e->squawk & (1 << i)) {
+                double p = t + 1.45 * (i + 1) * us;
+                addPulse(e, p, p + 0.45 * us, rate, base, len, iq);
+            }
+        }
+        addPulse(e, t + 20.3 * us, t + 20.75 * us, rate, base, len, iq);
+        return;
+    }
+
+    // preamble
+    static const double preamble[4] = { 0.0, 1.0, 3.5, 4.5 };
+    for (int i = 0; i < 4; ++i)
+        addPulse(e, t + preamble[i] * us, t + (preamble[i] + 0.5) * us, rate, base, len, iq);
+
+    // data, pulse position modulated: 1 = first half of the bit period
+    for (int i = 0; i < e->bytes * 8; ++i) {
+        int bit = (e->msg[i / 8] >> (7 - (i & 7))) & 1;
+        double p = t + (8.0 + i + (bit ? 0.0 : 0.5)) * us;
+        addPulse(e, p, p + 0.5 * us, rate, base, len, iq);
+    }
+}
+
+static int parseSnrs(const char *list, double *snrs)
+{
+    int n = 0;
+    const char *p = list;
+    while (*p && n < MAX_SNRS) {
+        char *end;
+        snrs[n++] = strtod(p, &end);
+        if (end == p)
+            return -1;
+        p = (*end == ',' ? end + 1 : end);
+        if (*end && *end != ',')
+            return -1;
+    }
+    return n;
+}
+
+static void generateUsage(void)
+{
+    fprintf(stderr, "usage: modes_gen generate [-f uc8|sc16] [-r rate] [-d seconds] [-m rate] [-s snr,snr,..] [-n dBFS]\n"
+                    "                          [-O fraction] [-i rate] [-F hz] [-a aircraft] [-S seed] -o samples -t truth\n");
+}
+
+static int generate(int argc, char **argv)
+{
+    bool sc16 = false;
+    double rate = 2400000;
+    double duration = 10;
+    double frame_rate = 2000;
+    double snrs[MAX_SNRS];
+    int nsnrs = parseSnrs("0,2,4,6,8,10,12,14,16,20", snrs);
+    double noise_dbfs = -30;
+    double overlap = 0.05;
+    double modeac_rate = 2000;
+    double max_freq = 0;
+    unsigned naircraft = 200;
+    uint64_t seed = 1;
+    const char *sample_path = NULL, *truth_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:r:d:m:s:n:O:i:F:a:S:o:t:")) != -1) {
+        switch (opt) {
+        case 'f':
+            if (!strcmp(optarg, "uc8"))
+                sc16 = false;
+            else if (!strcmp(optarg, "sc16"))
+                sc16 = true;
+            else {
+                fprintf(stderr, "unknown sample format '%s'\n", optarg);
+                return 1;
+            }
+            break;
+        case 'r': rate = atof(optarg); break;
+        case 'd': duration = atof(optarg); break;
+        case 'm': frame_rate = atof(optarg); break;
+        case 's':
+            if ((nsnrs = parseSnrs(optarg, snrs)) <= 0) {
+                fprintf(stderr, "bad SNR list '%s'\n", optarg);
+                return 1;
+            }
+            break;
+        case 'n': noise_dbfs = atof(optarg); break;
+        case 'O': overlap = atof(optarg); break;
+        case 'i': modeac_rate = atof(optarg); break;
+        case 'F': max_freq = atof(optarg); break;
+        case 'a': naircraft = strtoul(optarg, NULL, 10); break;
+        case 'S': seed = strtoull(optarg, NULL, 10); break;
+        case 'o': sample_path = optarg; break;
+        case 't': truth_path = optarg; break;
+        default:
+            generateUsage();
+            return 1;
+        }
+    }
+
+    if (!sample_path || !truth_path || rate < 2e6 || duration <= 0 || frame_rate <= 0 || naircraft == 0 || overlap < 0 || overlap > 1) {
+        generateUsage();
+        return 1;
+    }
+
+    rng_state = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    // Aircraft addresses; the first frame from each is a DF17
+    uint32_t *addrs = calloc(naircraft, sizeof(*addrs));
+    bool *announced = calloc(naircraft, sizeof(*announced));
+    size_t max_events = (size_t) ((frame_rate + modeac_rate) * duration * 1.5) + 1000;
+    struct event *events = calloc(max_events, sizeof(*events));
+    if (!addrs || !announced || !events) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < naircraft; ++i)
+        addrs[i] = 0x100000 + (rng_next() >> 40) % 0xE00000;
+
+    double noise_power = pow(10, noise_dbfs / 10);
+    size_t nevents = 0;
+
+    // Mode S frames
+    double t = 0, last_start = 0, last_len = 0;
+    unsigned frames_by_df[32] = { 0 };
+    while (nevents < max_events) {
+        double start;
+        if (nevents > 0 && rng_uniform() < overlap)
+            start = last_start + rng_uniform() * last_len;
+        else
+            start = (t += -log(1 - rng_uniform()) / frame_rate);
+        if (start + MAX_EVENT_US * 1e-6 >= duration)
+            break;
+
+        struct event *e = &events[nevents++];
+        unsigned a = rng_next() % naircraft;
+        int df;
+        if (!announced[a]) {
+            df = 17;
+            announced[a] = true;
+        } else {
+            double r = rng_uniform();
+            df = (r < 0.4 ? 17 : r < 0.7 ? 11 : 20);
+        }
+        ++frames_by_df[df];
+
+        e->bytes = makeFrame(df, addrs[a], e->msg);
+        e->snr_index = rng_next() % nsnrs;
+        e->amplitude = sqrt(noise_power * pow(10, snrs[e->snr_index] / 10));
+        e->phase = rng_uniform() * 2 * M_PI;
+        e->freq = (rng_uniform() * 2 - 1) * max_freq;
+        e->start = start;
+        e->end = start + (8 + e->bytes * 8) * 1e-6;
+        last_start = start;
+        last_len = e->end - e->start;
+    }
+
+    // Mode A/C interference, at random strengths across the SNR range
+    for (t = 0; modeac_rate > 0 && nevents < max_events; ) {
+        t += -log(1 - rng_uniform()) / modeac_rate;
+        if (t + MAX_EVENT_US * 1e-6 >= duration)
+            break;
+
+        struct event *e = &events[nevents++];
+        e->snr_index = -1;
+        e->squawk = (rng_next() >> 40) & 0x1FBF; // position 7 (X) is never sent
+        e->amplitude = sqrt(noise_power * pow(10, snrs[rng_next() % nsnrs] / 10));
+        e->phase = rng_uniform() * 2 * M_PI;
+        e->freq = (rng_uniform() * 2 - 1) * max_freq;
+        e->start = t;
+        e->end = t + 20.75e-6;
+    }
+
+    qsort(events, nevents, sizeof(*events), compareEvents);
+
+    // mark overlaps
+    for (size_t i = 0; i < nevents; ++i) {
+        for (size_t j = i + 1; j < nevents && events[j].start < events[i].end; ++j)
+            events[i].overlapped = events[j].overlapped = true;
+    }
+
+    FILE *truth = fopen(truth_path, "w");
+    FILE *samples = fopen(sample_path, "wb");
+    if (!truth || !samples) {
+        perror("open output");
+        return 1;
+    }
+
+    fprintf(truth, "# modes_gen truth: format=%s rate=%.0f duration=%.1f noise=%.1fdBFS overlap=%.3f modeac=%.0f/s freq=%.0fHz aircraft=%u seed=%" PRIu64 "\n",
+            sc16 ? "sc16" : "uc8", rate, duration, noise_dbfs, overlap, modeac_rate, max_freq, naircraft, seed);
+    fprintf(truth, "# timestamp message snr overlapped\n");
+
+    size_t frames = 0;
+    for (size_t i = 0; i < nevents; ++i) {
+        const struct event *e = &events[i];
+        if (e->snr_index < 0)
+            continue;
+
+        fprintf(truth, "%" PRIu64 " ", (uint64_t) llround((e->start + 64e-6) * 12e6));
+        for (int k = 0; k < e->bytes; ++k)
+            fprintf(truth, "%02x", e->msg[k]);
+        fprintf(truth, " %.1f %d\n", snrs[e->snr_index], e->overlapped ? 1 : 0);
+        ++frames;
+    }
+
+    // Render a chunk at a time
+    uint64_t total = (uint64_t) (duration * rate);
+    float *iq = malloc(2 * CHUNK_SAMPLES * sizeof(float));
+    void *out = malloc(2 * CHUNK_SAMPLES * (sc16 ? sizeof(int16_t) : sizeof(uint8_t)));
+    if (!iq || !out) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    double sigma = sqrt(noise_power / 2);
+    size_t first = 0;
+    for (uint64_t base = 0; base < total; base += CHUNK_SAMPLES) {
+        unsigned len = (total - base < CHUNK_SAMPLES ? total - base : CHUNK_SAMPLES);
+        double chunk_start = base / rate, chunk_end = (base + len) / rate;
+
+        for (unsigned k = 0; k < 2 * len; ++k)
+            iq[k] = sigma * rng_gaussian();
+
+        while (first < nevents && events[first].start + MAX_EVENT_US * 1e-6 < chunk_start)
+            ++first;
+        for (size_t i = first; i < nevents && events[i].start < chunk_end; ++i) {
+            if (events[i].end > chunk_start)
+                renderEvent(&events[i], rate, base, len, iq);
+        }
+
+        for (unsigned k = 0; k < 2 * len; ++k) {
+            double v = iq[k];
+            if (v > 1)
+                v = 1;
+            if (v < -1)
+                v = -1;
+            if (sc16)
+                ((int16_t *) out)[k] = (int16_t) lrint(v * 32767);
+            else
+                ((uint8_t *) out)[k] = (uint8_t) lrint(127.5 + v * 127.5);
+        }
+
+        size_t bytes = 2 * len * (sc16 ? sizeof(int16_t) : sizeof(uint8_t));
+        if (fwrite(out, 1, bytes, samples) != bytes) {
+            perror("write samples");
+            return 1;
+        }
+    }
+
+    if (fclose(samples) || fclose(truth)) {
+        perror("close output");
+        return 1;
+    }
+
+    fprintf(stderr, "%" PRIu64 " samples, %zu frames (DF11 %u, DF17 %u, DF20 %u), %zu Mode A/C replies\n",
+            total, frames, frames_by_df[11], frames_by_df[17], frames_by_df[20], nevents - frames);
+
+    free(iq);
+    free(out);
+    free(events);
+    free(addrs);
+    free(announced);
+    return 0;
+}
+
+//
+// Scoring
+//
+
+struct truth_frame {
+    uint64_t timestamp;
+    char hex[29];
+    double snr;
+    bool overlapped;
+    bool decoded;
+};
+
+struct decoded {
+    uint64_t timestamp;
+    char hex[29];
+};
+
+static int compareTruth(const void *a, const void *b)
+{
+    const struct truth_frame *ta = a, *tb = b;
+    return (ta->timestamp > tb->timestamp) - (ta->timestamp < tb->timestamp);
+}
+
+// index of the first frame with timestamp >= ts
+static size_t lowerBound(const struct truth_frame *frames, size_t n, uint64_t ts)
+{
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (frames[mid].timestamp < ts)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static int score(int argc, char **argv)
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: modes_gen score truth output\n");
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "r");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    size_t nframes = 0, max_frames = 0;
+    struct truth_frame *frames = NULL;
+    double rate = 2400000;
+    char line[512];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') {
+            char *r = strstr(line, " rate=");
+            if (r)
+                rate = atof(r + 6);
+            continue;
+        }
+
+        if (nframes == max_frames) {
+            max_frames = max_frames ? max_frames * 2 : 65536;
+            if (!(frames = realloc(frames, max_frames * sizeof(*frames)))) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+        }
+
+        struct truth_frame *t = &frames[nframes];
+        int overlapped;
+        if (sscanf(line, "%" SCNu64 " %28s %lf %d", &t->timestamp, t->hex, &t->snr, &overlapped) == 4) {
+            t->overlapped = overlapped;
+            t->decoded = false;
+            ++nframes;
+        }
+    }
+    fclose(f);
+    qsort(frames, nframes, sizeof(*frames), compareTruth);
+
+    // SNR buckets, in the order they first appear
+    double snrs[MAX_SNRS];
+    int nsnrs = 0;
+    for (size_t i = 0; i < nframes; ++i) {
+        int k;
+        for (k = 0; k < nsnrs && snrs[k] != frames[i].snr; ++k)
+            ;
+        if (k == nsnrs && nsnrs < MAX_SNRS)
+            snrs[nsnrs++] = frames[i].snr;
+    }
+    for (int i = 1; i < nsnrs; ++i) {
+        for (int j = i; j > 0 && snrs[j - 1] > snrs[j]; --j) {
+            double tmp = snrs[j];
+            snrs[j] = snrs[j - 1];
+            snrs[j - 1] = tmp;
+        }
+    }
+
+    if (!(f = fopen(argv[2], "r"))) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    unsigned decodes = 0, matched = 0, duplicates = 0, untimed = 0;
+    unsigned false_by_snr[MAX_SNRS + 1] = { 0 };   // last entry: no frame nearby
+    unsigned long long samples = 0, demod_ms = 0, reader_ms = 0;
+    bool have_cpu = false;
+    size_t ndecoded = 0, max_decoded = 0;
+    struct decoded *decoded = NULL;
+
+    while (fgets(line, sizeof(line), f)) {
+        if (strstr(line, "samples processed") && !samples) {
+            samples = strtoull(line, NULL, 10);
+            continue;
+        }
+        if (strstr(line, "ms for demodulation")) {
+            demod_ms = strtoull(line, NULL, 10);
+            have_cpu = true;
+            continue;
+        }
+        if (strstr(line, "ms for reading from USB")) {
+            reader_ms = strtoull(line, NULL, 10);
+            continue;
+        }
+
+        if (line[0] == '*') {
+            ++decodes;
+            ++untimed;
+            continue;
+        }
+        if (line[0] != '@')
+            continue;
+
+        if (ndecoded == max_decoded) {
+            max_decoded = max_decoded ? max_decoded * 2 : 65536;
+            if (!(decoded = realloc(decoded, max_decoded * sizeof(*decoded)))) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+        }
+
+        struct decoded *d = &decoded[ndecoded];
+        if (sscanf(line, "@%12" SCNx64 "%28[0-9a-fA-F];", &d->timestamp, d->hex) == 2) {
+            ++decodes;
+            ++ndecoded;
+        }
+    }
+    fclose(f);
+
+    // dump1090's timestamps are offset from ours by a constant that depends on
+    // how it buffers samples; estimate it as the median difference between
+    // decodes and the nearest earlier frame with the same bytes
+    int64_t offset = 0;
+    int64_t *deltas = calloc(ndecoded + 1, sizeof(*deltas));
+    size_t ndeltas = 0;
+    if (!deltas) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t j = 0; j < ndecoded; ++j) {
+        uint64_t ts = decoded[j].timestamp, window = 1000 * 12;
+        size_t i = lowerBound(frames, nframes, ts > window ? ts - window : 0);
+        int64_t best = -1;
+        for (; i < nframes && frames[i].timestamp <= ts; ++i) {
+            if (!strcasecmp(frames[i].hex, decoded[j].hex))
+                best = ts - frames[i].timestamp;
+        }
+        if (best >= 0)
+            deltas[ndeltas++] = best;
+    }
+    for (size_t i = 1; i < ndeltas; ++i) {
+        for (size_t j = i; j > 0 && deltas[j - 1] > deltas[j]; --j) {
+            int64_t tmp = deltas[j];
+            deltas[j] = deltas[j - 1];
+            deltas[j - 1] = tmp;
+        }
+    }
+    if (ndeltas)
+        offset = deltas[ndeltas / 2];
+    free(deltas);
+
+    for (size_t j = 0; j < ndecoded; ++j) {
+        uint64_t ts = decoded[j].timestamp - offset;
+
+        // the frame with these bytes within 1us (12 ticks)
+        size_t i = lowerBound(frames, nframes, ts > 12 ? ts - 12 : 0);
+        bool found = false;
+        for (; i < nframes && frames[i].timestamp <= ts + 12; ++i) {
+            if (!strcasecmp(frames[i].hex, decoded[j].hex)) {
+                found = true;
+                if (frames[i].decoded) {
+                    ++duplicates;
+                } else {
+                    frames[i].decoded = true;
+                    ++matched;
+                }
+                break;
+            }
+        }
+        if (found)
+            continue;
+
+        // false decode: charge it to the nearest frame within 120us
+        uint64_t window = 120 * 12;
+        i = lowerBound(frames, nframes, ts > window ? ts - window : 0);
+        int bucket = nsnrs;
+        uint64_t best = window + 1;
+        for (; i < nframes && frames[i].timestamp <= ts + window; ++i) {
+            uint64_t d = frames[i].timestamp > ts ? frames[i].timestamp - ts : ts - frames[i].timestamp;
+            if (d < best) {
+                best = d;
+                for (int k = 0; k < nsnrs; ++k) {
+                    if (snrs[k] == frames[i].snr)
+                        bucket = k;
+                }
+            }
+        }
+        ++false_by_snr[bucket];
+    }
+
+    printf("   SNR     frames  decoded   no-overlap  false\n");
+    unsigned total_frames = 0, total_clean = 0, total_clean_decoded = 0, total_false = false_by_snr[nsnrs];
+    for (int k = 0; k < nsnrs; ++k) {
+        unsigned n = 0, decoded = 0, clean = 0, clean_decoded = 0;
+        for (size_t i = 0; i < nframes; ++i) {
+            if (frames[i].snr != snrs[k])
+                continue;
+            ++n;
+            decoded += frames[i].decoded;
+            if (!frames[i].overlapped) {
+                ++clean;
+                clean_decoded += frames[i].decoded;
+            }
+        }
+
+        printf("%5.1f dB  %7u  %6.1f%%     %6.1f%%  %5u (%.2f%%)\n",
+               snrs[k], n, n ? 100.0 * decoded / n : 0.0, clean ? 100.0 * clean_decoded / clean : 0.0,
+               false_by_snr[k], n ? 100.0 * false_by_snr[k] / n : 0.0);
+        total_frames += n;
+        total_clean += clean;
+        total_clean_decoded += clean_decoded;
+        total_false += false_by_snr[k];
+    }
+
+    printf("  all     %7u  %6.1f%%     %6.1f%%  %5u (%.2f%%), %u not near any frame\n",
+           total_frames, total_frames ? 100.0 * matched / total_frames : 0.0,
+           total_clean ? 100.0 * total_clean_decoded / total_clean : 0.0,
+           total_false, total_frames ? 100.0 * total_false / total_frames : 0.0, false_by_snr[nsnrs]);
+
+    printf("\n%u messages output, %u matched, %u repeated, %u without a timestamp (use --mlat)\n",
+           decodes, matched, duplicates, untimed);
+    printf("timestamp offset %+" PRId64 " (12MHz units)\n", offset);
+
+    if (have_cpu && samples) {
+        printf("%llu samples (%.1f s at %.0f Hz)\n", samples, samples / rate, rate);
+        printf("demodulator: %llu ms CPU, %.2f ms per million samples, %.0f decodes per CPU second\n",
+               demod_ms, demod_ms * 1e6 / samples, demod_ms ? decodes * 1000.0 / demod_ms : 0.0);
+        printf("sample conversion: %llu ms CPU, %.2f ms per million samples\n",
+               reader_ms, reader_ms * 1e6 / samples);
+    } else {
+        printf("no CPU statistics found (run dump1090 with --stats)\n");
+    }
+
+    free(frames);
+    free(decoded);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 2 && !strcmp(argv[1], "generate"))
+        return generate(argc - 1, argv + 1);
+    if (argc >= 2 && !strcmp(argv[1], "score"))
+        return score(argc - 1, argv + 1);
+
+    fprintf(stderr,
+            "usage: modes_gen generate [options] -o samples -t truth\n"
+            "       modes_gen score truth output\n");
+    return 1;
+}
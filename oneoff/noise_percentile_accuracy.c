@@ -0,0 +1,148 @@
+/* compares the noise floor percentile measured by adaptive gain control
+ * (log-scale histogram of every 4th sample) against the exact percentile
+ * of all samples, block by block, for a UC8-format capture
+ *
+ * usage: noise_percentile_accuracy capture.uc8 [percentile [block_samples]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "dsp-types.h"
+#include "dsp/generated/starch.h"
+#include "dsp/helpers/log_histogram.h"
+
+// matches adaptive.c
+static const unsigned stride = 4;
+static const double tolerance_db = 0.25;
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// find the exact value at (percentile + offset/10) percent; the radix
+// histogram is built when offset is 0 and reused for other offsets
+static unsigned exact_percentile(const uint16_t *mag, unsigned len, unsigned percentile, int offset)
+{
+    static unsigned radix[65536];
+
+    if (offset == 0) {
+        memset(radix, 0, sizeof(radix));
+        for (unsigned i = 0; i < len; ++i)
+            ++radix[mag[i]];
+    }
+
+    unsigned count_n = (unsigned) ((double) len * (percentile * 10 + offset) / 1000);
+    unsigned n = 0, i = 0;
+    while (i < 65536 && n <= count_n)
+        n += radix[i++];
+    return i - 1;
+}
+
+static double estimated_percentile(const uint16_t *mag, unsigned len, unsigned percentile)
+{
+    static unsigned histogram[LOG_HISTOGRAM_BUCKETS];
+    memset(histogram, 0, sizeof(histogram));
+
+    starch_histogram_log_u16(mag, len, stride, histogram);
+
+    unsigned count_n = (len + stride - 1) / stride * percentile / 100;
+    unsigned n = 0, i = 0;
+    while (i < LOG_HISTOGRAM_BUCKETS && n + histogram[i] <= count_n)
+        n += histogram[i++];
+
+    if (i >= LOG_HISTOGRAM_BUCKETS)
+        return 65535;
+    return log_histogram_bucket_low(i) + (count_n - n) * log_histogram_bucket_width(i) / histogram[i];
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s capture.uc8 [percentile [block_samples]]\n", argv[0]);
+        return 1;
+    }
+
+    unsigned percentile = (argc > 2 ? (unsigned) atoi(argv[2]) : 40);
+    unsigned block = (argc > 3 ? (unsigned) atoi(argv[3]) : 1200000);
+
+    FILE *fp = fopen(argv[1], "rb");
+    if (!fp) {
+        perror("fopen");
+        return 1;
+    }
+
+    uc8_t *in = malloc(block * sizeof(uc8_t));
+    uint16_t *mag = malloc(block * sizeof(uint16_t));
+    if (!in || !mag) {
+        fprintf(stderr, "can't allocate buffers\n");
+        return 1;
+    }
+
+    unsigned blocks = 0;
+    double sum_error = 0, max_error = 0, max_band_error = 0;
+    double exact_ns = 0, estimate_ns = 0;
+    size_t len;
+
+    while ((len = fread(in, sizeof(uc8_t), block, fp)) == block) {
+        struct timespec start, middle, end;
+
+        starch_magnitude_uc8(in, mag, len);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        unsigned exact = exact_percentile(mag, len, percentile, 0);
+        clock_gettime(CLOCK_MONOTONIC, &middle);
+        double estimate = estimated_percentile(mag, len, percentile);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        // A percentile that falls on a gap between sample values (common at
+        // low signal levels, where magnitudes are coarsely quantized) can
+        // move a long way with a tiny change in the sample. So also accept
+        // anything within the exact (percentile +/- 0.5%) range.
+        unsigned band_low = exact_percentile(mag, len, percentile, -5);
+        unsigned band_high = exact_percentile(mag, len, percentile, +5);
+
+        exact_ns += elapsed_ns(&start, &middle);
+        estimate_ns += elapsed_ns(&middle, &end);
+
+        double exact_db = 20 * log10((exact > 0 ? exact : 1) / 65536.0);
+        double estimate_db = 20 * log10((estimate > 0 ? estimate : 1) / 65536.0);
+        double error = fabs(estimate_db - exact_db);
+
+        double band_error = 0;
+        if (estimate < band_low)
+            band_error = 20 * log10((band_low > 0 ? band_low : 1) / (estimate > 0 ? estimate : 1));
+        else if (estimate > band_high)
+            band_error = 20 * log10(estimate / (band_high > 0 ? band_high : 1));
+
+        printf("block %4u: exact %5u (%6.2f dBFS, range %u..%u)  estimate %8.1f (%6.2f dBFS)  error %.3f dB  outside range %.3f dB\n",
+               blocks, exact, exact_db, band_low, band_high, estimate, estimate_db, error, band_error);
+
+        sum_error += error;
+        if (error > max_error)
+            max_error = error;
+        if (band_error > max_band_error)
+            max_band_error = band_error;
+        ++blocks;
+    }
+
+    fclose(fp);
+    free(in);
+    free(mag);
+
+    if (!blocks) {
+        fprintf(stderr, "capture is shorter than one block\n");
+        return 1;
+    }
+
+    printf("%u blocks of %u samples, %u%% percentile: mean error %.3f dB, max error %.3f dB, max outside +/-0.5%% range %.3f dB (tolerance %.2f dB)\n",
+           blocks, block, percentile, sum_error / blocks, max_error, max_band_error, tolerance_db);
+    printf("exact: %.2f ns/sample, estimate: %.2f ns/sample\n",
+           exact_ns / blocks / block, estimate_ns / blocks / block);
+
+    return (max_band_error <= tolerance_db ? 0 : 1);
+}
@@ -0,0 +1,508 @@
+/* receiver and benchmark for dump1090's UDP output (--net-udp)
+ *
+ *   udp_fanout recv [-o] [-i interface] address:port
+ *
+ *     Listens on a UDP port, joining the group if 'address' is a multicast
+ *     address, and reports once a second the datagrams, messages and bytes
+ *     received, and the datagrams lost or reordered according to the sequence
+ *     numbers in the datagram headers. -o also writes the messages to stdout,
+ *     so they can be piped into a tool expecting the TCP output. -i selects the
+ *     interface to join the group on: a local address for IPv4, an interface
+ *     name for IPv6.
+ *
+ *   udp_fanout bench -p pid [-t seconds] [-c connections] [-l] tcp host:port
+ *   udp_fanout bench -p pid [-t seconds] [-i interface] udp address:port
+ *
+ *     Consumes the output of the dump1090 with process id 'pid' for 'seconds'
+ *     (default 10), either over 'connections' TCP connections (default 1) or
+ *     as a UDP receiver, and reports the messages received by one consumer
+ *     and the CPU time dump1090 used per message. Messages are counted as
+ *     Beast frames, or as lines with -l (the UDP header gives the format).
+ *
+ * To compare the two on loopback, feed dump1090 a steady load, e.g. with
+ * oneoff/beast_replay into --net-bi-port, and run the tcp benchmark with a
+ * growing number of connections and then the udp one against --net-udp.
+ *
+ * Reading dump1090's CPU time uses /proc, so bench only works on Linux.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#define UDP_HEADER 8
+
+static volatile sig_atomic_t exiting;
+
+static void sigintHandler(int sig)
+{
+    (void) sig;
+    exiting = 1;
+}
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Counts messages in a byte stream that may be split anywhere
+struct message_counter {
+    bool lines;        // count lines rather than Beast frames
+    bool escape;       // last byte was an unpaired 0x1a
+    uint64_t messages;
+};
+
+static void countMessages(struct message_counter *mc, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (mc->lines) {
+            if (buf[i] == '\n')
+                ++mc->messages;
+        } else if (mc->escape) {
+            // 0x1a 0x1a is an escaped data byte; 0x1a '1'..'5' starts a frame
+            if (buf[i] >= '1' && buf[i] <= '5')
+                ++mc->messages;
+            mc->escape = false;
+        } else if (buf[i] == 0x1a) {
+            mc->escape = true;
+        }
+    }
+}
+
+static bool splitHostPort(const char *hostport, char *host, size_t hostlen, const char **port)
+{
+    const char *colon = strrchr(hostport, ':');
+    if (!colon || colon == hostport || (size_t) (colon - hostport) >= hostlen) {
+        fprintf(stderr, "%s: expected host:port\n", hostport);
+        return false;
+    }
+
+    // allow [v6addr]:port
+    const char *start = hostport;
+    const char *end = colon;
+    if (*start == '[' && end[-1] == ']') {
+        ++start;
+        --end;
+    }
+    memcpy(host, start, end - start);
+    host[end - start] = 0;
+    *port = colon + 1;
+    return true;
+}
+
+static int connectTo(const char *hostport)
+{
+    char host[256];
+    const char *port;
+    if (!splitHostPort(hostport, host, sizeof(host), &port))
+        return -1;
+
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    int err = getaddrinfo(host, port, &hints, &res);
+    if (err) {
+        fprintf(stderr, "%s: %s\n", hostport, gai_strerror(err));
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai; ai = ai->ai_next) {
+        if ((fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol)) < 0)
+            continue;
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+            break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+
+    if (fd < 0)
+        fprintf(stderr, "%s: can't connect: %s\n", hostport, strerror(errno));
+    return fd;
+}
+
+// Open a UDP socket bound to the port, joined to the group if the address is
+// a multicast address
+static int openReceiver(const char *hostport, const char *iface)
+{
+    char host[256];
+    const char *port;
+    if (!splitHostPort(hostport, host, sizeof(host), &port))
+        return -1;
+
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    int err = getaddrinfo(host, port, &hints, &res);
+    if (err) {
+        fprintf(stderr, "%s: %s\n", hostport, gai_strerror(err));
+        return -1;
+    }
+
+    int family = res->ai_family;
+    int fd = socket(family, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        freeaddrinfo(res);
+        return -1;
+    }
+
+    // several receivers on one host can share a multicast port
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    int rcvbuf = 4 * 1024 * 1024;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    int rc = 0;
+    if (family == AF_INET) {
+        struct sockaddr_in *dest = (struct sockaddr_in *) res->ai_addr;
+        struct sockaddr_in bind_addr;
+        memset(&bind_addr, 0, sizeof(bind_addr));
+        bind_addr.sin_family = AF_INET;
+        bind_addr.sin_port = dest->sin_port;
+        bind_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        rc = bind(fd, (struct sockaddr *) &bind_addr, sizeof(bind_addr));
+
+        if (!rc && IN_MULTICAST(ntohl(dest->sin_addr.s_addr))) {
+            struct ip_mreq mreq;
+            mreq.imr_multiaddr = dest->sin_addr;
+            mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (iface && inet_pton(AF_INET, iface, &mreq.imr_interface) != 1) {
+                fprintf(stderr, "%s: -i must be a local IPv4 address\n", iface);
+                rc = -1;
+                errno = EINVAL;
+            }
+            if (!rc)
+                rc = setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+        }
+    } else {
+        struct sockaddr_in6 *dest = (struct sockaddr_in6 *) res->ai_addr;
+        struct sockaddr_in6 bind_addr;
+        memset(&bind_addr, 0, sizeof(bind_addr));
+        bind_addr.sin6_family = AF_INET6;
+        bind_addr.sin6_port = dest->sin6_port;
+        bind_addr.sin6_addr = in6addr_any;
+        rc = bind(fd, (struct sockaddr *) &bind_addr, sizeof(bind_addr));
+
+        if (!rc && IN6_IS_ADDR_MULTICAST(&dest->sin6_addr)) {
+            struct ipv6_mreq mreq;
+            mreq.ipv6mr_multiaddr = dest->sin6_addr;
+            mreq.ipv6mr_interface = iface ? if_nametoindex(iface) : 0;
+            rc = setsockopt(fd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq));
+        }
+    }
+    freeaddrinfo(res);
+
+    if (rc < 0) {
+        fprintf(stderr, "%s: can't listen: %s\n", hostport, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sequence tracking for one UDP stream
+struct udp_stats {
+    bool started;
+    uint32_t next_seq;
+    uint64_t datagrams;
+    uint64_t bytes;
+    uint64_t lost;
+    uint64_t reordered;
+};
+
+// Check a datagram; returns the payload length, or -1 if it isn't one of ours
+static int receiveDatagram(struct udp_stats *st, struct message_counter *mc, const uint8_t *buf, ssize_t len)
+{
+    if (len < UDP_HEADER || buf[0] != 'M' || buf[1] != 'U' || buf[2] != 1)
+        return -1;
+
+    uint32_t seq = ((uint32_t) buf[4] << 24) | ((uint32_t) buf[5] << 16) | ((uint32_t) buf[6] << 8) | buf[7];
+    if (!st->started) {
+        st->started = true;
+    } else if (seq != st->next_seq) {
+        int32_t delta = (int32_t) (seq - st->next_seq);
+        if (delta > 0 && delta < 1000000) {
+            st->lost += delta;
+        } else if (delta < 0 && delta > -1000) {
+            // late arrival of a datagram already counted as lost
+            ++st->reordered;
+            if (st->lost)
+                --st->lost;
+            seq = st->next_seq - 1;
+        }
+        // anything else: the sender restarted, resynchronize
+    }
+    st->next_seq = seq + 1;
+
+    ++st->datagrams;
+    st->bytes += len - UDP_HEADER;
+    mc->lines = (buf[3] != 'B');
+    countMessages(mc, buf + UDP_HEADER, len - UDP_HEADER);
+    return len - UDP_HEADER;
+}
+
+//
+// Receiver
+//
+
+static int recvCommand(int argc, char **argv)
+{
+    bool output = false;
+    const char *iface = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "oi:")) != -1) {
+        switch (opt) {
+        case 'o': output = true; break;
+        case 'i': iface = optarg; break;
+        default: return 2;
+        }
+    }
+
+    if (optind + 1 != argc) {
+        fprintf(stderr, "usage: udp_fanout recv [-o] [-i interface] address:port\n");
+        return 2;
+    }
+
+    int fd = openReceiver(argv[optind], iface);
+    if (fd < 0)
+        return 1;
+
+    struct udp_stats st = { 0 };
+    struct message_counter mc = { 0 };
+    struct udp_stats last = st;
+    uint64_t last_messages = 0;
+    uint64_t next_report = now_us() + 1000000;
+    uint8_t buf[65536];
+
+    while (!exiting) {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        if (poll(&pfd, 1, 100) < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+
+        if (pfd.revents & POLLIN) {
+            ssize_t len = recv(fd, buf, sizeof(buf), 0);
+            if (len < 0 && errno != EINTR && errno != EAGAIN) {
+                perror("recv");
+                break;
+            }
+            if (receiveDatagram(&st, &mc, buf, len) > 0 && output) {
+                fwrite(buf + UDP_HEADER, 1, len - UDP_HEADER, stdout);
+                fflush(stdout);
+            }
+        }
+
+        uint64_t now = now_us();
+        if (now >= next_report) {
+            fprintf(stderr, "%8.0f datagrams/s %8.0f msg/s %8.3f MB/s   lost %" PRIu64 " reordered %" PRIu64 "\n",
+                    (double) (st.datagrams - last.datagrams),
+                    (double) (mc.messages - last_messages),
+                    (st.bytes - last.bytes) / 1e6,
+                    st.lost, st.reordered);
+            last = st;
+            last_messages = mc.messages;
+            next_report += 1000000;
+        }
+    }
+
+    fprintf(stderr, "total: %" PRIu64 " datagrams, %" PRIu64 " messages, %" PRIu64 " lost, %" PRIu64 " reordered\n",
+            st.datagrams, mc.messages, st.lost, st.reordered);
+    close(fd);
+    return 0;
+}
+
+//
+// Benchmark
+//
+
+// user + system CPU time of a process, in microseconds
+static bool processCpu(int pid, uint64_t *cpu_us)
+{
+    char path[64], buf[1024];
+    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+    size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = 0;
+
+    // fields after the command name, which is in parentheses and may contain spaces
+    char *p = strrchr(buf, ')');
+    unsigned long utime, stime;
+    if (!p || sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) != 2)
+        return false;
+
+    long ticks = sysconf(_SC_CLK_TCK);
+    *cpu_us = (uint64_t) (utime + stime) * 1000000 / ticks;
+    return true;
+}
+
+static int benchCommand(int argc, char **argv)
+{
+    int pid = 0;
+    double duration = 10;
+    int connections = 1;
+    bool lines = false;
+    const char *iface = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:t:c:li:")) != -1) {
+        switch (opt) {
+        case 'p': pid = atoi(optarg); break;
+        case 't': duration = atof(optarg); break;
+        case 'c': connections = atoi(optarg); break;
+        case 'l': lines = true; break;
+        case 'i': iface = optarg; break;
+        default: return 2;
+        }
+    }
+
+    if (optind + 2 != argc || pid <= 0 || connections < 1 || duration <= 0 ||
+        (strcmp(argv[optind], "tcp") && strcmp(argv[optind], "udp"))) {
+        fprintf(stderr,
+                "usage: udp_fanout bench -p pid [-t seconds] [-c connections] [-l] tcp host:port\n"
+                "       udp_fanout bench -p pid [-t seconds] [-i interface] udp address:port\n");
+        return 2;
+    }
+
+    bool udp = !strcmp(argv[optind], "udp");
+    const char *target = argv[optind + 1];
+    if (udp)
+        connections = 1;
+
+    struct pollfd *pfds = calloc(connections, sizeof(*pfds));
+    if (!pfds) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    int nfds = 0;
+    for (; nfds < connections; ++nfds) {
+        int fd = udp ? openReceiver(target, iface) : connectTo(target);
+        if (fd < 0)
+            goto fail;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        pfds[nfds].fd = fd;
+        pfds[nfds].events = POLLIN;
+    }
+
+    // let the connections settle before measuring
+    usleep(500000);
+
+    struct message_counter mc = { .lines = lines };
+    struct udp_stats st = { 0 };
+    uint64_t cpu_start, cpu_end;
+    if (!processCpu(pid, &cpu_start)) {
+        fprintf(stderr, "can't read CPU time of process %d\n", pid);
+        goto fail;
+    }
+
+    uint64_t start = now_us();
+    uint64_t end = start + (uint64_t) (duration * 1e6);
+    uint8_t buf[65536];
+
+    while (!exiting && now_us() < end) {
+        if (poll(pfds, nfds, 100) < 0 && errno != EINTR) {
+            perror("poll");
+            goto fail;
+        }
+
+        for (int i = 0; i < nfds; ++i) {
+            if (!(pfds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+
+            for (;;) {
+                ssize_t len = recv(pfds[i].fd, buf, sizeof(buf), 0);
+                if (len == 0) {
+                    fprintf(stderr, "connection %d closed by dump1090\n", i);
+                    goto fail;
+                }
+                if (len < 0)
+                    break;
+
+                // all consumers see the same stream; count one of them
+                if (udp)
+                    receiveDatagram(&st, &mc, buf, len);
+                else if (i == 0)
+                    countMessages(&mc, buf, len);
+            }
+        }
+    }
+
+    double elapsed = (now_us() - start) / 1e6;
+    if (!processCpu(pid, &cpu_end)) {
+        fprintf(stderr, "can't read CPU time of process %d\n", pid);
+        goto fail;
+    }
+
+    double cpu = (cpu_end - cpu_start) / 1e6;
+    printf("%s, %d consumer%s: %.0f msg/s received, dump1090 CPU %.1f%%, %.2f us CPU per message",
+           udp ? "udp" : "tcp", connections, connections == 1 ? "" : "s",
+           mc.messages / elapsed, 100.0 * cpu / elapsed,
+           mc.messages ? cpu * 1e6 / mc.messages : 0.0);
+    if (udp)
+        printf(", %" PRIu64 " datagrams lost", st.lost);
+    printf("\n");
+
+    for (int i = 0; i < nfds; ++i)
+        close(pfds[i].fd);
+    free(pfds);
+    return 0;
+
+ fail:
+    for (int i = 0; i < nfds; ++i)
+        close(pfds[i].fd);
+    free(pfds);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr,
+                "usage: udp_fanout recv [-o] [-i interface] address:port\n"
+                "       udp_fanout bench -p pid [-t seconds] [-c connections] [-l] tcp host:port\n"
+                "       udp_fanout bench -p pid [-t seconds] [-i interface] udp address:port\n");
+        return 2;
+    }
+
+    signal(SIGINT, sigintHandler);
+    signal(SIGTERM, sigintHandler);
+    signal(SIGPIPE, SIG_IGN);
+
+    if (!strcmp(argv[1], "recv"))
+        return recvCommand(argc - 1, argv + 1);
+    if (!strcmp(argv[1], "bench"))
+        return benchCommand(argc - 1, argv + 1);
+
+    fprintf(stderr, "unknown command '%s'\n", argv[1]);
+    return 2;
+}
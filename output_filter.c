@@ -0,0 +1,368 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// output_filter.c: per-client subscription filters for network output
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <stdarg.h>
+
+#define EMPTY 0xFFFFFFFF
+
+struct output_filter {
+    struct output_filter *next;   // list of all filters in use
+    unsigned refcount;
+    char *spec;                   // canonical text, used to share equivalent filters
+
+    bool has_df;
+    uint32_t df_mask;             // bit N set: accept DF N
+
+    uint32_t *addrs;              // open-addressed hash set of addresses, or NULL if no addr term
+    unsigned addr_mask;           // hash table size - 1
+    unsigned addr_count;
+
+    bool has_box;
+    double south, west, north, east;
+
+    bool has_rssi;
+    double min_rssi;              // dBFS, as given
+    double min_signal;            // the same, as a signalLevel fraction
+
+    uint64_t seq;                 // message sequence number of the cached result
+    bool result;
+};
+
+static struct output_filter *filters;
+
+static uint32_t addrHash(uint32_t addr)
+{
+    return (addr * 2654435761U) >> 8;
+}
+
+static bool addrSetTest(const struct output_filter *f, uint32_t addr)
+{
+    for (unsigned h = addrHash(addr) & f->addr_mask; f->addrs[h] != EMPTY; h = (h + 1) & f->addr_mask) {
+        if (f->addrs[h] == addr)
+            return true;
+    }
+    return false;
+}
+
+static void addrSetAdd(struct output_filter *f, uint32_t addr)
+{
+    unsigned h = addrHash(addr) & f->addr_mask;
+    while (f->addrs[h] != EMPTY) {
+        if (f->addrs[h] == addr)
+            return;
+        h = (h + 1) & f->addr_mask;
+    }
+    f->addrs[h] = addr;
+    ++f->addr_count;
+}
+
+static int compareAddr(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+    return (x > y) - (x < y);
+}
+
+static void freeFilter(struct output_filter *f)
+{
+    if (!f)
+        return;
+    free(f->addrs);
+    free(f->spec);
+    free(f);
+}
+
+// Parse a comma-separated list of up to 'max' doubles
+static int parseDoubles(char *value, double *out, int max)
+{
+    int n = 0;
+    char *saveptr = NULL;
+    for (char *tok = strtok_r(value, ",", &saveptr); tok; tok = strtok_r(NULL, ",", &saveptr)) {
+        char *end;
+        if (n >= max)
+            return -1;
+        out[n++] = strtod(tok, &end);
+        if (end == tok || *end || !isfinite(out[n-1]))
+            return -1;
+    }
+    return n;
+}
+
+// Append to a fixed-size buffer; output that doesn't fit is dropped, and
+// *p never moves past end - 1
+static void appendf(char **p, char *end, const char *fmt, ...)
+{
+    if (*p >= end - 1)
+        return;
+
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(*p, end - *p, fmt, ap);
+    va_end(ap);
+
+    if (n < 0)
+        return;
+    *p += ((size_t) n < (size_t) (end - *p) ? (size_t) n : (size_t) (end - *p - 1));
+}
+
+// Build the canonical text for a parsed filter
+static char *canonicalSpec(const struct output_filter *f)
+{
+    // "df=" + 25 x "NN,"; "addr=" + N x "xxxxxx,"; "box=" + 4 x "-180.000000,";
+    // "rssi=-100.0"; separating spaces and the NUL
+    size_t size = 4 + 25 * 3 + 5 + (size_t) f->addr_count * 7 + 4 + 4 * 12 + 11 + 4 + 1;
+    char *buf = malloc(size);
+    if (!buf)
+        return NULL;
+
+    char *p = buf, *end = buf + size;
+    *p = 0;
+    if (f->has_df) {
+        const char *sep = "df=";
+        for (unsigned df = 0; df < 32; ++df) {
+            if (f->df_mask & (1U << df)) {
+                appendf(&p, end, "%s%u", sep, df);
+                sep = ",";
+            }
+        }
+        appendf(&p, end, " ");
+    }
+
+    if (f->addrs) {
+        uint32_t *sorted = malloc(f->addr_count * sizeof(uint32_t));
+        if (!sorted) {
+            free(buf);
+            return NULL;
+        }
+
+        unsigned n = 0;
+        for (unsigned h = 0; h <= f->addr_mask; ++h) {
+            if (f->addrs[h] != EMPTY)
+                sorted[n++] = f->addrs[h];
+        }
+        qsort(sorted, n, sizeof(uint32_t), compareAddr);
+
+        const char *sep = "addr=";
+        for (unsigned i = 0; i < n; ++i) {
+            appendf(&p, end, "%s%06x", sep, sorted[i]);
+            sep = ",";
+        }
+        appendf(&p, end, " ");
+        free(sorted);
+    }
+
+    if (f->has_box)
+        appendf(&p, end, "box=%.6f,%.6f,%.6f,%.6f ", f->south, f->west, f->north, f->east);
+
+    if (f->has_rssi)
+        appendf(&p, end, "rssi=%.1f ", f->min_rssi);
+
+    // drop the trailing space
+    if (p > buf && p[-1] == ' ')
+        --p;
+    *p = 0;
+    return buf;
+}
+
+bool outputFilterParse(const char *spec, struct output_filter **out, char *err, size_t errlen)
+{
+    struct output_filter *f = NULL;
+    char *copy = NULL;
+    bool ok = false;
+
+    *out = NULL;
+
+    if (!(f = calloc(1, sizeof(*f))) || !(copy = strdup(spec))) {
+        snprintf(err, errlen, "out of memory");
+        goto done;
+    }
+
+    // size the address table from an upper bound on the number of addresses
+    unsigned max_addrs = strlen(spec) / 2 + 1;
+    unsigned addr_size = 8;
+    while (addr_size < max_addrs * 2)
+        addr_size <<= 1;
+
+    char *saveptr = NULL;
+    for (char *term = strtok_r(copy, " \t\r\n", &saveptr); term; term = strtok_r(NULL, " \t\r\n", &saveptr)) {
+        char *value = strchr(term, '=');
+        if (!value || !value[1]) {
+            snprintf(err, errlen, "expected key=value, got '%s'", term);
+            goto done;
+        }
+        *value++ = 0;
+
+        char *valueptr = NULL;
+        if (!strcmp(term, "df")) {
+            f->has_df = true;
+            for (char *tok = strtok_r(value, ",", &valueptr); tok; tok = strtok_r(NULL, ",", &valueptr)) {
+                char *end;
+                unsigned long df = strtoul(tok, &end, 10);
+                if (end == tok || *end || df > 24) {
+                    snprintf(err, errlen, "bad downlink format '%s'", tok);
+                    goto done;
+                }
+                f->df_mask |= 1U << df;
+            }
+        } else if (!strcmp(term, "addr")) {
+            if (!f->addrs) {
+                if (!(f->addrs = malloc(addr_size * sizeof(uint32_t)))) {
+                    snprintf(err, errlen, "out of memory");
+                    goto done;
+                }
+                memset(f->addrs, 0xFF, addr_size * sizeof(uint32_t));
+                f->addr_mask = addr_size - 1;
+            }
+            for (char *tok = strtok_r(value, ",", &valueptr); tok; tok = strtok_r(NULL, ",", &valueptr)) {
+                char *end;
+                unsigned long addr = strtoul(tok, &end, 16);
+                if (end == tok || *end || addr > 0xFFFFFF) {
+                    snprintf(err, errlen, "bad address '%s'", tok);
+                    goto done;
+                }
+                addrSetAdd(f, addr);
+            }
+        } else if (!strcmp(term, "box")) {
+            double v[4];
+            if (parseDoubles(value, v, 4) != 4 ||
+                v[0] < -90 || v[0] > 90 || v[2] < -90 || v[2] > 90 ||
+                v[1] < -180 || v[1] > 180 || v[3] < -180 || v[3] > 180) {
+                snprintf(err, errlen, "box needs south,west,north,east");
+                goto done;
+            }
+            f->has_box = true;
+            f->south = (v[0] < v[2] ? v[0] : v[2]);
+            f->north = (v[0] < v[2] ? v[2] : v[0]);
+            f->west = v[1];
+            f->east = v[3];
+        } else if (!strcmp(term, "rssi")) {
+            double v;
+            if (parseDoubles(value, &v, 1) != 1 || v < OUTPUT_FILTER_MIN_RSSI || v > 0) {
+                snprintf(err, errlen, "bad minimum RSSI '%s'", value);
+                goto done;
+            }
+            f->has_rssi = true;
+            f->min_rssi = v;
+            f->min_signal = pow(10, v / 10);
+        } else {
+            snprintf(err, errlen, "unknown filter term '%s'", term);
+            goto done;
+        }
+    }
+
+    ok = true;
+    if (!f->has_df && !f->addrs && !f->has_box && !f->has_rssi) {
+        // matches everything
+        goto done;
+    }
+
+    if (!(f->spec = canonicalSpec(f))) {
+        snprintf(err, errlen, "out of memory");
+        ok = false;
+        goto done;
+    }
+
+    // share an existing equivalent filter, if there is one
+    for (struct output_filter *existing = filters; existing; existing = existing->next) {
+        if (!strcmp(existing->spec, f->spec)) {
+            *out = outputFilterRetain(existing);
+            goto done;
+        }
+    }
+
+    f->refcount = 1;
+    f->next = filters;
+    filters = f;
+    *out = f;
+    f = NULL;
+
+ done:
+    free(copy);
+    freeFilter(f);
+    return ok;
+}
+
+struct output_filter *outputFilterRetain(struct output_filter *filter)
+{
+    if (filter)
+        ++filter->refcount;
+    return filter;
+}
+
+void outputFilterRelease(struct output_filter *filter)
+{
+    if (!filter || --filter->refcount > 0)
+        return;
+
+    for (struct output_filter **prev = &filters; *prev; prev = &(*prev)->next) {
+        if (*prev == filter) {
+            *prev = filter->next;
+            break;
+        }
+    }
+    freeFilter(filter);
+}
+
+const char *outputFilterSpec(const struct output_filter *filter)
+{
+    return filter ? filter->spec : "";
+}
+
+static bool evaluateFilter(const struct output_filter *f, const struct modesMessage *mm, const struct aircraft *a)
+{
+    if (f->has_df && (mm->msgtype >= 32 || !(f->df_mask & (1U << mm->msgtype))))
+        return false;
+
+    if (f->has_rssi && mm->signalLevel < f->min_signal)
+        return false;
+
+    if (f->addrs && (mm->msgtype == 32 || !addrSetTest(f, mm->addr)))
+        return false;
+
+    if (f->has_box) {
+        double lat, lon;
+        if (mm->cpr_decoded) {
+            lat = mm->decoded_lat;
+            lon = mm->decoded_lon;
+        } else if (a && trackDataValid(&a->position_valid)) {
+            lat = a->lat;
+            lon = a->lon;
+        } else {
+            return false;
+        }
+
+        if (lat < f->south || lat > f->north)
+            return false;
+        if (f->west <= f->east ? (lon < f->west || lon > f->east) : (lon < f->west && lon > f->east))
+            return false;
+    }
+
+    return true;
+}
+
+bool outputFilterMatch(struct output_filter *filter, const struct modesMessage *mm, const struct aircraft *a, uint64_t seq)
+{
+    if (!filter)
+        return true;
+
+    if (filter->seq != seq) {
+        filter->result = evaluateFilter(filter, mm, a);
+        filter->seq = seq;
+    }
+    return filter->result;
+}
@@ -0,0 +1,60 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// output_filter.h: per-client subscription filters for network output
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_OUTPUT_FILTER_H
+#define DUMP1090_OUTPUT_FILTER_H
+
+// A compiled output filter. Filters are shared: parsing a filter that is
+// equivalent to one already in use returns the existing filter with its
+// reference count increased, so identical filters can be recognized by
+// comparing pointers.
+//
+// A filter is a space-separated list of terms, all of which must match:
+//
+//   df=17,18                   downlink formats (0..24)
+//   addr=4840d6,a1b2c3         ICAO addresses (hex)
+//   box=s,w,n,e                position within a lat/lon box; w > e crosses
+//                              the antimeridian
+//   rssi=-20                   minimum signal level, dBFS (-100..0)
+//
+// A message with no known position never matches a box term; Mode A/C
+// messages (which have no DF or address) never match df or addr terms.
+
+#define OUTPUT_FILTER_MIN_RSSI -100.0   // lowest accepted rssi term, dBFS
+
+struct modesMessage;
+struct aircraft;
+struct output_filter;
+
+// Parse a filter specification. On success, returns true and stores the
+// filter in *out; an empty specification stores NULL (no filtering).
+// On failure, returns false and stores a description of the problem in err.
+bool outputFilterParse(const char *spec, struct output_filter **out, char *err, size_t errlen);
+
+// Add / release a reference to a filter. Both accept NULL.
+struct output_filter *outputFilterRetain(struct output_filter *filter);
+void outputFilterRelease(struct output_filter *filter);
+
+// Canonical text of a filter, or "" for NULL
+const char *outputFilterSpec(const struct output_filter *filter);
+
+// Test a message against a filter (NULL matches everything). The result is
+// cached against 'seq', so repeated tests of the same message against the
+// same filter are free; seq must change for each new message.
+bool outputFilterMatch(struct output_filter *filter, const struct modesMessage *mm, const struct aircraft *a, uint64_t seq);
+
+#endif
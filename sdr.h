@@ -31,6 +31,10 @@ void sdrRun();
 void sdrStop();
 void sdrClose();
 
+// Number of inputs the selected SDR type will feed into the FIFO (see mag_buf.input);
+// valid once options have been handled
+unsigned sdrInputCount();
+
 // Gain control
 int sdrGetGain();              // return current gain step 0..N, or -1 if gain control is not supported
 int sdrGetMaxGain();           // return maximum gain step, or -1 if gain control is not supported
@@ -39,6 +43,8 @@ int sdrSetGain(int step);      // set gain step; return actual gain step used, o
 
 // Call periodically from the SDR read thread to update reader thread CPU stats:
 void sdrMonitor();
+// .. or from an additional reader thread, which keeps its own start time
+void sdrMonitorThread(struct timespec *start);
 // Retrieve CPU stats and add new CPU time to *addTo
 void sdrUpdateCPUTime(struct timespec *addTo);
 
@@ -228,7 +228,7 @@ bool bladeRFOpen()
         goto error;
     }
 
-    if ((status = bladerf_set_sample_rate(BladeRF.device, BLADERF_MODULE_RX, Modes.sample_rate * BladeRF.decimation, NULL)) < 0) {
+    if ((status = bladerf_set_sample_rate(BladeRF.device, BLADERF_MODULE_RX, Modes.input_sample_rate * BladeRF.decimation, NULL)) < 0) {
         fprintf(stderr, "bladerf_set_sample_rate failed: %s\n", bladerf_strerror(status));
         goto error;
     }
@@ -282,6 +282,7 @@ bool bladeRFOpen()
     show_config();
 
     BladeRF.converter = init_converter(INPUT_SC16Q11,
+                                       Modes.input_sample_rate,
                                        Modes.sample_rate,
                                        Modes.dc_filter,
                                        &BladeRF.converter_state);
@@ -290,6 +291,10 @@ bool bladeRFOpen()
         goto error;
     }
 
+    if (!burstRecordStart(INPUT_SC16Q11, Modes.input_sample_rate)) {
+        goto error;
+    }
+
     return true;
 
  error:
@@ -385,8 +390,9 @@ static void *handle_bladerf_samples(struct bladerf *dev,
             }
             outbuf->dropped = dropped;
             outbuf->validLength = outbuf->overlap;
-            outbuf->sampleTimestamp = metadata_timestamp * 12e6 / Modes.sample_rate / BladeRF.decimation;
-            outbuf->sysTimestamp = entryTimestamp + (num_samples - offset / 4) * 1000 / Modes.sample_rate / BladeRF.decimation;
+            // (a resampling converter's output starts with samples it held over)
+            outbuf->sampleTimestamp = ((double) metadata_timestamp / BladeRF.decimation - converter_carry(BladeRF.converter_state)) * 12e6 / Modes.input_sample_rate;
+            outbuf->sysTimestamp = entryTimestamp + (num_samples - offset / 4) * 1000 / Modes.input_sample_rate / BladeRF.decimation;
             outbuf->mean_level = 0;
             outbuf->mean_power = 0;
 
@@ -396,8 +402,9 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 
         // Convert one block of sample data
         double mean_level, mean_power;
-        BladeRF.converter(sample_data, &outbuf->data[outbuf->validLength], samples_per_block, BladeRF.converter_state, &mean_level, &mean_power);
-        outbuf->validLength += samples_per_block;
+        unsigned converted = BladeRF.converter(sample_data, &outbuf->data[outbuf->validLength], samples_per_block, BladeRF.converter_state, &mean_level, &mean_power, NULL);
+        burstRecordSamples(sample_data, samples_per_block, metadata_timestamp / BladeRF.decimation, &outbuf->data[outbuf->validLength], converted);
+        outbuf->validLength += converted;
         outbuf->mean_level += mean_level;
         outbuf->mean_power += mean_power;
         nextTimestamp = metadata_timestamp + samples_per_block * BladeRF.decimation;
@@ -438,7 +445,7 @@ void bladeRFRun()
         goto out;
     }
 
-    unsigned ms_per_transfer = 1000 * MODES_MAG_BUF_SAMPLES / Modes.sample_rate;
+    unsigned ms_per_transfer = 1000 * MODES_MAG_BUF_SAMPLES / Modes.input_sample_rate;
     if ((status = bladerf_set_stream_timeout(BladeRF.device, BLADERF_MODULE_RX, ms_per_transfer * (transfers + 2))) < 0) {
         fprintf(stderr, "bladerf_set_stream_timeout() failed: %s\n", bladerf_strerror(status));
         goto out;
@@ -199,6 +199,7 @@ bool hackRFOpen()
     show_config();
 
     HackRF.converter = init_converter(INPUT_UC8,
+                                      HackRF.rate,
                                       Modes.sample_rate,
                                       Modes.dc_filter,
                                       &HackRF.converter_state);
@@ -207,6 +208,10 @@ bool hackRFOpen()
         return false;
     }
 
+    if (!burstRecordStart(INPUT_UC8, HackRF.rate)) {
+        return false;
+    }
+
     return true;
 }
 
@@ -249,11 +254,12 @@ static int handle_hackrf_samples(hackrf_transfer *transfer)
     dropped = 0;
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    // (a resampling converter's output starts with samples it held over)
+    outbuf->sampleTimestamp = (sampleCounter - converter_carry(HackRF.converter_state)) * 12e6 / HackRF.rate;
     sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
-    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
+    uint64_t block_duration = 1e3 * samples_read / HackRF.rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
@@ -264,8 +270,11 @@ static int handle_hackrf_samples(hackrf_transfer *transfer)
         dropped = samples_read - to_convert;
     }
 
-    HackRF.converter(buf, &outbuf->data[outbuf->overlap], to_convert, HackRF.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    unsigned converted = HackRF.converter(buf, &outbuf->data[outbuf->overlap], to_convert, HackRF.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->preamble_bitmap);
+    outbuf->flags |= MAGBUF_PREAMBLE_BITMAP;
+    outbuf->validLength = outbuf->overlap + converted;
+
+    burstRecordSamples(buf, to_convert, sampleCounter - samples_read, &outbuf->data[outbuf->overlap], converted);
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
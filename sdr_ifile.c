@@ -51,39 +51,68 @@
 #include "dump1090.h"
 #include "sdr_ifile.h"
 
-static struct {
+// One input file. With several --ifile options, each file is a separate
+// input (mag_buf.input) with its own reader thread; the first file is read
+// by the main SDR reader thread.
+struct ifile_input {
+    unsigned input;
     const char *filename;
-    input_format_t input_format;
-    bool throttle;
+    pthread_t thread;
 
     int fd;
+    input_format_t format;
     unsigned bytes_per_sample;
     unsigned bufsize;
     char *readbuf;
+    unsigned pending;            // bytes at the start of readbuf already read (while sniffing the file type)
+    struct decompressor *decompress;  // reading a compressed file, or NULL
+    struct burst_reader *burst;  // replaying a burst capture, or NULL
     iq_convert_fn converter;
     struct converter_state *converter_state;
+
+    struct timespec cpu_start;   // CPU time measurement for an extra reader thread
+};
+
+static struct {
+    input_format_t input_format;
+    bool throttle;
+    burst_gap_t burst_gap;
+
+    unsigned count;
+    struct ifile_input inputs[MODES_MAX_INPUTS];
 } ifile;
 
 void ifileInitConfig(void)
 {
-    ifile.filename = NULL;
     ifile.input_format = INPUT_UC8;
     ifile.throttle = false;
-    ifile.fd = -1;
-    ifile.bytes_per_sample = 0;
-    ifile.bufsize = 0;
-    ifile.readbuf = NULL;
-    ifile.converter = NULL;
-    ifile.converter_state = NULL;
+    ifile.burst_gap = BURST_GAP_NOISE;
+    ifile.count = 0;
+    for (unsigned i = 0; i < MODES_MAX_INPUTS; ++i) {
+        struct ifile_input *in = &ifile.inputs[i];
+        in->input = i;
+        in->filename = NULL;
+        in->fd = -1;
+        in->readbuf = NULL;
+        in->pending = 0;
+        in->decompress = NULL;
+        in->burst = NULL;
+        in->converter = NULL;
+        in->converter_state = NULL;
+    }
 }
 
 void ifileShowHelp()
 {
     printf("      ifile-specific options (use with --ifile)\n");
     printf("\n");
-    printf("--ifile <path>           read samples from given file ('-' for stdin)\n");
+    printf("--ifile <path>           read samples from given file ('-' for stdin);\n");
+    printf("                         repeat to decode several files at once;\n");
+    printf("                         zstd and xz compressed files are decompressed\n");
     printf("--iformat <type>         set sample format (UC8, SC16, SC16Q11)\n");
     printf("--throttle               process samples at the original capture speed\n");
+    printf("--burst-gap <fill>       fill the gaps in a --record-bursts capture with\n");
+    printf("                         'noise' (default) or 'zero' signal\n");
     printf("\n");
 }
 
@@ -94,7 +123,11 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
 
     if (!strcmp(argv[j], "--ifile") && more) {
         // implies --device-type ifile
-        ifile.filename = strdup(argv[++j]);
+        if (ifile.count == MODES_MAX_INPUTS) {
+            fprintf(stderr, "Too many --ifile options (at most %d)\n", MODES_MAX_INPUTS);
+            return false;
+        }
+        ifile.inputs[ifile.count++].filename = strdup(argv[++j]);
         Modes.sdr_type = SDR_IFILE;
     } else if (!strcmp(argv[j],"--iformat") && more) {
         ++j;
@@ -111,6 +144,17 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
         }
     } else if (!strcmp(argv[j],"--throttle")) {
         ifile.throttle = true;
+    } else if (!strcmp(argv[j],"--burst-gap") && more) {
+        ++j;
+        if (!strcasecmp(argv[j], "noise")) {
+            ifile.burst_gap = BURST_GAP_NOISE;
+        } else if (!strcasecmp(argv[j], "zero")) {
+            ifile.burst_gap = BURST_GAP_ZERO;
+        } else {
+            fprintf(stderr, "Burst gap fill '%s' not understood (supported values: noise, zero)\n",
+                    argv[j]);
+            return false;
+        }
     } else {
         return false;
     }
@@ -119,67 +163,145 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
     return true;
 }
 
-//
-//=========================================================================
-//
-// This is used when --ifile is specified in order to read data from file
-// instead of using an RTLSDR device
-//
-bool ifileOpen(void)
+unsigned ifileInputCount()
 {
-    if (!ifile.filename) {
-        fprintf(stderr, "SDR type 'ifile' requires an --ifile argument\n");
-        return false;
+    return ifile.count ? ifile.count : 1;
+}
+
+static unsigned bytesPerSample(input_format_t format)
+{
+    switch (format) {
+    case INPUT_UC8:
+        return 2;
+    case INPUT_SC16:
+    case INPUT_SC16Q11:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+// Read up to len bytes, stopping early only at EOF or on error
+static unsigned readBytes(struct ifile_input *in, char *buf, unsigned len, bool *eof)
+{
+    if (in->decompress) {
+        unsigned bytes_read = decompressorRead(in->decompress, buf, len);
+        if (bytes_read < len)
+            *eof = true;
+        return bytes_read;
     }
 
-    if (!strcmp(ifile.filename, "-")) {
-        ifile.fd = STDIN_FILENO;
-    } else if ((ifile.fd = open(ifile.filename, O_RDONLY)) < 0) {
+    unsigned bytes_read = 0;
+    while (bytes_read < len) {
+        ssize_t nread = read(in->fd, buf + bytes_read, len - bytes_read);
+        if (nread <= 0) {
+            if (nread < 0) {
+                fprintf(stderr, "ifile: error reading %s: %s\n", in->filename, strerror(errno));
+            }
+            *eof = true;
+            break;
+        }
+        bytes_read += nread;
+    }
+    return bytes_read;
+}
+
+// burst_read_fn for a burst capture that is read through readBytes
+static size_t burstRead(void *opaque, void *buf, size_t len)
+{
+    bool eof = false;
+    return readBytes(opaque, buf, len, &eof);
+}
+
+static bool openInput(struct ifile_input *in)
+{
+    if (!strcmp(in->filename, "-")) {
+        in->fd = STDIN_FILENO;
+    } else if ((in->fd = open(in->filename, O_RDONLY)) < 0) {
         fprintf(stderr, "ifile: could not open %s: %s\n",
-                ifile.filename, strerror(errno));
+                in->filename, strerror(errno));
         return false;
     }
 
-    switch (ifile.input_format) {
-    case INPUT_UC8:
-        ifile.bytes_per_sample = 2;
-        break;
-    case INPUT_SC16:
-    case INPUT_SC16Q11:
-        ifile.bytes_per_sample = 4;
-        break;
-    default:
+    // A compressed file is decompressed on its own thread, and everything
+    // below reads the decompressed data
+    struct burst_file_header header;
+    bool eof = false;
+    unsigned header_bytes = readBytes(in, (char *) &header, sizeof(header), &eof);
+    compression_t compression = decompressDetect(&header, header_bytes);
+    if (compression != COMPRESSION_NONE) {
+        if (!(in->decompress = decompressorStart(in->fd, in->filename, compression, &header, header_bytes)))
+            return false;
+        eof = false;
+        header_bytes = readBytes(in, (char *) &header, sizeof(header), &eof);
+    }
+
+    // Look for a burst capture header; anything else is raw samples in
+    // the --iformat format, and the bytes read so far are kept
+    if (burstIsCaptureFile(&header, header_bytes)) {
+        if (!(in->burst = burstReaderCreate(burstRead, in, in->filename, &header, ifile.burst_gap)))
+            return false;
+        in->format = (input_format_t) header.input_format;
+        header_bytes = 0;
+    } else {
+        in->format = ifile.input_format;
+    }
+
+    if (!(in->bytes_per_sample = bytesPerSample(in->format))) {
         fprintf(stderr, "ifile: unhandled input format\n");
-        ifileClose();
         return false;
     }
 
-    ifile.bufsize = ifile.bytes_per_sample * MODES_MAG_BUF_SAMPLES; /* ~1M samples, about half a second's worth */
-
-    if (!(ifile.readbuf = malloc(ifile.bufsize))) {
+    in->bufsize = in->bytes_per_sample * MODES_MAG_BUF_SAMPLES; /* ~1M samples, about half a second's worth */
+    if (!(in->readbuf = malloc(in->bufsize))) {
         fprintf(stderr, "ifile: failed to allocate read buffer\n");
-        ifileClose();
         return false;
     }
 
-    ifile.converter = init_converter(ifile.input_format,
-                                     Modes.sample_rate,
-                                     Modes.dc_filter,
-                                     &ifile.converter_state);
-    if (!ifile.converter) {
+    memcpy(in->readbuf, &header, header_bytes);
+    in->pending = header_bytes;
+
+    in->converter = init_converter(in->format,
+                                   Modes.input_sample_rate,
+                                   Modes.sample_rate,
+                                   Modes.dc_filter,
+                                   &in->converter_state);
+    if (!in->converter) {
         fprintf(stderr, "ifile: can't initialize sample converter\n");
-        ifileClose();
         return false;
     }
 
+    if (in->input == 0 && !burstRecordStart(in->format, Modes.input_sample_rate))
+        return false;
+
     return true;
 }
 
-void ifileRun()
+//
+//=========================================================================
+//
+// This is used when --ifile is specified in order to read data from file
+// instead of using an RTLSDR device
+//
+bool ifileOpen(void)
 {
-    if (ifile.fd < 0)
-        return;
+    if (!ifile.count) {
+        fprintf(stderr, "SDR type 'ifile' requires an --ifile argument\n");
+        return false;
+    }
+
+    for (unsigned i = 0; i < ifile.count; ++i) {
+        if (!openInput(&ifile.inputs[i])) {
+            ifileClose();
+            return false;
+        }
+    }
 
+    return true;
+}
+
+static void runInput(struct ifile_input *in)
+{
     struct timespec next_buffer_delivery;
     clock_gettime(CLOCK_MONOTONIC, &next_buffer_delivery);
 
@@ -187,7 +309,10 @@ void ifileRun()
     uint64_t sampleCounter = 0;
 
     while (!Modes.exit && !eof) {
-        sdrMonitor();
+        if (in->input == 0)
+            sdrMonitor();
+        else
+            sdrMonitorThread(&in->cpu_start);
 
         /* wait for up to 1000ms for a buffer */
         struct mag_buf *outbuf = fifo_acquire(100 /* milliseconds */);
@@ -197,33 +322,35 @@ void ifileRun()
         }
 
         // Compute the sample timestamp and system time for the start of the block
-        outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+        // (a resampling converter's output starts with samples it held over)
+        outbuf->input = in->input;
+        outbuf->sampleTimestamp = (sampleCounter - converter_carry(in->converter_state)) * 12e6 / Modes.input_sample_rate;
         outbuf->sysTimestamp = mstime();
 
-        unsigned bytes_wanted = (outbuf->totalLength - outbuf->overlap) * ifile.bytes_per_sample;
-        if (bytes_wanted > ifile.bufsize)
-            bytes_wanted = ifile.bufsize;
-
-        unsigned bytes_read = 0;
-        while (bytes_read < bytes_wanted) {
-            ssize_t nread = read(ifile.fd, ifile.readbuf + bytes_read, bytes_wanted - bytes_read);
-            if (nread <= 0) {
-                if (nread < 0) {
-                    fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
-                }
-                // Done.
+        unsigned samples_wanted = outbuf->totalLength - outbuf->overlap;
+        if (samples_wanted > in->bufsize / in->bytes_per_sample)
+            samples_wanted = in->bufsize / in->bytes_per_sample;
+
+        unsigned samples_read;
+        if (in->burst) {
+            samples_read = burstReaderRead(in->burst, in->readbuf, samples_wanted);
+            if (samples_read < samples_wanted)
                 eof = true;
-                break;
-            }
-            bytes_read += nread;
+        } else {
+            unsigned bytes_wanted = samples_wanted * in->bytes_per_sample;
+            unsigned bytes_read = in->pending;
+            in->pending = 0;
+            bytes_read += readBytes(in, in->readbuf + bytes_read, bytes_wanted - bytes_read, &eof);
+            samples_read = bytes_read / in->bytes_per_sample;
         }
 
-        unsigned samples_read = bytes_read / ifile.bytes_per_sample;
-
         // Convert the new data
-        ifile.converter(ifile.readbuf, &outbuf->data[outbuf->overlap], samples_read, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-        outbuf->validLength = outbuf->overlap + samples_read;
-        outbuf->flags = 0;
+        unsigned converted = in->converter(in->readbuf, &outbuf->data[outbuf->overlap], samples_read, in->converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->preamble_bitmap);
+        outbuf->validLength = outbuf->overlap + converted;
+        outbuf->flags = MAGBUF_PREAMBLE_BITMAP;
+
+        if (in->input == 0)
+            burstRecordSamples(in->readbuf, samples_read, sampleCounter, &outbuf->data[outbuf->overlap], converted);
 
         if (ifile.throttle || Modes.interactive) {
             // Wait until we are allowed to release this buffer to the FIFO
@@ -231,7 +358,7 @@ void ifileRun()
                 ;
 
             // compute the time we can deliver the next buffer.
-            next_buffer_delivery.tv_nsec += samples_read * 1e9 / Modes.sample_rate;
+            next_buffer_delivery.tv_nsec += samples_read * 1e9 / Modes.input_sample_rate;
             normalize_timespec(&next_buffer_delivery);
         }
 
@@ -239,6 +366,41 @@ void ifileRun()
         fifo_enqueue(outbuf);
         sampleCounter += samples_read;
     }
+}
+
+static void *inputThreadEntryPoint(void *arg)
+{
+    struct ifile_input *in = arg;
+
+    set_thread_name("dump1090-ifile");
+    start_cpu_timing(&in->cpu_start);
+    runInput(in);
+    sdrMonitorThread(&in->cpu_start);
+    return NULL;
+}
+
+void ifileRun()
+{
+    if (ifile.inputs[0].fd < 0)
+        return;
+
+    // Extra files each get their own reader thread
+    unsigned started = 1;
+    for (; started < ifile.count; ++started) {
+        struct ifile_input *in = &ifile.inputs[started];
+        int err = pthread_create(&in->thread, NULL, inputThreadEntryPoint, in);
+        if (err) {
+            fprintf(stderr, "ifile: can't start reader thread for %s: %s\n", in->filename, strerror(err));
+            Modes.exit = 2;
+            break;
+        }
+    }
+
+    runInput(&ifile.inputs[0]);
+
+    // Carry on until every file has been read
+    for (unsigned i = 1; i < started; ++i)
+        pthread_join(ifile.inputs[i].thread, NULL);
 
     // Wait for the FIFO to drain so we don't throw away trailing data
     fifo_drain();
@@ -246,19 +408,29 @@ void ifileRun()
 
 void ifileClose()
 {
-    if (ifile.converter) {
-        cleanup_converter(ifile.converter_state);
-        ifile.converter = NULL;
-        ifile.converter_state = NULL;
-    }
+    for (unsigned i = 0; i < ifile.count; ++i) {
+        struct ifile_input *in = &ifile.inputs[i];
 
-    if (ifile.readbuf) {
-        free(ifile.readbuf);
-        ifile.readbuf = NULL;
-    }
+        if (in->converter) {
+            cleanup_converter(in->converter_state);
+            in->converter = NULL;
+            in->converter_state = NULL;
+        }
+
+        if (in->readbuf) {
+            free(in->readbuf);
+            in->readbuf = NULL;
+        }
 
-    if (ifile.fd >= 0 && ifile.fd != STDIN_FILENO) {
-        close(ifile.fd);
-        ifile.fd = -1;
+        burstReaderDestroy(in->burst);
+        in->burst = NULL;
+
+        decompressorDestroy(in->decompress);
+        in->decompress = NULL;
+
+        if (in->fd >= 0 && in->fd != STDIN_FILENO) {
+            close(in->fd);
+        }
+        in->fd = -1;
     }
 }
@@ -26,6 +26,7 @@
 void ifileInitConfig();
 void ifileShowHelp();
 bool ifileHandleOption(int argc, char **argv, int *jptr);
+unsigned ifileInputCount();
 bool ifileOpen();
 void ifileRun();
 void ifileClose();
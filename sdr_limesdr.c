@@ -268,7 +268,7 @@ bool limesdrOpen(void)
         goto error;
     }
 
-    if (LMS_SetSampleRate(LimeSDR.dev, Modes.sample_rate, LimeSDR.oversample)) {
+    if (LMS_SetSampleRate(LimeSDR.dev, Modes.input_sample_rate, LimeSDR.oversample)) {
         limesdrLogHandler(LMS_LOG_ERROR, "unable to set sampling rate");
         goto error;
     }
@@ -310,6 +310,7 @@ bool limesdrOpen(void)
     }
 
     LimeSDR.converter = init_converter(INPUT_SC16,
+                                      Modes.input_sample_rate,
                                       Modes.sample_rate,
                                       Modes.dc_filter,
                                       &LimeSDR.converter_state);
@@ -318,6 +319,10 @@ bool limesdrOpen(void)
         goto error;
     }
 
+    if (!burstRecordStart(INPUT_SC16, Modes.input_sample_rate)) {
+        goto error;
+    }
+
     return true;
 
   error:
@@ -364,11 +369,12 @@ static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     dropped = 0;
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    // (a resampling converter's output starts with samples it held over)
+    outbuf->sampleTimestamp = (sampleCounter - converter_carry(LimeSDR.converter_state)) * 12e6 / Modes.input_sample_rate;
     sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
-    unsigned block_duration = 1e3 * samples_read / Modes.sample_rate;
+    unsigned block_duration = 1e3 * samples_read / Modes.input_sample_rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
@@ -379,8 +385,11 @@ static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
         dropped = samples_read - to_convert;
     }
 
-    LimeSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, LimeSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    unsigned converted = LimeSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, LimeSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->preamble_bitmap);
+    outbuf->flags |= MAGBUF_PREAMBLE_BITMAP;
+    outbuf->validLength = outbuf->overlap + converted;
+
+    burstRecordSamples(buf, to_convert, sampleCounter - samples_read, &outbuf->data[outbuf->overlap], converted);
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
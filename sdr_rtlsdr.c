@@ -276,11 +276,12 @@ bool rtlsdrOpen(void)
 
     rtlsdr_set_freq_correction(RTLSDR.dev, RTLSDR.ppm_error);
     rtlsdr_set_center_freq(RTLSDR.dev, Modes.freq);
-    rtlsdr_set_sample_rate(RTLSDR.dev, (unsigned)Modes.sample_rate);
+    rtlsdr_set_sample_rate(RTLSDR.dev, (unsigned)Modes.input_sample_rate);
 
     rtlsdr_reset_buffer(RTLSDR.dev);
 
     RTLSDR.converter = init_converter(INPUT_UC8,
+                                      Modes.input_sample_rate,
                                       Modes.sample_rate,
                                       Modes.dc_filter,
                                       &RTLSDR.converter_state);
@@ -290,6 +291,11 @@ bool rtlsdrOpen(void)
         return false;
     }
 
+    if (!burstRecordStart(INPUT_UC8, Modes.input_sample_rate)) {
+        rtlsdrClose();
+        return false;
+    }
+
 #ifdef USE_BOUNCE_BUFFER
     if (!(RTLSDR.bounce_buffer = malloc(MODES_RTL_BUF_SIZE))) {
         fprintf(stderr, "rtlsdr: can't allocate bounce buffer\n");
@@ -341,11 +347,12 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     dropped = 0;
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    // (a resampling converter's output starts with samples it held over)
+    outbuf->sampleTimestamp = (sampleCounter - converter_carry(RTLSDR.converter_state)) * 12e6 / Modes.input_sample_rate;
     sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
-    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
+    uint64_t block_duration = 1e3 * samples_read / Modes.input_sample_rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
@@ -362,8 +369,11 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     buf = RTLSDR.bounce_buffer;
 #endif
 
-    RTLSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    unsigned converted = RTLSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->preamble_bitmap);
+    outbuf->flags |= MAGBUF_PREAMBLE_BITMAP;
+    outbuf->validLength = outbuf->overlap + converted;
+
+    burstRecordSamples(buf, to_convert, sampleCounter - samples_read, &outbuf->data[outbuf->overlap], converted);
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
@@ -238,7 +238,7 @@ bool soapyOpen(void)
         }
     }
 
-    if (SoapySDRDevice_setSampleRate(SOAPY.dev, SOAPY_SDR_RX, SOAPY.channel, Modes.sample_rate) != 0) {
+    if (SoapySDRDevice_setSampleRate(SOAPY.dev, SOAPY_SDR_RX, SOAPY.channel, Modes.input_sample_rate) != 0) {
         fprintf(stderr, "soapy: setSampleRate failed: %s\n", SoapySDRDevice_lastError());
         goto error;
     }
@@ -403,6 +403,7 @@ bool soapyOpen(void)
     }
 
     SOAPY.converter = init_converter(INPUT_SC16,
+                                     Modes.input_sample_rate,
                                      Modes.sample_rate,
                                      Modes.dc_filter,
                                      &SOAPY.converter_state);
@@ -411,6 +412,10 @@ bool soapyOpen(void)
         goto error;
     }
 
+    if (!burstRecordStart(INPUT_SC16, Modes.input_sample_rate)) {
+        goto error;
+    }
+
     return true;
 
  error:
@@ -469,11 +474,12 @@ void soapyRun()
         dropped = 0;
 
         // Compute the sample timestamp and system timestamp for the start of the block
-        outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+        // (a resampling converter's output starts with samples it held over)
+        outbuf->sampleTimestamp = (sampleCounter - converter_carry(SOAPY.converter_state)) * 12e6 / Modes.input_sample_rate;
         sampleCounter += samples_read;
 
         // Get the approx system time for the start of this block
-        unsigned block_duration = 1e3 * samples_read / Modes.sample_rate;
+        unsigned block_duration = 1e3 * samples_read / Modes.input_sample_rate;
         outbuf->sysTimestamp = mstime() - block_duration;
 
         unsigned int to_convert = samples_read;
@@ -484,8 +490,11 @@ void soapyRun()
         }
 
         // Convert the new data
-        SOAPY.converter(buf, &outbuf->data[outbuf->overlap], to_convert, SOAPY.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-        outbuf->validLength = outbuf->overlap + to_convert;
+        unsigned converted = SOAPY.converter(buf, &outbuf->data[outbuf->overlap], to_convert, SOAPY.converter_state, &outbuf->mean_level, &outbuf->mean_power, outbuf->preamble_bitmap);
+        outbuf->flags |= MAGBUF_PREAMBLE_BITMAP;
+        outbuf->validLength = outbuf->overlap + converted;
+
+        burstRecordSamples(buf, to_convert, sampleCounter - samples_read, &outbuf->data[outbuf->overlap], converted);
 
         // Push to the demodulation thread
         fifo_enqueue(outbuf);
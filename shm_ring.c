@@ -0,0 +1,322 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// shm_ring.c: shared-memory message ring for local consumers
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+_Static_assert(sizeof(struct shm_ring_header) == 64, "shm_ring_header layout changed");
+_Static_assert(sizeof(struct shm_ring_record) == 64, "shm_ring_record layout changed");
+
+#ifndef _WIN32
+
+#include <sys/mman.h>
+
+struct shm_ring_reader {
+    struct shm_ring_header *header;
+    struct shm_ring_record *records;
+    size_t size;
+    uint64_t next;        // next message number to read
+    uint64_t dropped;
+};
+
+static struct {
+    char *name;
+    struct shm_ring_header *header;
+    struct shm_ring_record *records;
+    size_t size;
+    uint64_t head;        // private copy of header->head
+    uint64_t last_heartbeat;
+} writer;
+
+// shm_open wants a name with exactly one leading slash
+static char *shmName(const char *name)
+{
+    char *full = malloc(strlen(name) + 2);
+    if (full)
+        sprintf(full, "/%s", name + (name[0] == '/'));
+    return full;
+}
+
+bool shmRingCreate(const char *name, unsigned capacity)
+{
+    if (capacity == 0 || (capacity & (capacity - 1))) {
+        fprintf(stderr, "shm ring: capacity must be a power of two\n");
+        return false;
+    }
+
+    if (!(writer.name = shmName(name))) {
+        fprintf(stderr, "shm ring: out of memory\n");
+        return false;
+    }
+
+    // Replace any ring left by an earlier instance; its readers see the
+    // heartbeat stop and re-attach to the new one.
+    shm_unlink(writer.name);
+
+    int fd = shm_open(writer.name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "shm ring: can't create %s: %s\n", writer.name, strerror(errno));
+        goto fail;
+    }
+
+    writer.size = sizeof(struct shm_ring_header) + (size_t) capacity * sizeof(struct shm_ring_record);
+    if (ftruncate(fd, writer.size) < 0) {
+        fprintf(stderr, "shm ring: can't size %s: %s\n", writer.name, strerror(errno));
+        close(fd);
+        shm_unlink(writer.name);
+        goto fail;
+    }
+
+    void *base = mmap(NULL, writer.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "shm ring: can't map %s: %s\n", writer.name, strerror(errno));
+        shm_unlink(writer.name);
+        goto fail;
+    }
+
+    // the new object is zero-filled, so every record starts with seq 0
+    writer.header = base;
+    writer.records = (struct shm_ring_record *) (writer.header + 1);
+    writer.head = 0;
+
+    writer.header->version = SHM_RING_VERSION;
+    writer.header->record_size = sizeof(struct shm_ring_record);
+    writer.header->capacity = capacity;
+    atomic_store_explicit(&writer.header->head, 0, memory_order_relaxed);
+    shmRingHeartbeat();
+
+    // magic last, so a reader that sees it sees a complete header
+    atomic_thread_fence(memory_order_release);
+    memcpy(writer.header->magic, SHM_RING_MAGIC, sizeof(writer.header->magic));
+    return true;
+
+ fail:
+    free(writer.name);
+    writer.name = NULL;
+    return false;
+}
+
+void shmRingPublish(const struct modesMessage *mm)
+{
+    if (!writer.header)
+        return;
+
+    uint64_t n = writer.head++;
+    struct shm_ring_record *rec = &writer.records[n & (writer.header->capacity - 1)];
+
+    atomic_store_explicit(&rec->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    rec->timestamp = mm->timestampMsg;
+    rec->sys_timestamp = mm->sysTimestampMsg;
+    rec->signal_level = mm->signalLevel;
+    rec->score = mm->score;
+    rec->flags = (mm->remote ? SHM_RING_REMOTE : 0) | (mm->source == SOURCE_MLAT ? SHM_RING_MLAT : 0);
+
+    rec->length = mm->msgbits / 8;
+    if (rec->length == MODEAC_MSG_BYTES)
+        rec->type = '1';
+    else if (rec->length == MODES_SHORT_MSG_BYTES)
+        rec->type = '2';
+    else
+        rec->type = '3';
+    memcpy(rec->msg, mm->verbatim, rec->length);
+
+    atomic_store_explicit(&rec->seq, n + 1, memory_order_release);
+    atomic_store_explicit(&writer.header->head, n + 1, memory_order_release);
+}
+
+void shmRingHeartbeat(void)
+{
+    if (!writer.header)
+        return;
+
+    uint64_t now = mstime();
+    if (now != writer.last_heartbeat) {
+        atomic_store_explicit(&writer.header->heartbeat, now, memory_order_release);
+        writer.last_heartbeat = now;
+    }
+}
+
+void shmRingDestroy(void)
+{
+    if (!writer.header)
+        return;
+
+    atomic_store_explicit(&writer.header->heartbeat, 0, memory_order_release);
+    munmap(writer.header, writer.size);
+    shm_unlink(writer.name);
+    free(writer.name);
+    memset(&writer, 0, sizeof(writer));
+}
+
+struct shm_ring_reader *shmRingAttach(const char *name)
+{
+    struct shm_ring_reader *reader = NULL;
+    char *full = shmName(name);
+    if (!full)
+        return NULL;
+
+    int fd = shm_open(full, O_RDONLY, 0);
+    free(full);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(struct shm_ring_header)) {
+        close(fd);
+        return NULL;
+    }
+
+    void *base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return NULL;
+
+    struct shm_ring_header *header = base;
+    if (memcmp(header->magic, SHM_RING_MAGIC, sizeof(header->magic)))
+        goto fail;
+    atomic_thread_fence(memory_order_acquire);
+
+    if (header->version != SHM_RING_VERSION ||
+        header->record_size != sizeof(struct shm_ring_record) ||
+        header->capacity == 0 || (header->capacity & (header->capacity - 1)) ||
+        sizeof(*header) + (size_t) header->capacity * sizeof(struct shm_ring_record) > (size_t) st.st_size)
+        goto fail;
+
+    uint64_t heartbeat = atomic_load_explicit(&header->heartbeat, memory_order_acquire);
+    if (!heartbeat || heartbeat + SHM_RING_HEARTBEAT_TIMEOUT < mstime())
+        goto fail;
+
+    if (!(reader = calloc(1, sizeof(*reader))))
+        goto fail;
+
+    reader->header = header;
+    reader->records = (struct shm_ring_record *) (header + 1);
+    reader->size = st.st_size;
+    reader->next = atomic_load_explicit(&header->head, memory_order_acquire); // start with new messages
+    return reader;
+
+ fail:
+    munmap(base, st.st_size);
+    return NULL;
+}
+
+void shmRingDetach(struct shm_ring_reader *reader)
+{
+    if (!reader)
+        return;
+
+    munmap(reader->header, reader->size);
+    free(reader);
+}
+
+int shmRingRead(struct shm_ring_reader *reader, struct shm_ring_record *out, unsigned max)
+{
+    struct shm_ring_header *header = reader->header;
+    uint64_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+
+    if (head == reader->next) {
+        // nothing new; is the producer still there?
+        uint64_t heartbeat = atomic_load_explicit(&header->heartbeat, memory_order_acquire);
+        if (!heartbeat || heartbeat + SHM_RING_HEARTBEAT_TIMEOUT < mstime())
+            return -1;
+        return 0;
+    }
+
+    if (head - reader->next > header->capacity) {
+        // fell behind; skip to the oldest record that can still be valid
+        reader->dropped += head - header->capacity - reader->next;
+        reader->next = head - header->capacity;
+    }
+
+    unsigned count = 0;
+    while (reader->next < head && count < max) {
+        uint64_t n = reader->next++;
+        const struct shm_ring_record *rec = &reader->records[n & (header->capacity - 1)];
+
+        uint64_t seq = atomic_load_explicit(&rec->seq, memory_order_acquire);
+        if (seq == n + 1) {
+            memcpy(&out[count], rec, sizeof(*rec));
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&rec->seq, memory_order_relaxed) == seq) {
+                ++count;
+                continue;
+            }
+        }
+
+        // overwritten before or while we read it
+        ++reader->dropped;
+    }
+
+    return count;
+}
+
+uint64_t shmRingDropped(const struct shm_ring_reader *reader)
+{
+    return reader->dropped;
+}
+
+#else /* _WIN32 */
+
+bool shmRingCreate(const char *name, unsigned capacity)
+{
+    MODES_NOTUSED(name);
+    MODES_NOTUSED(capacity);
+    fprintf(stderr, "shm ring: not supported on this platform\n");
+    return false;
+}
+
+void shmRingPublish(const struct modesMessage *mm)
+{
+    MODES_NOTUSED(mm);
+}
+
+void shmRingHeartbeat(void)
+{
+}
+
+void shmRingDestroy(void)
+{
+}
+
+struct shm_ring_reader *shmRingAttach(const char *name)
+{
+    MODES_NOTUSED(name);
+    return NULL;
+}
+
+void shmRingDetach(struct shm_ring_reader *reader)
+{
+    MODES_NOTUSED(reader);
+}
+
+int shmRingRead(struct shm_ring_reader *reader, struct shm_ring_record *out, unsigned max)
+{
+    MODES_NOTUSED(reader);
+    MODES_NOTUSED(out);
+    MODES_NOTUSED(max);
+    return -1;
+}
+
+uint64_t shmRingDropped(const struct shm_ring_reader *reader)
+{
+    MODES_NOTUSED(reader);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,111 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// shm_ring.h: shared-memory message ring for local consumers
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_SHM_RING_H
+#define DUMP1090_SHM_RING_H
+
+// dump1090 can publish the messages it would send to a Beast verbatim
+// output connection into a POSIX shared memory object (--net-shm-ring
+// <name>). Consumers on the same host map the object read-only and follow
+// the ring; nothing is ever written by a consumer, so any number of them can
+// attach, and a slow consumer only loses messages itself.
+//
+// Layout (all fields in host byte order):
+//
+//   offset 0:   struct shm_ring_header (64 bytes)
+//   offset 64:  capacity * struct shm_ring_record (64 bytes each)
+//
+// Message number n (counting from 0) is stored in record n % capacity. The
+// producer writes a record as:
+//
+//   record.seq = 0; release fence; record fields; record.seq = n + 1 (release);
+//   header.head = n + 1 (release)
+//
+// A consumer reads record n by loading seq (acquire), copying the record,
+// issuing an acquire fence and loading seq again; the copy is valid only if
+// both loads returned n + 1. A larger seq means the record has already been
+// overwritten and the consumer has fallen more than 'capacity' messages
+// behind.
+//
+// The producer stores its current time (ms since the epoch) in
+// header.heartbeat at least once a second, and stores 0 there when it shuts
+// down. A restarted producer creates a new object under the same name, so a
+// consumer that sees the heartbeat stop should re-attach.
+
+#define SHM_RING_MAGIC "MODESRNG"
+#define SHM_RING_VERSION 1
+#define SHM_RING_DEFAULT_CAPACITY 65536
+
+// Consumers treat the producer as gone if the heartbeat is older than this (ms)
+#define SHM_RING_HEARTBEAT_TIMEOUT 5000
+
+// How long consumers sleep when the ring is empty (ms)
+#define SHM_RING_POLL_INTERVAL 10
+
+struct modesMessage;
+
+struct shm_ring_header {
+    char magic[8];                  // SHM_RING_MAGIC, not NUL-terminated
+    uint32_t version;               // SHM_RING_VERSION
+    uint32_t record_size;           // sizeof(struct shm_ring_record)
+    uint32_t capacity;              // number of records, a power of two
+    uint32_t reserved0;
+    _Atomic uint64_t head;          // number of records written so far
+    _Atomic uint64_t heartbeat;     // producer time in ms, 0 once closed
+    uint8_t reserved[24];
+};
+
+// Record flags
+#define SHM_RING_REMOTE  0x01       // message was received from the network, not a local receiver
+#define SHM_RING_MLAT    0x02       // message is a mlat result
+
+struct shm_ring_record {
+    _Atomic uint64_t seq;           // 0: message number + 1; written last
+    uint64_t timestamp;             // 8: receiver clock, 12MHz
+    uint64_t sys_timestamp;         // 16: reception time, ms since the epoch
+    double signal_level;            // 24: signal power as a fraction of full scale
+    int32_t score;                  // 32: scoreModesMessage() result, 0 for Mode A/C
+    uint8_t type;                   // 36: Beast frame type: '1' Mode A/C, '2' short, '3' long
+    uint8_t flags;                  // 37: SHM_RING_* flags
+    uint8_t length;                 // 38: message length in bytes (2, 7 or 14)
+    uint8_t reserved0;              // 39
+    uint8_t msg[MODES_LONG_MSG_BYTES]; // 40: message as received, before error correction
+    uint8_t reserved[10];           // 54
+};
+
+// Producer side (dump1090). Returns false, with a message on stderr, if the
+// ring can't be created.
+bool shmRingCreate(const char *name, unsigned capacity);
+void shmRingPublish(const struct modesMessage *mm);
+void shmRingHeartbeat(void);
+void shmRingDestroy(void);
+
+// Consumer side
+struct shm_ring_reader;
+
+// Attach to an existing ring; returns NULL if there is no usable ring by that name
+struct shm_ring_reader *shmRingAttach(const char *name);
+void shmRingDetach(struct shm_ring_reader *reader);
+
+// Copy up to 'max' new records to 'out'. Returns the number copied, or -1 if
+// the producer has gone away (the reader should be detached).
+int shmRingRead(struct shm_ring_reader *reader, struct shm_ring_record *out, unsigned max);
+
+// Number of records this reader has missed because it fell behind
+uint64_t shmRingDropped(const struct shm_ring_reader *reader);
+
+#endif
@@ -81,6 +81,11 @@ void display_stats(struct stats *st) {
         printf("Local receiver:\n");
         printf("  %12llu samples processed\n",                        (unsigned long long)st->samples_processed);
         printf("  %12llu samples dropped\n",                          (unsigned long long)st->samples_dropped);
+        if (Modes.num_inputs > 1) {
+            for (unsigned k = 0; k < Modes.num_inputs; ++k)
+                printf("  %12llu samples processed, %u messages accepted, from input %u\n",
+                       (unsigned long long)st->input_samples_processed[k], st->input_messages[k], k);
+        }
 
         printf("  %12u Mode A/C messages received\n",                 st->demod_modeac);
         printf("  %12u Mode-S message preambles received\n",          st->demod_preambles);
@@ -167,6 +172,12 @@ void display_stats(struct stats *st) {
         printf("    %8u accepted with correct CRC\n",              st->remote_accepted[0]);
         for (j = 1; j <= Modes.nfix_crc; ++j)
             printf("    %8u accepted with %d-bit error repaired\n", st->remote_accepted[j], j);
+        if (Modes.net_dedup_window) {
+            printf("    %8u duplicates from Beast inputs (%u dropped)\n",
+                   st->remote_duplicates_seen[REMOTE_INPUT_BEAST], st->remote_duplicates_dropped[REMOTE_INPUT_BEAST]);
+            printf("    %8u duplicates from raw inputs (%u dropped)\n",
+                   st->remote_duplicates_seen[REMOTE_INPUT_RAW], st->remote_duplicates_dropped[REMOTE_INPUT_RAW]);
+        }
     }
 
     printf("Decoder:\n"
@@ -336,6 +347,10 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
 
     target->samples_processed = st1->samples_processed + st2->samples_processed;
     target->samples_dropped = st1->samples_dropped + st2->samples_dropped;
+    for (i = 0; i < MODES_MAX_INPUTS; ++i) {
+        target->input_samples_processed[i] = st1->input_samples_processed[i] + st2->input_samples_processed[i];
+        target->input_messages[i] = st1->input_messages[i] + st2->input_messages[i];
+    }
 
     target->sdr_gain = newer->sdr_gain;
 
@@ -367,6 +382,10 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->remote_rejected_unknown_icao = st1->remote_rejected_unknown_icao + st2->remote_rejected_unknown_icao;
     for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
         target->remote_accepted[i]  = st1->remote_accepted[i] + st2->remote_accepted[i];
+    for (i = 0; i < REMOTE_INPUT_COUNT; ++i) {
+        target->remote_duplicates_seen[i] = st1->remote_duplicates_seen[i] + st2->remote_duplicates_seen[i];
+        target->remote_duplicates_dropped[i] = st1->remote_duplicates_dropped[i] + st2->remote_duplicates_dropped[i];
+    }
 
     // total messages:
     target->messages_total = st1->messages_total + st2->messages_total;
@@ -418,4 +437,27 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->adaptive_gain_changes = st1->adaptive_gain_changes + st2->adaptive_gain_changes;
     target->adaptive_noise_dbfs = adaptive_best->adaptive_noise_dbfs;
     target->adaptive_range_gain_limit = adaptive_best->adaptive_range_gain_limit;
+
+    // pipeline latency
+    for (unsigned stage = 0; stage < LATENCY_STAGE_COUNT; ++stage)
+        for (unsigned i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+            target->latency_histogram[stage][i] = st1->latency_histogram[stage][i] + st2->latency_histogram[stage][i];
+}
+
+uint64_t stats_latency_percentile(const uint32_t *histogram, unsigned percentile)
+{
+    uint64_t total = 0;
+    for (unsigned i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+        total += histogram[i];
+    if (!total)
+        return 0;
+
+    uint64_t target = (total * percentile + 99) / 100;
+    uint64_t n = 0;
+    for (unsigned i = 0; i < LATENCY_BUCKET_COUNT; ++i) {
+        n += histogram[i];
+        if (n >= target)
+            return (uint64_t)1 << i;
+    }
+    return (uint64_t)1 << (LATENCY_BUCKET_COUNT - 1);
 }
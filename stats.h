@@ -51,6 +51,31 @@
 #ifndef DUMP1090_STATS_H
 #define DUMP1090_STATS_H
 
+// Pipeline stages whose latency is measured. All times are taken from
+// monotonic_us().
+typedef enum {
+    LATENCY_FIFO = 0,   // sample buffer enqueued by the reader -> dequeued by the demodulator
+    LATENCY_DEMOD,      // buffer dequeued -> message decoded
+    LATENCY_QUEUE,      // message decoded -> queued to the output writers
+    LATENCY_FLUSH,      // message queued to a writer -> writer flushed to its clients
+    LATENCY_NETWORK,    // message decoded -> writer flushed to its clients
+
+    LATENCY_STAGE_COUNT
+} latency_stage_t;
+
+// Network inputs whose duplicates are counted separately (see dedup.h)
+typedef enum {
+    REMOTE_INPUT_BEAST = 0,  // Beast and compressed Beast TCP input
+    REMOTE_INPUT_RAW,        // raw (AVR) TCP input
+
+    REMOTE_INPUT_COUNT
+} remote_input_t;
+
+// Latency histograms are log2-bucketed: bucket 0 counts latencies below
+// 1us, bucket N counts latencies in [2^(N-1), 2^N) us, and the last bucket
+// also counts anything longer.
+#define LATENCY_BUCKET_COUNT 24
+
 struct stats {
     uint64_t start;
     uint64_t end;
@@ -66,6 +91,9 @@ struct stats {
 
     uint64_t samples_processed;
     uint64_t samples_dropped;
+    // .. and by input, when there is more than one (Modes.num_inputs)
+    uint64_t input_samples_processed[MODES_MAX_INPUTS];
+    uint32_t input_messages[MODES_MAX_INPUTS];  // messages accepted by the demodulator
 
     // SDR settings:
     int sdr_gain;  // current gain step in use
@@ -95,6 +123,8 @@ struct stats {
     uint32_t remote_rejected_bad;
     uint32_t remote_rejected_unknown_icao;
     uint32_t remote_accepted[MODES_MAX_BITERRORS+1];
+    uint32_t remote_duplicates_seen[REMOTE_INPUT_COUNT];     // matched a recent message (--net-dedup)
+    uint32_t remote_duplicates_dropped[REMOTE_INPUT_COUNT];  // .. and were discarded
 
     // total messages:
     uint32_t messages_total;
@@ -142,6 +172,9 @@ struct stats {
     uint32_t adaptive_gain_changes;                     // Total number of gain changes caused by adaptive gain control
     double adaptive_noise_dbfs;                         // Current adaptive-dynamic-range smoothed noise measurement, dBFS
     int adaptive_range_gain_limit;                      // Current adaptive-dynamic-range gain step limit
+
+    // pipeline latency histograms, see stats_add_latency()
+    uint32_t latency_histogram[LATENCY_STAGE_COUNT][LATENCY_BUCKET_COUNT];
 };
 
 void add_stats(const struct stats *st1, const struct stats *st2, struct stats *target);
@@ -150,4 +183,19 @@ void reset_stats(struct stats *st);
 
 void add_timespecs(const struct timespec *x, const struct timespec *y, struct timespec *z);
 
+// Record one latency sample of 'us' microseconds for the given stage
+static inline void stats_add_latency(struct stats *st, latency_stage_t stage, uint64_t us)
+{
+    unsigned bucket = 0;
+    while (us && bucket < LATENCY_BUCKET_COUNT - 1) {
+        us >>= 1;
+        ++bucket;
+    }
+    ++st->latency_histogram[stage][bucket];
+}
+
+// Upper bound, in microseconds, of the latency below which 'percentile'
+// percent of the samples in a histogram fall; 0 if the histogram is empty
+uint64_t stats_latency_percentile(const uint32_t *histogram, unsigned percentile);
+
 #endif
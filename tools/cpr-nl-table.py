@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+
+# Generate cpr_nl_table.h: lookup tables for the CPR NL function.
+#
+# NL(lat) is the number of longitude zones at a given latitude (DO-260B
+# A.1.7.2.d). It is a step function with 58 transitions between the
+# equator and 87 degrees. Rather than testing each transition in turn,
+# we quantize |lat| into buckets that are narrower than the smallest gap
+# between transitions, so that each bucket contains at most one
+# transition. A lookup is then a single table access and one comparison.
+#
+# Two tables are generated:
+#
+#  * cpr_nl_table[] is indexed by |lat| in degrees * CPR_NL_BUCKETS_PER_DEGREE
+#    and stores the transition as a double, for the floating-point decoders
+#
+#  * cpr_nl_fixed_table[] is indexed by |lat| in fixed-point units
+#    (CPR_LAT_360 units per 360 degrees) >> CPR_NL_FIXED_SHIFT and stores
+#    the transition in those units, for the integer airborne decoder
+#
+# Transition latitudes are rounded to 8 decimal places so that they match
+# the published table in 1090-WP-9-14 exactly.
+#
+# Usage: tools/cpr-nl-table.py > cpr_nl_table.h
+
+import math
+import sys
+from fractions import Fraction
+
+NZ = 15
+BUCKETS_PER_DEGREE = 4
+
+# Fixed-point latitude units: a single unit that represents both an even
+# (360/60 degree) and an odd (360/59 degree) zone step of 2^-17 exactly.
+LAT_360 = 60 * 59 * 131072
+FIXED_SHIFT = 19
+
+
+def transition(nl):
+    """Latitude (degrees) at which NL drops from nl to nl-1"""
+    if nl == 2:
+        return 87.0
+    a = 1 - math.cos(math.pi / (2 * NZ))
+    b = 1 - math.cos(2 * math.pi / nl)
+    return math.degrees(math.acos(math.sqrt(a / b)))
+
+
+# (transition latitude, NL below that latitude), ascending
+transitions = [(float('%.8f' % transition(nl)), nl) for nl in range(59, 1, -1)]
+
+min_gap = min(b[0] - a[0] for a, b in zip([(0.0, 60)] + transitions, transitions))
+assert 1.0 / BUCKETS_PER_DEGREE < min_gap, "double buckets too coarse"
+assert Fraction(1 << FIXED_SHIFT) * 360 / LAT_360 < Fraction(min_gap), "fixed buckets too coarse"
+
+
+def nl_at(lat):
+    for t, nl in transitions:
+        if lat < t:
+            return nl
+    return 1
+
+
+def next_transition(lat):
+    for t, nl in transitions:
+        if lat < t:
+            return t
+    return None
+
+
+def fixed(t):
+    # smallest fixed-point latitude that is >= t degrees; for an integer
+    # fixed-point latitude L, (L < fixed(t)) iff (L * 360 / LAT_360 < t)
+    v = Fraction(t) * LAT_360 / 360
+    return math.ceil(v)
+
+
+def emit_table(out, name, ctype, count, bucket_start, boundary_of):
+    out.write('static const struct {\n')
+    out.write('    %s boundary; // latitude of the first NL transition above the start of this bucket\n' % ctype)
+    out.write('    int nl; // NL at the start of this bucket\n')
+    out.write('} %s[%d] = {\n' % (name, count))
+    for i in range(count):
+        start = bucket_start(i)
+        out.write('    { %s, %d },\n' % (boundary_of(next_transition(start)), nl_at(start)))
+    out.write('};\n\n')
+
+
+def main():
+    out = sys.stdout
+    last = transitions[-1][0]
+
+    out.write('// Generated by tools/cpr-nl-table.py, do not edit.\n')
+    out.write('// Run "make cprtables" to regenerate.\n\n')
+    out.write('#ifndef DUMP1090_CPR_NL_TABLE_H\n')
+    out.write('#define DUMP1090_CPR_NL_TABLE_H\n\n')
+    out.write('#define CPR_NL_BUCKETS_PER_DEGREE %d\n' % BUCKETS_PER_DEGREE)
+    out.write('#define CPR_NL_LAST_TRANSITION %.8f\n' % last)
+    out.write('#define CPR_LAT_360 %d\n' % LAT_360)
+    out.write('#define CPR_NL_FIXED_SHIFT %d\n' % FIXED_SHIFT)
+    out.write('#define CPR_NL_FIXED_LAST_TRANSITION %d\n\n' % fixed(last))
+
+    double_count = math.ceil(Fraction(last) * BUCKETS_PER_DEGREE)
+    emit_table(out, 'cpr_nl_table', 'double', double_count,
+               lambda i: Fraction(i, BUCKETS_PER_DEGREE),
+               lambda t: '%.8f' % t)
+
+    fixed_count = ((fixed(last) - 1) >> FIXED_SHIFT) + 1
+    emit_table(out, 'cpr_nl_fixed_table', 'int', fixed_count,
+               lambda i: Fraction(i << FIXED_SHIFT) * 360 / LAT_360,
+               lambda t: '%d' % fixed(t))
+
+    out.write('#endif\n')
+
+
+if __name__ == '__main__':
+    main()
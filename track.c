@@ -159,6 +159,30 @@ static struct aircraft *trackFindAircraft(uint32_t addr) {
     return (NULL);
 }
 
+//
+//=========================================================================
+//
+// A duplicate of a message that updated aircraft 'addr' arrived with a
+// stronger signal. If the aircraft has had no other message since
+// (its count is still 'messages'), record the stronger signal level in place
+// of 'used', the level the message was originally recorded with (0 if none).
+// Returns true if the signal level was updated.
+//
+bool trackMergeDuplicateSignal(uint32_t addr, long messages, double used, double signal)
+{
+    struct aircraft *a = trackFindAircraft(addr);
+    if (!a || a->messages != messages)
+        return false;
+
+    if (used > 0) {
+        a->signalLevel[(a->signalNext + 7) & 7] = signal;
+    } else {
+        a->signalLevel[a->signalNext] = signal;
+        a->signalNext = (a->signalNext + 1) & 7;
+    }
+    return true;
+}
+
 // Should we accept some new data from the given source?
 // If so, update the validity and return 1
 static int accept_data(data_validity *d, datasource_t source)
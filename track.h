@@ -90,7 +90,8 @@ typedef struct {
     uint64_t expires;        /* when it expires */
 } data_validity;
 
-/* Structure used to describe the state of one tracked aircraft */
+/* Structure used to describe the state of one tracked aircraft.
+ * Saved as-is by --track-state: list any new field in AIRCRAFT_FIELDS in track_state.c */
 struct aircraft {
     uint32_t      addr;           // ICAO address
     addrtype_t    addrtype;       // highest priority address type seen for this aircraft
@@ -325,6 +326,11 @@ static inline uint64_t trackDataAge(const data_validity *v)
 struct modesMessage;
 struct aircraft *trackUpdateFromMessage(struct modesMessage *mm);
 
+/* Record a stronger signal level from a duplicate of the latest message
+ * from an aircraft (see dedup.h). Returns true if it was recorded.
+ */
+bool trackMergeDuplicateSignal(uint32_t addr, long messages, double used, double signal);
+
 /* Call periodically */
 void trackPeriodicUpdate();
 
@@ -0,0 +1,489 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// track_state.c: saving and restoring aircraft state across restarts
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <stddef.h>
+
+_Static_assert(sizeof(struct track_state_header) == 48, "track_state_header layout changed");
+
+// The ICAO filter keeps an address for at least this long after it was added
+#define FILTER_AGE 60000
+
+#ifndef _WIN32
+
+#include <sys/mman.h>
+
+// Every field of struct aircraft, in declaration order, as F(type, name,
+// array size) or, for bitfields, B(type, name, width); likewise for
+// data_validity. These must match track.h exactly: the assertions below
+// check every field's type and offset, and the size of the structure,
+// against them. (A new field that fits entirely in existing padding isn't
+// caught, so add it here anyway.)
+#define AIRCRAFT_FIELDS(F, B)                                           \
+    F(uint32_t, addr, )                                                 \
+    F(addrtype_t, addrtype, )                                           \
+    F(uint64_t, seen, )                                                 \
+    F(long, messages, )                                                 \
+    F(int, reliable, )                                                  \
+    F(long, reliableDF11, )                                             \
+    F(long, reliableDF17, )                                             \
+    F(long, discarded, )                                                \
+    F(double, signalLevel, [8])                                         \
+    F(int, signalNext, )                                                \
+    F(data_validity, callsign_valid, )                                  \
+    F(char, callsign, [9])                                              \
+    F(int, callsign_matched, )                                          \
+    F(data_validity, altitude_baro_valid, )                             \
+    F(int, altitude_baro, )                                             \
+    F(data_validity, altitude_geom_valid, )                             \
+    F(int, altitude_geom, )                                             \
+    F(data_validity, geom_delta_valid, )                                \
+    F(int, geom_delta, )                                                \
+    F(data_validity, gs_valid, )                                        \
+    F(float, gs, )                                                      \
+    F(data_validity, ias_valid, )                                       \
+    F(unsigned, ias, )                                                  \
+    F(data_validity, tas_valid, )                                       \
+    F(unsigned, tas, )                                                  \
+    F(data_validity, mach_valid, )                                      \
+    F(float, mach, )                                                    \
+    F(data_validity, track_valid, )                                     \
+    F(float, track, )                                                   \
+    F(data_validity, track_rate_valid, )                                \
+    F(float, track_rate, )                                              \
+    F(data_validity, roll_valid, )                                      \
+    F(float, roll, )                                                    \
+    F(data_validity, mag_heading_valid, )                               \
+    F(float, mag_heading, )                                             \
+    F(data_validity, true_heading_valid, )                              \
+    F(float, true_heading, )                                            \
+    F(data_validity, baro_rate_valid, )                                 \
+    F(int, baro_rate, )                                                 \
+    F(data_validity, geom_rate_valid, )                                 \
+    F(int, geom_rate, )                                                 \
+    F(data_validity, squawk_valid, )                                    \
+    F(unsigned, squawk, )                                               \
+    F(data_validity, emergency_valid, )                                 \
+    F(emergency_t, emergency, )                                         \
+    F(unsigned, category, )                                             \
+    F(data_validity, airground_valid, )                                 \
+    F(airground_t, airground, )                                         \
+    F(data_validity, nav_qnh_valid, )                                   \
+    F(float, nav_qnh, )                                                 \
+    F(data_validity, nav_altitude_mcp_valid, )                          \
+    F(int, nav_altitude_mcp, )                                          \
+    F(data_validity, nav_altitude_fms_valid, )                          \
+    F(int, nav_altitude_fms, )                                          \
+    F(data_validity, nav_altitude_src_valid, )                          \
+    F(nav_altitude_source_t, nav_altitude_src, )                        \
+    F(data_validity, nav_heading_valid, )                               \
+    F(float, nav_heading, )                                             \
+    F(data_validity, nav_modes_valid, )                                 \
+    F(nav_modes_t, nav_modes, )                                         \
+    F(data_validity, cpr_odd_valid, )                                   \
+    F(cpr_type_t, cpr_odd_type, )                                       \
+    F(unsigned, cpr_odd_lat, )                                          \
+    F(unsigned, cpr_odd_lon, )                                          \
+    F(unsigned, cpr_odd_nic, )                                          \
+    F(unsigned, cpr_odd_rc, )                                           \
+    F(data_validity, cpr_even_valid, )                                  \
+    F(cpr_type_t, cpr_even_type, )                                      \
+    F(unsigned, cpr_even_lat, )                                         \
+    F(unsigned, cpr_even_lon, )                                         \
+    F(unsigned, cpr_even_nic, )                                         \
+    F(unsigned, cpr_even_rc, )                                          \
+    F(data_validity, position_valid, )                                  \
+    F(double, lat, )                                                    \
+    F(double, lon, )                                                    \
+    F(unsigned, pos_nic, )                                              \
+    F(unsigned, pos_rc, )                                               \
+    F(int, adsb_version, )                                              \
+    F(int, adsr_version, )                                              \
+    F(int, tisb_version, )                                              \
+    F(heading_type_t, adsb_hrd, )                                       \
+    F(heading_type_t, adsb_tah, )                                       \
+    F(data_validity, nic_a_valid, )                                     \
+    F(data_validity, nic_c_valid, )                                     \
+    F(data_validity, nic_baro_valid, )                                  \
+    F(data_validity, nac_p_valid, )                                     \
+    F(data_validity, nac_v_valid, )                                     \
+    F(data_validity, sil_valid, )                                       \
+    F(data_validity, gva_valid, )                                       \
+    F(data_validity, sda_valid, )                                       \
+    B(unsigned, nic_a, 1)                                               \
+    B(unsigned, nic_c, 1)                                               \
+    B(unsigned, nic_baro, 1)                                            \
+    F(unsigned, nac_p, )                                                \
+    F(unsigned, nac_v, )                                                \
+    F(unsigned, sil, )                                                  \
+    F(sil_type_t, sil_type, )                                           \
+    F(unsigned, gva, )                                                  \
+    F(unsigned, sda, )                                                  \
+    F(data_validity, mrar_source_valid, )                               \
+    F(data_validity, wind_valid, )                                      \
+    F(data_validity, pressure_valid, )                                  \
+    F(data_validity, temperature_valid, )                               \
+    F(data_validity, turbulence_valid, )                                \
+    F(data_validity, humidity_valid, )                                  \
+    F(mrar_source_t, mrar_source, )                                     \
+    F(float, wind_speed, )                                              \
+    F(float, wind_dir, )                                                \
+    F(float, pressure, )                                                \
+    F(float, temperature, )                                             \
+    F(hazard_t, turbulence, )                                           \
+    F(float, humidity, )                                                \
+    F(int, modeA_hit, )                                                 \
+    F(int, modeC_hit, )                                                 \
+    F(int, fatsv_emitted_altitude_baro, )                               \
+    F(int, fatsv_emitted_altitude_geom, )                               \
+    F(int, fatsv_emitted_baro_rate, )                                   \
+    F(int, fatsv_emitted_geom_rate, )                                   \
+    F(float, fatsv_emitted_track, )                                     \
+    F(float, fatsv_emitted_track_rate, )                                \
+    F(float, fatsv_emitted_mag_heading, )                               \
+    F(float, fatsv_emitted_true_heading, )                              \
+    F(float, fatsv_emitted_roll, )                                      \
+    F(float, fatsv_emitted_gs, )                                        \
+    F(unsigned, fatsv_emitted_ias, )                                    \
+    F(unsigned, fatsv_emitted_tas, )                                    \
+    F(float, fatsv_emitted_mach, )                                      \
+    F(airground_t, fatsv_emitted_airground, )                           \
+    F(int, fatsv_emitted_nav_altitude_mcp, )                            \
+    F(int, fatsv_emitted_nav_altitude_fms, )                            \
+    F(nav_altitude_source_t, fatsv_emitted_nav_altitude_src, )          \
+    F(float, fatsv_emitted_nav_heading, )                               \
+    F(nav_modes_t, fatsv_emitted_nav_modes, )                           \
+    F(float, fatsv_emitted_nav_qnh, )                                   \
+    F(unsigned char, fatsv_emitted_bds_10, [7])                         \
+    F(unsigned char, fatsv_emitted_bds_17, [7])                         \
+    F(unsigned char, fatsv_emitted_bds_30, [7])                         \
+    F(unsigned char, fatsv_emitted_unknown_commb, [7])                  \
+    F(unsigned char, fatsv_emitted_es_status, [7])                      \
+    F(unsigned char, fatsv_emitted_es_acas_ra, [7])                     \
+    F(char, fatsv_emitted_callsign, [9])                                \
+    F(addrtype_t, fatsv_emitted_addrtype, )                             \
+    F(int, fatsv_emitted_adsb_version, )                                \
+    F(unsigned, fatsv_emitted_category, )                               \
+    F(unsigned, fatsv_emitted_squawk, )                                 \
+    F(unsigned, fatsv_emitted_nac_p, )                                  \
+    F(unsigned, fatsv_emitted_nac_v, )                                  \
+    F(unsigned, fatsv_emitted_sil, )                                    \
+    F(sil_type_t, fatsv_emitted_sil_type, )                             \
+    F(unsigned, fatsv_emitted_nic_baro, )                               \
+    F(emergency_t, fatsv_emitted_emergency, )                           \
+    F(uint64_t, fatsv_last_emitted, )                                   \
+    F(uint64_t, fatsv_last_force_emit, )                                \
+    F(struct aircraft *, next, )
+
+#define VALIDITY_FIELDS(F, B)                                           \
+    F(uint64_t, stale_interval, )                                       \
+    F(uint64_t, expire_interval, )                                      \
+    F(datasource_t, source, )                                           \
+    F(uint64_t, updated, )                                              \
+    F(uint64_t, stale, )                                                \
+    F(uint64_t, expires, )
+
+// The structures as the lists describe them
+#define DECLARE_FIELD(type, name, dims) type name dims;
+#define DECLARE_BITFIELD(type, name, bits) type name : bits;
+struct aircraft_layout { AIRCRAFT_FIELDS(DECLARE_FIELD, DECLARE_BITFIELD) };
+struct validity_layout { VALIDITY_FIELDS(DECLARE_FIELD, DECLARE_BITFIELD) };
+#undef DECLARE_FIELD
+#undef DECLARE_BITFIELD
+
+#define CHECK_FIELD(s, layout, type, name, dims)                        \
+    _Static_assert(offsetof(s, name) == offsetof(layout, name) &&       \
+                   _Generic(&((s *) 0)->name, type (*) dims: 1, default: 0), \
+                   #s "." #name " doesn't match the field list in track_state.c");
+#define CHECK_AIRCRAFT_FIELD(type, name, dims) CHECK_FIELD(struct aircraft, struct aircraft_layout, type, name, dims)
+#define CHECK_VALIDITY_FIELD(type, name, dims) CHECK_FIELD(data_validity, struct validity_layout, type, name, dims)
+#define CHECK_BITFIELD(type, name, bits)    // covered by the offset of the field that follows
+AIRCRAFT_FIELDS(CHECK_AIRCRAFT_FIELD, CHECK_BITFIELD)
+VALIDITY_FIELDS(CHECK_VALIDITY_FIELD, CHECK_BITFIELD)
+#undef CHECK_FIELD
+#undef CHECK_AIRCRAFT_FIELD
+#undef CHECK_VALIDITY_FIELD
+#undef CHECK_BITFIELD
+
+_Static_assert(sizeof(struct aircraft) == sizeof(struct aircraft_layout), "struct aircraft doesn't match the field list in track_state.c");
+_Static_assert(sizeof(data_validity) == sizeof(struct validity_layout), "data_validity doesn't match the field list in track_state.c");
+
+// Bitfields have no offset or size of their own
+struct layout_field {
+    const char *decl;
+    size_t offset;
+    size_t size;
+};
+
+#define TABLE_FIELD(s, type, name, dims) { #type " " #name #dims, offsetof(s, name), sizeof(((s *) 0)->name) },
+#define TABLE_AIRCRAFT_FIELD(type, name, dims) TABLE_FIELD(struct aircraft, type, name, dims)
+#define TABLE_VALIDITY_FIELD(type, name, dims) TABLE_FIELD(data_validity, type, name, dims)
+#define TABLE_BITFIELD(type, name, bits) { #type " " #name " : " #bits, 0, 0 },
+static const struct layout_field aircraft_fields[] = { AIRCRAFT_FIELDS(TABLE_AIRCRAFT_FIELD, TABLE_BITFIELD) };
+static const struct layout_field validity_fields[] = { VALIDITY_FIELDS(TABLE_VALIDITY_FIELD, TABLE_BITFIELD) };
+#undef TABLE_FIELD
+#undef TABLE_AIRCRAFT_FIELD
+#undef TABLE_VALIDITY_FIELD
+#undef TABLE_BITFIELD
+
+static uint64_t hashBytes(uint64_t h, const void *data, size_t len)
+{
+    // FNV-1a
+    const unsigned char *p = data;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static uint64_t hashFields(uint64_t h, const struct layout_field *fields, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t offset = fields[i].offset, size = fields[i].size;
+        h = hashBytes(h, fields[i].decl, strlen(fields[i].decl) + 1);
+        // native byte order, so a snapshot from a different-endian host doesn't match either
+        h = hashBytes(h, &offset, sizeof(offset));
+        h = hashBytes(h, &size, sizeof(size));
+    }
+    return h;
+}
+
+// Hash of the declaration, offset and size of every field of a saved record.
+// Snapshots are only restored by a build that computes the same hash.
+static uint64_t layoutHash(void)
+{
+    static uint64_t hash;
+    if (!hash) {
+        uint64_t sizes[2] = { sizeof(struct aircraft), sizeof(data_validity) };
+        hash = hashBytes(0xcbf29ce484222325ULL, sizes, sizeof(sizes));
+        hash = hashFields(hash, aircraft_fields, sizeof(aircraft_fields) / sizeof(aircraft_fields[0]));
+        hash = hashFields(hash, validity_fields, sizeof(validity_fields) / sizeof(validity_fields[0]));
+    }
+    return hash;
+}
+
+static void fillHeader(struct track_state_header *header, uint64_t now, uint32_t count)
+{
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, TRACK_STATE_MAGIC, sizeof(TRACK_STATE_MAGIC));
+    header->version = TRACK_STATE_VERSION;
+    header->record_size = sizeof(struct aircraft);
+    header->validity_size = sizeof(data_validity);
+    header->count = count;
+    header->saved = now;
+    header->layout = layoutHash();
+}
+
+// Would trackPeriodicUpdate have removed this aircraft by now?
+static bool expired(const struct aircraft *a, uint64_t now)
+{
+    return now < a->seen ||
+        now - a->seen > TRACK_AIRCRAFT_TTL ||
+        (!a->reliable && now - a->seen > TRACK_AIRCRAFT_UNRELIABLE_TTL);
+}
+
+void trackStateLoad(void)
+{
+    const char *path = Modes.track_state_file;
+    if (!path)
+        return;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT)
+            fprintf(stderr, "track state: can't open %s: %s\n", path, strerror(errno));
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(struct track_state_header)) {
+        fprintf(stderr, "track state: %s is truncated, ignoring it\n", path);
+        close(fd);
+        return;
+    }
+
+    void *base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "track state: can't map %s: %s\n", path, strerror(errno));
+        return;
+    }
+
+    const struct track_state_header *header = base;
+    struct track_state_header expected;
+    uint64_t now = mstime();
+    fillHeader(&expected, now, 0);
+
+    if (memcmp(header->magic, expected.magic, sizeof(header->magic)) ||
+        header->version != expected.version ||
+        header->record_size != expected.record_size ||
+        header->validity_size != expected.validity_size ||
+        header->layout != expected.layout) {
+        fprintf(stderr, "track state: %s was written by an incompatible version, ignoring it\n", path);
+        goto done;
+    }
+
+    if ((size_t) st.st_size < sizeof(*header) + (size_t) header->count * header->record_size) {
+        fprintf(stderr, "track state: %s is truncated, ignoring it\n", path);
+        goto done;
+    }
+
+    // Keep the saved order, which is the order the tracker had them in
+    const struct aircraft *records = (const struct aircraft *) (header + 1);
+    struct aircraft **tail = &Modes.aircrafts;
+    while (*tail)
+        tail = &(*tail)->next;
+
+    unsigned restored = 0, filtered = 0;
+    for (uint32_t i = 0; i < header->count; ++i) {
+        if (expired(&records[i], now))
+            continue;
+
+        struct aircraft *a = malloc(sizeof(*a));
+        if (!a) {
+            fprintf(stderr, "track state: out of memory\n");
+            break;
+        }
+
+        memcpy(a, &records[i], sizeof(*a));
+        a->next = NULL;
+        a->modeA_hit = a->modeC_hit = 0;
+
+        // Clients of this process haven't seen any of it yet
+        a->fatsv_last_emitted = 0;
+        a->fatsv_last_force_emit = 0;
+
+        *tail = a;
+        tail = &a->next;
+        ++restored;
+
+        // As if the DF11/DF17 that put it in the filter had just been seen
+        if (!(a->addr & MODES_NON_ICAO_ADDRESS) && (a->reliableDF11 || a->reliableDF17) && now - a->seen < FILTER_AGE) {
+            icaoFilterAdd(a->addr);
+            ++filtered;
+        }
+    }
+
+    fprintf(stderr, "track state: restored %u of %u aircraft (%u known addresses) from %s, saved %.0f seconds ago\n",
+            restored, header->count, filtered, path, header->saved <= now ? (now - header->saved) / 1000.0 : 0.0);
+
+ done:
+    munmap(base, st.st_size);
+}
+
+// Write the snapshot. With wait, don't return until it has reached the
+// disk; otherwise leave the writeback to the kernel, as waiting for it
+// from the main loop would stall decoding.
+static bool saveState(bool wait)
+{
+    const char *path = Modes.track_state_file;
+    if (!path)
+        return true;
+
+    uint64_t now = mstime();
+    uint32_t count = 0;
+    for (struct aircraft *a = Modes.aircrafts; a; a = a->next) {
+        if (!expired(a, now))
+            ++count;
+    }
+
+    char tmp[PATH_MAX];
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) {
+        fprintf(stderr, "track state: path too long: %s\n", path);
+        return false;
+    }
+
+    int fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "track state: can't create %s: %s\n", tmp, strerror(errno));
+        return false;
+    }
+
+    size_t size = sizeof(struct track_state_header) + (size_t) count * sizeof(struct aircraft);
+    void *base = MAP_FAILED;
+    if (ftruncate(fd, size) < 0 ||
+        (base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        fprintf(stderr, "track state: can't write %s: %s\n", tmp, strerror(errno));
+        close(fd);
+        unlink(tmp);
+        return false;
+    }
+
+    struct aircraft *records = (struct aircraft *) ((struct track_state_header *) base + 1);
+    uint32_t n = 0;
+    for (struct aircraft *a = Modes.aircrafts; a && n < count; a = a->next) {
+        if (expired(a, now))
+            continue;
+        memcpy(&records[n], a, sizeof(*a));
+        records[n].next = NULL;
+        ++n;
+    }
+
+    // header last, so a partly written file never looks complete
+    fillHeader(base, now, n);
+
+    bool ok = (msync(base, size, wait ? MS_SYNC : MS_ASYNC) == 0);
+    munmap(base, size);
+    if (close(fd) < 0)
+        ok = false;
+
+    if (!ok || rename(tmp, path) < 0) {
+        fprintf(stderr, "track state: can't write %s: %s\n", path, strerror(errno));
+        unlink(tmp);
+        return false;
+    }
+
+    return true;
+}
+
+#else /* _WIN32 */
+
+void trackStateLoad(void)
+{
+    if (Modes.track_state_file)
+        fprintf(stderr, "track state: not supported on this platform\n");
+}
+
+static bool saveState(bool wait)
+{
+    MODES_NOTUSED(wait);
+    return !Modes.track_state_file;
+}
+
+#endif /* _WIN32 */
+
+bool trackStateSave(void)
+{
+    return saveState(true);
+}
+
+void trackStatePeriodicUpdate(uint64_t now)
+{
+    static uint64_t next_save;
+
+    if (!Modes.track_state_file || !Modes.track_state_interval)
+        return;
+
+    if (next_save == 0) {
+        next_save = now + Modes.track_state_interval;
+    } else if (now >= next_save) {
+        saveState(false);
+        next_save = now + Modes.track_state_interval;
+    }
+}
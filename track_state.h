@@ -0,0 +1,68 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// track_state.h: saving and restoring aircraft state across restarts
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_TRACK_STATE_H
+#define DUMP1090_TRACK_STATE_H
+
+// With --track-state <file>, the aircraft list is written to <file> on exit
+// and every --track-state-every seconds, and read back at startup. A restart
+// then keeps the CPR odd/even history (so global position decoding resumes
+// with the next position message), the known addresses (so DF4/5/20/21
+// replies are accepted straight away) and everything shown on the map.
+//
+// All tracker times are wall-clock milliseconds, so restored data simply
+// ages by however long dump1090 was stopped: aircraft that would have
+// expired in the meantime are not restored, and the rest expire as usual.
+// The ICAO address filter is rebuilt from the restored aircraft that had
+// sent uncorrected DF11 or DF17 messages within the filter's lifetime.
+//
+// The file is a header followed by the aircraft records as they are held
+// in memory. It is written to a temporary file through mmap and renamed
+// into place, so a crash during a save leaves the previous snapshot.
+// Periodic saves leave writing the pages back to the kernel; the save on
+// exit waits for them to reach the disk. The
+// header carries a hash of the declaration, offset and size of every field of
+// struct aircraft (and data_validity); the file is only read back by a
+// build with the same hash, otherwise it is ignored and decoding starts
+// from scratch.
+
+#define TRACK_STATE_MAGIC "dump1090-tracks"
+#define TRACK_STATE_VERSION 2
+#define TRACK_STATE_DEFAULT_INTERVAL 60000  // milliseconds
+
+struct track_state_header {
+    char magic[16];                 // TRACK_STATE_MAGIC, NUL-padded
+    uint32_t version;               // TRACK_STATE_VERSION
+    uint32_t record_size;           // sizeof(struct aircraft)
+    uint32_t validity_size;         // sizeof(data_validity)
+    uint32_t count;                 // number of records that follow
+    uint64_t saved;                 // mstime() when the snapshot was taken
+    uint64_t layout;                // hash of the declaration, offset and size of every record field
+};
+
+// Restore the aircraft list from Modes.track_state_file, if it exists.
+// Call after the ICAO filter has been initialized.
+void trackStateLoad(void);
+
+// Write the aircraft list to Modes.track_state_file and wait for it to
+// reach the disk. Returns false, with a message on stderr, on failure.
+bool trackStateSave(void);
+
+// Call periodically to save every Modes.track_state_interval
+void trackStatePeriodicUpdate(uint64_t now);
+
+#endif
@@ -26,6 +26,9 @@
 /* Returns system time in milliseconds */
 uint64_t mstime(void);
 
+/* Returns a monotonic clock in microseconds, for measuring intervals */
+uint64_t monotonic_us(void);
+
 /* Returns the time for the current message we're dealing with */
 extern uint64_t _messageNow;
 static inline uint64_t messageNow() {
@@ -98,7 +98,7 @@ static void view1090Init(void) {
     }
 
     // Prepare error correction tables
-    modesChecksumInit(Modes.nfix_crc);
+    modesChecksumInit(Modes.nfix_crc, NULL);
     icaoFilterInit();
     modeACInit();
 }
@@ -120,6 +120,9 @@ static void showHelp(void) {
   "--modeac                 Enable decoding of SSR modes 3/A & 3/C\n"
   "--net-bo-ipaddr <IPv4>   TCP Beast output listen IPv4 (default: 127.0.0.1)\n"
   "--net-bo-port <port>     TCP Beast output listen port (default: 30005)\n"
+  "--shm-ring <name>        Read messages from dump1090's shared memory ring\n"
+  "                         (dump1090 --net-shm-ring), falling back to Beast\n"
+  "                         over TCP if it is not available\n"
   "--lat <latitude>         Reference/receiver latitide for surface posn (opt)\n"
   "--lon <longitude>        Reference/receiver longitude for surface posn (opt)\n"
   "--max-range <distance>   Absolute maximum range for position decoding (in nm, default: 300)\n"
@@ -150,6 +153,8 @@ int main(int argc, char **argv) {
     struct net_service *s;
     char *bo_connect_ipaddr = "127.0.0.1";
     int bo_connect_port = 30005;
+    char *shm_ring_name = NULL;
+    struct shm_ring_reader *ring = NULL;
 
     // Set sane defaults
 
@@ -164,6 +169,8 @@ int main(int argc, char **argv) {
             bo_connect_port = atoi(argv[++j]);
         } else if (!strcmp(argv[j],"--net-bo-ipaddr") && more) {
             bo_connect_ipaddr = argv[++j];
+        } else if (!strcmp(argv[j],"--shm-ring") && more) {
+            shm_ring_name = argv[++j];
         } else if (!strcmp(argv[j],"--modeac")) {
             Modes.mode_ac = 1;
         } else if (!strcmp(argv[j],"--no-interactive")) {
@@ -224,33 +231,55 @@ int main(int argc, char **argv) {
     view1090Init();
     modesInitNet();
 
-    // Try to connect to the selected ip address and port. We only support *ONE* input connection which we initiate.here.
+    // Use the shared memory ring if there is one, else try to connect to the
+    // selected ip address and port. We only support *ONE* input connection which we initiate.here.
     s = makeBeastInputService();
-    c = serviceConnect(s, bo_connect_ipaddr, bo_connect_port);
-    if (!c) {
-        interactiveCleanup();
-        fprintf(stderr, "Failed to connect to %s:%d: %s\n", bo_connect_ipaddr, bo_connect_port, Modes.aneterr);
-        exit(1);
+    if (shm_ring_name)
+        ring = shmRingAttach(shm_ring_name);
+    if (!ring) {
+        c = serviceConnect(s, bo_connect_ipaddr, bo_connect_port);
+        if (!c) {
+            interactiveCleanup();
+            fprintf(stderr, "Failed to connect to %s:%d: %s\n", bo_connect_ipaddr, bo_connect_port, Modes.aneterr);
+            exit(1);
+        }
+        sendSettings(c);
     }
-    sendSettings(c);
 
     // Keep going till the user does something that stops us
     interactiveInit();
+    uint64_t next_update = 0;
     while (!Modes.exit) {
         struct timespec r = { 0, 100 * 1000 * 1000};
-        icaoFilterExpire();
-        trackPeriodicUpdate();
-        modesNetPeriodicWork();
+        int count = 0;
+
+        if (ring && (count = modesReadShmRing(ring)) < 0) {
+            // producer went away; reconnect below
+            shmRingDetach(ring);
+            ring = NULL;
+        }
+
+        // Messages from the ring are handled as soon as they are seen;
+        // the periodic work keeps its usual 100ms schedule
+        uint64_t now = mstime();
+        if (now >= next_update) {
+            icaoFilterExpire();
+            trackPeriodicUpdate();
+            modesNetPeriodicWork();
 
-        interactiveShowData();
+            interactiveShowData();
+            next_update = now + 100;
+        }
 
-        if (s->connections == 0) {
+        if (!ring && s->connections == 0) {
             if (!Modes.interactive)
                 break;
 
             // lost input connection, try to reconnect
             interactiveNoConnection();
             sleep(1);
+            if (shm_ring_name && (ring = shmRingAttach(shm_ring_name)))
+                continue;
             c = serviceConnect(s, bo_connect_ipaddr, bo_connect_port);
             if (c) {
                 sendSettings(c);
@@ -258,9 +287,18 @@ int main(int argc, char **argv) {
             continue;
         }
 
+        if (ring) {
+            if (count == 0) {
+                r.tv_nsec = SHM_RING_POLL_INTERVAL * 1000 * 1000;
+                nanosleep(&r, NULL);
+            }
+            continue;
+        }
+
         nanosleep(&r, NULL);
     }
 
+    shmRingDetach(ring);
     interactiveCleanup();
     return (0);
 }